@@ -8,12 +8,15 @@
 
 #include "ConsoleRoboCupCtrl.h"
 
+#include <QCoreApplication>
+#include <QDir>
 #include <QDirIterator>
 #include <QFileDialog>
 #include <QInputDialog>
 #include <QSettings>
 
 #include <algorithm>
+#include <fstream>
 #include <iostream>
 #include <cctype>
 
@@ -142,6 +145,16 @@ void ConsoleRoboCupCtrl::update()
   for(RemoteRobot* remoteRobot : remoteRobots)
     remoteRobot->update();
 
+  if(!batchReplays.empty())
+    checkBatchReplay();
+
+  if(quitTime && getTime() >= quitTime)
+  {
+    std::cout << "Score " << gameController.getScore() << std::endl;
+    quitTime = 0;
+    QCoreApplication::exit(exitCode);
+  }
+
   Global::theStreamHandler = &streamHandler;
 
   {
@@ -400,6 +413,16 @@ void ConsoleRoboCupCtrl::executeConsoleCommand(std::string command, RobotConsole
     if(!startLogFile(stream))
       printLn("Logfile not found!");
   }
+  else if(buffer == "bl")
+  {
+    if(!startBatchReplay(stream))
+      printLn("Syntax Error");
+  }
+  else if(buffer == "quit")
+  {
+    if(!quit(stream))
+      printLn("Syntax Error");
+  }
   else if(selected.empty())
     if(buffer == "cls")
       printLn("_cls");
@@ -456,6 +479,7 @@ void ConsoleRoboCupCtrl::help(In& stream)
   list("Initialization commands:", pattern, true);
   list("  sc <name> [<a.b.c.d>] : Starts a TCP connection to a remote robot.", pattern, true);
   list("  sl <name> <file> : Starts a robot reading its inputs from a log file.", pattern, true);
+  list("  bl <pattern> <report> : Starts one robot per log file matching the pattern that all replay in parallel. A timing report is written when all are finished.", pattern, true);
   list("  cs <scenario> : Change scenario (only during initial script execution).", pattern, true);
   list("  cl <location> : Change location (only during initial script execution).", pattern, true);
   list("Global commands:", pattern, true);
@@ -467,6 +491,7 @@ void ConsoleRoboCupCtrl::help(In& stream)
   list("  echo <text> : Print text into console window. Useful in console.con.", pattern, true);
   list("  gc initial | ready | set | playing | finished | kickOffFirstTeam | kickOffRed | outByFirstTeam | outByRed | gameMixedTeamPlayoff | gameMixedTeamRoundRobin | gamePlayoff | gameRoundRobin : Set GameController state.", pattern, true);
   list("  help | ? [<pattern>] : Display this text.", pattern, true);
+  list("  quit [<seconds> [<exit code>]] : Quit SimRobot after the given number of seconds (of simulated time after \"st on\") and print the score. Useful together with \"SimRobot -headless\".", pattern, true);
   list("  robot ? | all | <name> {<name>} : Connect console to a set of active robots. Alternatively, double click on robot.", pattern, true);
   list("  st off | on : Switch simulation of time on or off.", pattern, true);
   list("  # <text> : Comment.", pattern, true);
@@ -482,15 +507,17 @@ void ConsoleRoboCupCtrl::help(In& stream)
   list("  log start | stop | clear | save <file> | full | jpeg : Record log file and (de)activate image compression.", pattern, true);
   list("  log saveAudio <file> : Save audio data from log.", pattern, true);
   list("  log saveBallSpotImages <file> : Save images around ballspots from log.", pattern, true);
+  list("  log saveCSV <file> <message> {<message>} : Save the specified representations from log to csv, one column per value.", pattern, true);
   list("  log saveImages [raw] <file> : Save images from log.", pattern, true);
   list("  log saveInertialSensorData <file> : Save the inertial sensor data from the log into a dataset.", pattern, true);
   list("  log saveTiming <file> : Save timing data from log to csv.", pattern, true);
   list("  log ? [<pattern>] : Display information about log file.", pattern, true);
-  list("  log load <file> | clear : Load log-file or clear all frames.", pattern, true);
+  list("  log load <file> [<blocks>] | clear : Load log-file or clear all frames. If <blocks> is given, only so many blocks are decompressed at the same time.", pattern, true);
   list("  log merge : Merge a cognition/motion-log with its counterpart.", pattern, true);
   list("  log keep ( ballPercept [ seen | guessed ] | ballSpots | goalPostPercept | image | penaltyMarkPercept ): Remove the log's frames not matching specified criteria.", pattern, true);
+  list("  log keep where <value> ( == | != | < | <= | > | >= ) <constant> {<value> <op> <constant>} : Remove the log's frames in which not all comparisons hold. Values are named as in 'log saveCSV', e.g. RobotPose.validity.", pattern, true);
   list("  log ( keep | remove ) <message> {<message>} : Filter specified messages of all frames.", pattern, true);
-  list("  log start | pause | stop | forward [image] | backward [image] | repeat | goto <number> | time <minutes> <seconds> | cycle | once | fastForward | fastBackward : Replay log file.", pattern, true);
+  list("  log start | pause | stop | forward [image] | backward [image] | repeat | goto <number> | time <minutes> <seconds> | cycle | once | fastForward | fastBackward : Replay log file. After 'robot all', 'log time' aligns the logs of several robots by Game Controller time.", pattern, true);
   list("  mof : Recompile motion net and send it to the robot. ", pattern, true);
   list("  msg off | on | log <file> | enable | disable : Switch output of text messages on or off. Log text messages to a file. Switch message handling on or off.", pattern, true);
   list("  mr ? [<pattern>] | modules [<pattern>] | save | <representation> ( ? [<pattern>] | <module> | off ) : Send module request.", pattern, true);
@@ -563,6 +590,16 @@ bool ConsoleRoboCupCtrl::startLogFile(In& stream)
 {
   std::string name, fileName;
   stream >> name >> fileName;
+  RobotConsole* rc = startLogFile(name, fileName);
+  if(!rc)
+    return false;
+  selected.clear();
+  selected.push_back(rc);
+  return true;
+}
+
+RobotConsole* ConsoleRoboCupCtrl::startLogFile(const std::string& name, std::string fileName)
+{
   if(int(fileName.rfind('.')) <= int(fileName.find_last_of("\\/")))
     fileName = fileName + ".log";
   if(fileName[0] != '\\' && fileName[0] != '/' && (fileName.size() < 2 || fileName[1] != ':'))
@@ -571,7 +608,7 @@ bool ConsoleRoboCupCtrl::startLogFile(In& stream)
   {
     InBinaryFile test(fileName);
     if(!test.exists())
-      return false;
+      return nullptr;
   }
 
   std::string robotName = std::string(".") + name;
@@ -581,10 +618,61 @@ bool ConsoleRoboCupCtrl::startLogFile(In& stream)
   robots.push_back(new Robot(name));
   this->robotName = nullptr;
   logFile = "";
-  selected.clear();
   RobotConsole* rc = robots.back()->getRobotProcess();
-  selected.push_back(rc);
   robots.back()->start();
+  return rc;
+}
+
+bool ConsoleRoboCupCtrl::startBatchReplay(In& stream)
+{
+  std::string pattern;
+  stream >> pattern >> batchReportFile;
+  if(pattern == "" || batchReportFile == "")
+    return false;
+
+  QDir qdir((std::string(File::getBHDir()) + "/Config/Logs").c_str());
+  qdir.setFilter(QDir::Files);
+  qdir.setNameFilters(QStringList(pattern.c_str()));
+  qdir.setSorting(QDir::Name);
+  selected.clear();
+  for(const QString& fileName : qdir.entryList())
+  {
+    RobotConsole* rc = startLogFile("Batch" + std::to_string(batchReplays.size() + 1), fileName.toUtf8().constData());
+    if(rc)
+    {
+      rc->handleConsole("dr timing on");
+      batchReplays.push_back(rc);
+      selected.push_back(rc);
+    }
+  }
+  if(batchReplays.empty())
+    printLn("No log files found!");
+  return true;
+}
+
+void ConsoleRoboCupCtrl::checkBatchReplay()
+{
+  for(RobotConsole* rc : batchReplays)
+    if(!rc->isReplayFinished())
+      return;
+
+  std::ofstream report(batchReportFile);
+  for(RobotConsole* rc : batchReplays)
+    rc->writeTimingReport(report);
+  printLn("Batch replay of " + std::to_string(batchReplays.size()) + " log files finished, report written to " + batchReportFile + ".");
+  batchReplays.clear();
+}
+
+bool ConsoleRoboCupCtrl::quit(In& stream)
+{
+  std::string seconds;
+  std::string code;
+  stream >> seconds >> code;
+  for(char c : seconds + code)
+    if(!isdigit(c) && c != '-')
+      return false;
+  quitTime = getTime() + 1000 * std::max(0, atoi(seconds.c_str())) + 1; // never 0
+  exitCode = atoi(code.c_str());
   return true;
 }
 
@@ -675,6 +763,7 @@ void ConsoleRoboCupCtrl::createCompletion()
     "log saveJointAngleData",
     "log saveAudio",
     "log saveBallSpotImages",
+    "log saveCSV",
     "log saveImages raw",
     "log saveTiming",
     "log clear",
@@ -701,6 +790,7 @@ void ConsoleRoboCupCtrl::createCompletion()
     "log keep goalPostPercept",
     "log keep image",
     "log keep penaltyMarkPercept",
+    "log keep where",
     "mof",
     "mr modules",
     "mr save",
@@ -717,12 +807,14 @@ void ConsoleRoboCupCtrl::createCompletion()
     "qfr reject",
     "qfr collect",
     "qfr save",
+    "quit",
     "robot all",
     "sc",
     "si lower number",
     "si upper number",
     "si reset",
     "sl",
+    "bl",
     "st off",
     "st on",
     "v3 image upper",
@@ -39,6 +39,10 @@ private:
   ConsoleView* consoleView; /**< The scene graph object that describes the console widget. */
   std::list<RobotConsole*> selected; /**< The currently selected simulated robot. */
   std::list<RemoteRobot*> remoteRobots; /**< The list of all remote robots. */
+  std::list<RobotConsole*> batchReplays; /**< The robots started by "bl" that have not finished yet. */
+  std::string batchReportFile; /**< The file the report of the batch replay is written to. */
+  unsigned quitTime = 0; /**< The simulated time when SimRobot is quit by "quit". 0 if it is not quit. */
+  int exitCode = 0; /**< The exit code SimRobot returns when it is quit by "quit". */
   std::list<std::string> textMessages; /**< A list of all text messages received in the current frame. */
   bool newLine = true; /**< States whether the last line of text was finished by a new line. */
   int nesting = 0; /**< The number of recursion level during the execution of console files. */
@@ -242,6 +246,31 @@ private:
    */
   bool startLogFile(In& stream);
 
+  /**
+   * The function starts a robot reading its inputs from a log file.
+   * @param name The name of the robot.
+   * @param fileName The name of the log file.
+   * @return The console of the robot or nullptr if the log file does not exist.
+   */
+  RobotConsole* startLogFile(const std::string& name, std::string fileName);
+
+  /**
+   * The function handles the console input for the "bl" command.
+   * @param stream The stream containing the parameters of "bl".
+   * @return Returns true if the parameters were correct.
+   */
+  bool startBatchReplay(In& stream);
+
+  /** The function writes the report of the batch replay when all its robots have finished. */
+  void checkBatchReplay();
+
+  /**
+   * The function handles the console input for the "quit" command.
+   * @param stream The stream containing the parameters of "quit".
+   * @return Returns true if the parameters were correct.
+   */
+  bool quit(In& stream);
+
   /**
    * The function handles the console input for the "ci" command.
    * @param stream The stream containing the parameters of "ci".
@@ -500,6 +500,12 @@ void GameController::setLastBallContactRobot(SimRobot::Object* robot)
   lastBallContactPose = Pose2f(SimulatedRobot::isFirstTeam(robot) ? pi : 0, SimulatedRobot::getPosition(robot));
 }
 
+std::string GameController::getScore()
+{
+  SYNC;
+  return std::to_string(teamInfos[0].score) + ":" + std::to_string(teamInfos[1].score);
+}
+
 void GameController::writeGameInfo(Out& stream)
 {
   SYNC;
@@ -110,6 +110,12 @@ public:
    */
   static void setLastBallContactRobot(SimRobot::Object* robot);
 
+  /**
+   * Returns the current score of both teams.
+   * @return The goals scored by the first team followed by the goals of the second team, e.g. "2:1".
+   */
+  std::string getScore();
+
   /**
    * Write the current game information to the stream provided.
    * @param stream The stream the game information is written to.
@@ -7,6 +7,7 @@
  */
 
 #include <QImage>
+#include <QFile>
 #include <QFileInfo>
 #include "LogPlayer.h"
 #include "Platform/BHAssert.h"
@@ -18,12 +19,145 @@
 #include "Representations/Infrastructure/SensorData/InertialSensorData.h"
 #include "Representations/Infrastructure/Thumbnail.h"
 #include "Representations/Perception/BallPercepts/BallSpots.h"
+#include "Tools/Debugging/DebugDataStreamer.h"
+#include "Tools/Logging/DeltaCoding.h"
 #include "Tools/Logging/LogFileFormat.h"
+#include "Tools/Math/Angle.h"
 
 #include <snappy-c.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
 #include <vector>
 #include <map>
 #include <fstream>
+#include <unordered_map>
+
+namespace
+{
+  /**
+   * A stream that flattens the data written to it into a row of a table.
+   * Each basic value becomes a column that is named after the path of
+   * attributes and array elements leading to it.
+   */
+  class OutRow : public Out
+  {
+  private:
+    /**
+     * An entry representing the current state in the writing process.
+     */
+    struct Entry
+    {
+      std::string path; /**< The name of the column of this entry. */
+      int type; /**< The type of the entry. -2: value or record, -1: array, >= 0: array element index. */
+      const char* (*enumToString)(int); /**< A function that translates an enum to a string. */
+    };
+    std::string prefix; /**< The prefix of all column names, i.e. the name of the representation. */
+    std::vector<Entry> stack; /**< The hierarchy of values that are written. */
+
+    /** Adds a value under the name of the current entry. */
+    void add(const std::string& value) {row.emplace_back(stack.empty() ? prefix : stack.back().path, value);}
+
+    /** Adds a number using a printf format. */
+    template<typename T> void add(const char* format, T value)
+    {
+      char buf[32];
+      sprintf(buf, format, value);
+      add(std::string(buf));
+    }
+
+  protected:
+    virtual void outBool(bool value) {add(std::string(value ? "true" : "false"));}
+    virtual void outChar(char value) {add("%d", static_cast<int>(value));}
+    virtual void outSChar(signed char value) {add("%d", static_cast<int>(value));}
+    virtual void outUChar(unsigned char value)
+    {
+      const char* name = !stack.empty() && stack.back().enumToString ? stack.back().enumToString(value) : nullptr;
+      if(name)
+        add(std::string(name));
+      else
+        add("%u", static_cast<unsigned>(value));
+    }
+    virtual void outShort(short value) {add("%d", static_cast<int>(value));}
+    virtual void outUShort(unsigned short value) {add("%u", static_cast<unsigned>(value));}
+    virtual void outInt(int value) {add("%d", value);}
+    virtual void outUInt(unsigned int value)
+    {
+      if(stack.empty() || stack.back().type != -1) // The size of an array is not a column
+        add("%u", value);
+    }
+    virtual void outFloat(float value) {add("%g", static_cast<double>(value));}
+    virtual void outDouble(double value) {add("%g", value);}
+    virtual void outString(const char* value)
+    {
+      std::string quoted = "\"";
+      for(; *value; ++value)
+        quoted += *value == '"' ? std::string("\"\"") : std::string(1, *value);
+      add(quoted + "\"");
+    }
+    virtual void outAngle(const Angle& value) {add("%g", static_cast<double>(static_cast<float>(value)));}
+    virtual void outEndL() {}
+
+  public:
+    std::vector<std::pair<std::string, std::string>> row; /**< The column names and values written. */
+
+    /**
+     * Constructor.
+     * @param prefix The prefix of all column names, i.e. the name of the representation.
+     */
+    OutRow(const std::string& prefix) : prefix(prefix) {}
+
+    virtual void select(const char* name, int type, const char* (*enumToString)(int))
+    {
+      Streaming::trimName(name);
+      const std::string& parent = stack.empty() ? prefix : stack.back().path;
+      if(type >= 0)
+        stack.push_back({parent + "[" + std::to_string(type) + "]", type, enumToString});
+      else
+        stack.push_back({name ? parent + "." + name : parent, type, enumToString});
+    }
+
+    virtual void deselect() {stack.pop_back();}
+
+    /** Writing raw data is not supported. Do not call. */
+    virtual void write(const void* p, size_t size) {FAIL("Unsupported operation.");}
+  };
+
+  /**
+   * Compares a value written by OutRow with another one. If both are
+   * numbers, they are compared numerically, otherwise as strings.
+   * @param a The value written by OutRow.
+   * @param op The comparison: ==, !=, <, <=, >, or >=.
+   * @param b The value compared with.
+   * @return Does the comparison hold?
+   */
+  bool compare(std::string a, const std::string& op, const std::string& b)
+  {
+    if(a.size() >= 2 && a.front() == '"' && a.back() == '"')
+      a = a.substr(1, a.size() - 2);
+    char* endA;
+    char* endB;
+    const double numA = strtod(a.c_str(), &endA);
+    const double numB = strtod(b.c_str(), &endB);
+    const int result = !a.empty() && !b.empty() && !*endA && !*endB
+                       ? (numA < numB ? -1 : numA > numB ? 1 : 0)
+                       : a.compare(b);
+    if(op == "==")
+      return result == 0;
+    else if(op == "!=")
+      return result != 0;
+    else if(op == "<")
+      return result < 0;
+    else if(op == "<=")
+      return result <= 0;
+    else if(op == ">")
+      return result > 0;
+    else if(op == ">=")
+      return result >= 0;
+    else
+      return false;
+  }
+}
 
 LogPlayer::LogPlayer(MessageQueue& targetQueue) :
   targetQueue(targetQueue)
@@ -31,9 +165,18 @@ LogPlayer::LogPlayer(MessageQueue& targetQueue) :
   init();
 }
 
+LogPlayer::~LogPlayer() = default;
+
 void LogPlayer::init()
 {
   clear();
+  blockCache.clear();
+  blockOffsets.clear();
+  messageIDMapping.clear();
+  mappedData = nullptr;
+  mappedFile = nullptr;
+  deltaEncoded = false;
+  gcTimesIndexed = false;
   stop();
   numberOfFrames = 0;
   numberOfMessagesWithinCompleteFrames = 0;
@@ -41,10 +184,11 @@ void LogPlayer::init()
   state = initial;
   loop = false; //default: loop disabled
   streamHandler = nullptr;
+  logFileIndex = nullptr;
   streamSpecificationReplayed = false;
 }
 
-bool LogPlayer::open(const std::string& fileName)
+bool LogPlayer::open(const std::string& fileName, size_t blockCacheSize)
 {
   InBinaryFile file(fileName);
 
@@ -75,10 +219,27 @@ bool LogPlayer::open(const std::string& fileName)
         file >> *this;
         break;
       case Logging::logFileCompressed: //compressed log file
+      case Logging::logFileIndexed: //compressed log file followed by an index
+      case Logging::logFileIndexedDeltaEncoded: //same, but messages are delta encoded
+        this->blockCacheSize = blockCacheSize;
+        deltaEncoded = magicByte == Logging::logFileIndexedDeltaEncoded;
+        if(magicByte != Logging::logFileCompressed && blockCacheSize > 0 && map(file))
+        {
+          stop();
+          indexBlocks();
+          logfileLoaded = true;
+          return true;
+        }
         while(!file.eof())
         {
           unsigned compressedSize;
           file >> compressedSize;
+          if(compressedSize == 0 && magicByte != Logging::logFileCompressed)
+          {
+            logFileIndex = std::unique_ptr<LogFileIndex>(new LogFileIndex);
+            file >> *logFileIndex;
+            break;
+          }
           ASSERT(compressedSize > 0);
           std::vector<char> compressedBuffer;
           compressedBuffer.resize(compressedSize);
@@ -90,6 +251,8 @@ bool LogPlayer::open(const std::string& fileName)
           uncompressBuffer.resize(uncompressedSize);
           if(snappy_uncompress(&compressedBuffer[0], compressedSize, &uncompressBuffer[0], &uncompressedSize) != SNAPPY_OK)
             break;
+          if(deltaEncoded)
+            DeltaCoding::decode(&uncompressBuffer[0], uncompressedSize);
           InBinaryMemory mem(&uncompressBuffer[0], uncompressedSize);
           mem >> *this;
         }
@@ -99,7 +262,6 @@ bool LogPlayer::open(const std::string& fileName)
     }
 
     stop();
-    countFrames();
     createIndices();
     logfileLoaded = true;
     return true;
@@ -128,7 +290,7 @@ void LogPlayer::stop()
 
 void LogPlayer::pause()
 {
-  if(getNumberOfMessages() == 0)
+  if(getNumberOfMessages() == 0 && !mappedData)
     state = initial;
   else
     state = paused;
@@ -145,10 +307,13 @@ void LogPlayer::stepBackward()
       currentFrameNumber = numberOfFrames - 1;
     else
       return;
-    ASSERT(currentFrameNumber < static_cast<int>(frameIndex.size()));
-    currentMessageNumber = frameIndex[currentFrameNumber];
+    if(!mappedData) // The messages of a mapped log file are not in the queue
+    {
+      ASSERT(currentFrameNumber < static_cast<int>(frameIndex.size()));
+      currentMessageNumber = frameIndex[currentFrameNumber];
 
-    queue.setSelectedMessageForReading(currentMessageNumber);
+      queue.setSelectedMessageForReading(currentMessageNumber);
+    }
     stepRepeat();
   }
 }
@@ -156,7 +321,16 @@ void LogPlayer::stepBackward()
 void LogPlayer::stepImageBackward()
 {
   pause();
-  if(state == paused && (currentFrameNumber > 0 || (loop && numberOfFrames > 0)))
+  if(state == paused && !imageFrameIndex.empty())
+  {
+    // The index knows all frames with images, so jump directly to the previous one.
+    auto previous = std::lower_bound(imageFrameIndex.begin(), imageFrameIndex.end(), currentFrameNumber);
+    if(previous != imageFrameIndex.begin())
+      gotoFrame(*--previous);
+    else if(loop && imageFrameIndex.back() < numberOfFrames)
+      gotoFrame(imageFrameIndex.back());
+  }
+  else if(state == paused && (currentFrameNumber > 0 || (loop && numberOfFrames > 0)))
   {
     int lastImageFrameNumber = this->lastImageFrameNumber;
     int thisFrameNumber = currentFrameNumber;
@@ -173,7 +347,7 @@ void LogPlayer::stepForward()
   pause();
   if(state == paused)
   {
-    if(currentFrameNumber >= numberOfFrames - 1 || currentMessageNumber >= numberOfMessagesWithinCompleteFrames - 1)
+    if(currentFrameNumber >= numberOfFrames - 1 || (!mappedData && currentMessageNumber >= numberOfMessagesWithinCompleteFrames - 1))
     {
       if(loop && numberOfFrames > 0)
       {
@@ -184,27 +358,23 @@ void LogPlayer::stepForward()
         return;
     }
     replayStreamSpecification();
-
-    do
-    {
-      copyMessage(++currentMessageNumber, targetQueue);
-      if(queue.getMessageID() == idImage
-         || queue.getMessageID() == idJPEGImage
-         || queue.getMessageID() == idThumbnail
-         || queue.getMessageID() == idImagePatches
-         || (queue.getMessageID() == idLowFrameRateImage && queue.getMessageSize() > 1000))
-        lastImageFrameNumber = currentFrameNumber + 1;
-    }
-    while(queue.getMessageID() != idProcessFinished);
-
-    ++currentFrameNumber;
+    replayFrame();
   }
 }
 
 void LogPlayer::stepImageForward()
 {
   pause();
-  if(state == paused && (currentFrameNumber < numberOfFrames - 1 || (loop && numberOfFrames > 0)))
+  if(state == paused && !imageFrameIndex.empty())
+  {
+    // The index knows all frames with images, so jump directly to the next one.
+    auto next = std::upper_bound(imageFrameIndex.begin(), imageFrameIndex.end(), currentFrameNumber);
+    if(next == imageFrameIndex.end() && loop)
+      next = imageFrameIndex.begin();
+    if(next != imageFrameIndex.end() && *next < numberOfFrames)
+      gotoFrame(*next);
+  }
+  else if(state == paused && (currentFrameNumber < numberOfFrames - 1 || (loop && numberOfFrames > 0)))
   {
     int lastImageFrameNumber = this->lastImageFrameNumber;
     int thisFrameNumber = currentFrameNumber;
@@ -222,7 +392,7 @@ void LogPlayer::stepRepeat()
   if(state == paused && currentFrameNumber >= 0)
   {
     --currentFrameNumber;
-    currentMessageNumber = currentFrameNumber >= 0 ? frameIndex[currentFrameNumber] - 1 : -1;
+    currentMessageNumber = currentFrameNumber >= 0 ? getFrameStart(currentFrameNumber) - 1 : -1;
     stepForward();
   }
 }
@@ -234,18 +404,21 @@ void LogPlayer::gotoFrame(int frame)
   if(state == paused && frame < numberOfFrames)
   {
     currentFrameNumber = frame - 1;
-    currentMessageNumber = currentFrameNumber >= 0 ? frameIndex[currentFrameNumber] - 1 : -1;
+    currentMessageNumber = currentFrameNumber >= 0 ? getFrameStart(currentFrameNumber) - 1 : -1;
     stepForward();
   }
 }
 
 int LogPlayer::getFrameForRemainingGCTime(int time)
 {
+  if(mappedData && !gcTimesIndexed)
+    indexGCTimes();
   return time < 0 || time >= static_cast<int>(gcTimeIndex.size()) ? -1 : gcTimeIndex[time];
 }
 
 bool LogPlayer::save(const std::string& fileName, const StreamHandler* streamHandler)
 {
+  loadAllBlocks();
   if(state == recording)
     recordStop();
 
@@ -271,6 +444,7 @@ bool LogPlayer::save(const std::string& fileName, const StreamHandler* streamHan
 
 bool LogPlayer::saveImages(const bool raw, const std::string& fileName)
 {
+  loadAllBlocks();
   int i = 0;
   Image image;
   for(currentMessageNumber = 0; currentMessageNumber < getNumberOfMessages(); currentMessageNumber++)
@@ -308,6 +482,7 @@ bool LogPlayer::saveImages(const bool raw, const std::string& fileName)
 
 bool LogPlayer::saveInertialSensorData()
 {
+  loadAllBlocks();
   InertialSensorData data;
   FrameInfo frame;
   std::ofstream file;
@@ -350,6 +525,7 @@ bool LogPlayer::saveInertialSensorData()
 
 bool LogPlayer::saveJointAngleData()
 {
+  loadAllBlocks();
   JointAngles angles;
   JointRequest request;
   FrameInfo frame;
@@ -398,6 +574,7 @@ bool LogPlayer::saveJointAngleData()
 
 bool LogPlayer::saveBallSpotImages(const std::string& fileName)
 {
+  loadAllBlocks();
   int i = 0;
 
   LowFrameRateImage lfrImage;
@@ -535,6 +712,7 @@ bool LogPlayer::saveBallSpotImages(const std::string& fileName)
 
 void LogPlayer::recordStart()
 {
+  loadAllBlocks();
   state = recording;
 }
 
@@ -572,20 +750,7 @@ bool LogPlayer::replay()
     if(currentFrameNumber < numberOfFrames - 1)
     {
       replayStreamSpecification();
-
-      do
-      {
-        copyMessage(++currentMessageNumber, targetQueue);
-        if(queue.getMessageID() == idImage
-           || queue.getMessageID() == idJPEGImage
-           || queue.getMessageID() == idThumbnail
-           || queue.getMessageID() == idImagePatches
-           || (queue.getMessageID() == idLowFrameRateImage && queue.getMessageSize() > 1000))
-          lastImageFrameNumber = currentFrameNumber + 1;
-      }
-      while(queue.getMessageID() != idProcessFinished && currentMessageNumber < numberOfMessagesWithinCompleteFrames - 1);
-
-      ++currentFrameNumber;
+      replayFrame();
       if(currentFrameNumber == numberOfFrames - 1)
       {
         if(loop)  //restart in loop mode
@@ -614,6 +779,7 @@ bool LogPlayer::replay()
 
 void LogPlayer::keep(const std::function<bool(InMessage&)>& filter)
 {
+  loadAllBlocks();
   stop();
   LogPlayer temp((MessageQueue&)*this);
   temp.setSize(queue.getSize());
@@ -626,13 +792,16 @@ void LogPlayer::keep(const std::function<bool(InMessage&)>& filter)
     if(filter(temp.in))
       temp.copyMessage(temp.currentMessageNumber, *this);
   }
-  countFrames();
-  if(!frameIndex.empty())
+  logFileIndex = nullptr; // Frame numbers have changed
+  if(frameIndex.empty())
+    countFrames();
+  else
     createIndices();
 }
 
 void LogPlayer::keepFrames(const std::function<bool(InMessage&)>& filter)
 {
+  loadAllBlocks();
   stop();
   LogPlayer temp((MessageQueue&)*this);
   temp.setSize(queue.getSize());
@@ -659,13 +828,53 @@ void LogPlayer::keepFrames(const std::function<bool(InMessage&)>& filter)
       keepFrame = false;
     }
   }
-  countFrames();
-  if(!frameIndex.empty())
+  logFileIndex = nullptr; // Frame numbers have changed
+  if(frameIndex.empty())
+    countFrames();
+  else
     createIndices();
 }
 
+bool LogPlayer::keepFrames(const std::vector<Condition>& conditions, StreamHandler& defaultStreamHandler)
+{
+  StreamHandler& specification = streamHandler ? *streamHandler : defaultStreamHandler;
+  for(const Condition& condition : conditions)
+    if(specification.specification.find(specification.getString(::getName(condition.id) + 2)) == specification.specification.end())
+      return false;
+
+  std::vector<bool> satisfied(conditions.size(), false);
+  keepFrames([&](InMessage& message) -> bool
+  {
+    const MessageID id = message.getMessageID();
+    if(id == idProcessBegin)
+      satisfied.assign(conditions.size(), false);
+    else if(id == idProcessFinished)
+      return std::find(satisfied.begin(), satisfied.end(), false) == satisfied.end();
+    else if(std::find_if(conditions.begin(), conditions.end(), [id](const Condition& c) {return c.id == id;}) != conditions.end())
+    {
+      OutRow outRow(::getName(id) + 2);
+      DebugDataStreamer streamer(specification, message.bin, ::getName(id) + 2);
+      outRow << streamer;
+      for(size_t i = 0; i < conditions.size(); ++i)
+        if(conditions[i].id == id)
+        {
+          satisfied[i] = false;
+          for(const auto& value : outRow.row)
+            if(value.first == conditions[i].column)
+            {
+              satisfied[i] = compare(value.second, conditions[i].op, conditions[i].value);
+              break;
+            }
+        }
+    }
+    return false;
+  });
+  return true;
+}
+
 void LogPlayer::keep(const std::vector<int>& messageNumbers)
 {
+  loadAllBlocks();
   stop();
   LogPlayer temp((MessageQueue&)*this);
   temp.setSize(queue.getSize());
@@ -676,13 +885,16 @@ void LogPlayer::keep(const std::vector<int>& messageNumbers)
     temp.queue.setSelectedMessageForReading(messageNumber);
     temp.copyMessage(messageNumber, *this);
   }
-  countFrames();
-  if(!frameIndex.empty())
+  logFileIndex = nullptr; // Frame numbers have changed
+  if(frameIndex.empty())
+    countFrames();
+  else
     createIndices();
 }
 
 void LogPlayer::statistics(int frequencies[numOfDataMessageIDs], unsigned* sizes, char processIdentifier)
 {
+  loadAllBlocks();
   FOREACH_ENUM(MessageID, id, numOfDataMessageIDs)
     frequencies[id] = 0;
   if(sizes)
@@ -718,9 +930,9 @@ void LogPlayer::createIndices()
 
   queue.createIndex();
   frameIndex.clear();
-  frameIndex.reserve(numberOfFrames);
+  imageFrameIndex.clear();
   gcTimeIndex.fill(-1);
-  int frame = 0;
+  numberOfFrames = 0;
   for(int i = 0; i < getNumberOfMessages(); ++i)
   {
     queue.setSelectedMessageForReading(i);
@@ -733,11 +945,16 @@ void LogPlayer::createIndices()
       const int time = gameInfo.secsRemaining;
       if(time >= 0 && time < static_cast<int>(gcTimeIndex.size()) && gcTimeIndex[time] == -1)
       {
-        gcTimeIndex[time] = frame;
+        gcTimeIndex[time] = numberOfFrames;
       }
     }
     else if(id == idProcessFinished)
-      ++frame;
+    {
+      ++numberOfFrames;
+      numberOfMessagesWithinCompleteFrames = i + 1;
+    }
+    else if(isImageMessage(id, queue.getMessageSize()) && (imageFrameIndex.empty() || imageFrameIndex.back() != numberOfFrames))
+      imageFrameIndex.push_back(numberOfFrames);
   }
 }
 
@@ -827,6 +1044,7 @@ bool LogPlayer::saveImage(const Image& image, const std::string& fileName, int i
 
 bool LogPlayer::writeTimingData(const std::string& fileName)
 {
+  loadAllBlocks();
   stop();
 
   std::map<unsigned short, std::string> names;/**<contains a mapping from watch id to watch name */
@@ -920,8 +1138,77 @@ bool LogPlayer::writeTimingData(const std::string& fileName)
   return true;
 }
 
+bool LogPlayer::saveCSV(const std::string& fileName, const std::vector<MessageID>& messageIDs, StreamHandler& defaultStreamHandler)
+{
+  loadAllBlocks();
+  stop();
+
+  // Only representations the specification knows can be flattened.
+  StreamHandler& specification = streamHandler ? *streamHandler : defaultStreamHandler;
+  for(MessageID id : messageIDs)
+    if(specification.specification.find(specification.getString(::getName(id) + 2)) == specification.specification.end())
+      return false;
+
+  // Collect the values of all frames first, because the columns are only known afterwards.
+  std::vector<std::string> columns = {"Frame"};
+  std::unordered_map<std::string, size_t> columnIndices;
+  std::vector<std::vector<std::string>> rows;
+  std::vector<std::string> row;
+  int frame = 0;
+  for(int i = 0; i < getNumberOfMessages(); ++i)
+  {
+    queue.setSelectedMessageForReading(i);
+    const MessageID id = queue.getMessageID();
+    if(id == idProcessFinished)
+    {
+      if(!row.empty())
+      {
+        row[0] = std::to_string(frame);
+        rows.emplace_back(std::move(row));
+        row.clear();
+      }
+      ++frame;
+    }
+    else if(std::find(messageIDs.begin(), messageIDs.end(), id) != messageIDs.end())
+    {
+      OutRow outRow(::getName(id) + 2);
+      DebugDataStreamer streamer(specification, in.bin, ::getName(id) + 2);
+      outRow << streamer;
+      for(const auto& value : outRow.row)
+      {
+        auto column = columnIndices.find(value.first);
+        if(column == columnIndices.end())
+        {
+          column = columnIndices.emplace(value.first, columns.size()).first;
+          columns.push_back(value.first);
+        }
+        if(row.size() <= column->second)
+          row.resize(column->second + 1);
+        row[column->second] = value.second;
+      }
+    }
+  }
+
+  OutTextRawFile file(fileName);
+  if(!file.exists())
+    return false;
+
+  const std::string sep(",");
+  for(size_t i = 0; i < columns.size(); ++i)
+    file << (i ? sep : std::string()) << columns[i];
+  file << endl;
+  for(const std::vector<std::string>& values : rows)
+  {
+    for(size_t i = 0; i < columns.size(); ++i)
+      file << (i ? sep : std::string()) << (i < values.size() ? values[i] : std::string());
+    file << endl;
+  }
+  return true;
+}
+
 bool LogPlayer::saveAudioFile(const std::string& fileName)
 {
+  loadAllBlocks();
   OutBinaryFile stream(fileName);
   if(!stream.exists())
     return false;
@@ -1005,13 +1292,13 @@ void LogPlayer::replayStreamSpecification()
 
 void LogPlayer::merge()
 {
+  loadAllBlocks();
   stop();
 
   //copy the currently loaded logfile
   LogPlayer logCopy((MessageQueue&)*this);
   logCopy.setSize(queue.getSize());
   moveAllMessages(logCopy);
-  logCopy.countFrames();
   logCopy.createIndices();
 
   //parse filename and find the corresponding other logfile
@@ -1138,9 +1425,229 @@ void LogPlayer::merge()
       ++cognitionItr;
     }
   }
-  countFrames();
+  logFileIndex = nullptr; // Frame numbers have changed
   createIndices();
 
   targetQueue.out.bin << *streamHandler;
   targetQueue.out.finishMessage(idStreamSpecification);
 }
+
+bool LogPlayer::map(InBinaryFile& file)
+{
+  mappedFile = std::unique_ptr<QFile>(new QFile(file.getFullName().c_str()));
+  if(!mappedFile->open(QIODevice::ReadOnly))
+  {
+    mappedFile = nullptr;
+    return false;
+  }
+  const size_t fileSize = static_cast<size_t>(mappedFile->size());
+  mappedData = reinterpret_cast<const char*>(mappedFile->map(0, mappedFile->size()));
+  unsigned indexSize = 0;
+  if(mappedData && fileSize >= 2 * sizeof(unsigned))
+    indexSize = *reinterpret_cast<const unsigned*>(mappedData + fileSize - sizeof(unsigned));
+  if(mappedData && indexSize + 2 * sizeof(unsigned) <= fileSize
+     && *reinterpret_cast<const unsigned*>(mappedData + fileSize - 2 * sizeof(unsigned) - indexSize) == 0) // Not a truncated log file?
+  {
+    logFileIndex = std::unique_ptr<LogFileIndex>(new LogFileIndex);
+    InBinaryMemory stream(mappedData + fileSize - sizeof(unsigned) - indexSize, indexSize);
+    stream >> *logFileIndex;
+  }
+
+  // The blocks end where the terminating 0 before the index begins.
+  size_t blocksSize = 0;
+  if(logFileIndex)
+    for(const LogFileIndex::Block& block : logFileIndex->blocks)
+      blocksSize += block.size + sizeof(unsigned);
+  if(logFileIndex && blocksSize + indexSize + 2 * sizeof(unsigned) <= fileSize)
+  {
+    size_t offset = fileSize - 2 * sizeof(unsigned) - indexSize - blocksSize;
+    for(const LogFileIndex::Block& block : logFileIndex->blocks)
+    {
+      blockOffsets.push_back(offset + sizeof(unsigned));
+      offset += block.size + sizeof(unsigned);
+    }
+
+    if(queue.mappedIDs)
+    {
+      OutBinarySize size;
+      writeMessageIDs(size);
+      messageIDMapping.resize(size.getSize());
+      OutBinaryMemory mappingStream(messageIDMapping.data());
+      writeMessageIDs(mappingStream);
+    }
+    return true;
+  }
+
+  logFileIndex = nullptr;
+  mappedData = nullptr;
+  mappedFile = nullptr;
+  return false;
+}
+
+bool LogPlayer::decompressBlock(size_t block, MessageQueue& target) const
+{
+  const char* compressedData = mappedData + blockOffsets[block];
+  const size_t compressedSize = logFileIndex->blocks[block].size;
+  size_t uncompressedSize = 0;
+  if(snappy_uncompressed_length(compressedData, compressedSize, &uncompressedSize) != SNAPPY_OK)
+    return false;
+  std::vector<char> uncompressBuffer(uncompressedSize);
+  if(snappy_uncompress(compressedData, compressedSize, uncompressBuffer.data(), &uncompressedSize) != SNAPPY_OK)
+    return false;
+  if(deltaEncoded)
+    DeltaCoding::decode(uncompressBuffer.data(), uncompressedSize);
+  InBinaryMemory mem(uncompressBuffer.data(), uncompressedSize);
+  mem >> target;
+  return true;
+}
+
+LogPlayer::CachedBlock& LogPlayer::getBlock(int block)
+{
+  for(auto i = blockCache.begin(); i != blockCache.end(); ++i)
+    if(i->block == block)
+    {
+      blockCache.splice(blockCache.begin(), blockCache, i);
+      return blockCache.front();
+    }
+
+  if(blockCache.size() >= blockCacheSize)
+    blockCache.pop_back();
+  blockCache.emplace_front(block);
+  CachedBlock& cachedBlock = blockCache.front();
+  cachedBlock.setSize(queue.getSize());
+  if(!messageIDMapping.empty())
+  {
+    InBinaryMemory stream(messageIDMapping.data(), messageIDMapping.size());
+    cachedBlock.readMessageIDMapping(stream);
+  }
+  VERIFY(decompressBlock(block, cachedBlock));
+  cachedBlock.createIndex();
+  for(int i = 0; i < cachedBlock.getNumberOfMessages(); ++i)
+  {
+    cachedBlock.select(i);
+    if(cachedBlock.getMessageID() == idProcessBegin)
+      cachedBlock.frameIndex.push_back(i);
+  }
+  return cachedBlock;
+}
+
+MessageID LogPlayer::replayMessage(int message, CachedBlock* cachedBlock)
+{
+  MessageID id;
+  int size;
+  if(cachedBlock)
+  {
+    cachedBlock->copyMessage(message, targetQueue);
+    id = cachedBlock->getMessageID();
+    size = cachedBlock->getMessageSize();
+  }
+  else
+  {
+    copyMessage(message, targetQueue);
+    id = queue.getMessageID();
+    size = queue.getMessageSize();
+  }
+
+  if(isImageMessage(id, size))
+    lastImageFrameNumber = currentFrameNumber + 1;
+  return id;
+}
+
+void LogPlayer::replayFrame()
+{
+  if(mappedData)
+  {
+    // Blocks only contain complete frames, so the frame is replayed from the block that contains it.
+    const int frame = ++currentMessageNumber;
+    const int block = logFileIndex->getBlock(frame);
+    ASSERT(block >= 0);
+    if(block >= 0)
+    {
+      CachedBlock& cachedBlock = getBlock(block);
+      const int frameInBlock = frame - static_cast<int>(logFileIndex->blocks[block].firstFrame);
+      if(frameInBlock < static_cast<int>(cachedBlock.frameIndex.size()))
+        for(int message = cachedBlock.frameIndex[frameInBlock];
+            message < cachedBlock.getNumberOfMessages() && replayMessage(message, &cachedBlock) != idProcessFinished;
+            ++message);
+    }
+  }
+  else
+    while(replayMessage(++currentMessageNumber) != idProcessFinished
+          && currentMessageNumber < numberOfMessagesWithinCompleteFrames - 1);
+
+  ++currentFrameNumber;
+}
+
+bool LogPlayer::isImageMessage(MessageID id, int size)
+{
+  return id == idImage
+         || id == idJPEGImage
+         || id == idThumbnail
+         || id == idImagePatches
+         || (id == idLowFrameRateImage && size > 1000);
+}
+
+void LogPlayer::indexBlocks()
+{
+  frameIndex.clear();
+  imageFrameIndex.assign(logFileIndex->imageFrames.begin(), logFileIndex->imageFrames.end());
+  gcTimeIndex.fill(-1);
+  gcTimesIndexed = false;
+  numberOfFrames = logFileIndex->blocks.empty() ? 0 : static_cast<int>(logFileIndex->blocks.back().firstFrame + logFileIndex->blocks.back().numOfFrames);
+  numberOfMessagesWithinCompleteFrames = 0;
+}
+
+void LogPlayer::indexGCTimes()
+{
+  GameInfo gameInfo;
+  OutBinarySize gameInfoSize;
+  gameInfoSize << gameInfo;
+
+  gcTimeIndex.fill(-1);
+  for(size_t block = 0; block < blockOffsets.size(); ++block)
+  {
+    CachedBlock& messages = getBlock(static_cast<int>(block));
+    int frame = static_cast<int>(logFileIndex->blocks[block].firstFrame);
+    for(int i = 0; i < messages.getNumberOfMessages(); ++i)
+    {
+      messages.select(i);
+      const MessageID id = messages.getMessageID();
+      if(id == idGameInfo && messages.getMessageSize() == static_cast<int>(gameInfoSize.getSize()))
+      {
+        messages.in.bin >> gameInfo;
+        const int time = gameInfo.secsRemaining;
+        if(time >= 0 && time < static_cast<int>(gcTimeIndex.size()) && gcTimeIndex[time] == -1)
+          gcTimeIndex[time] = frame;
+      }
+      else if(id == idProcessFinished)
+        ++frame;
+    }
+  }
+  gcTimesIndexed = true;
+}
+
+void LogPlayer::loadAllBlocks()
+{
+  if(mappedData)
+  {
+    const int currentFrameNumber = this->currentFrameNumber;
+    const int lastReplayedFrame = currentMessageNumber;
+    blockCache.clear();
+    for(size_t block = 0; block < blockOffsets.size(); ++block)
+      VERIFY(decompressBlock(block, *this));
+    blockOffsets.clear();
+    messageIDMapping.clear();
+    mappedData = nullptr;
+    mappedFile = nullptr;
+    createIndices();
+    this->currentFrameNumber = currentFrameNumber;
+
+    // Continue after the last message of the frame replayed last.
+    if(lastReplayedFrame < 0)
+      currentMessageNumber = -1;
+    else if(lastReplayedFrame + 1 < static_cast<int>(frameIndex.size()))
+      currentMessageNumber = frameIndex[lastReplayedFrame + 1] - 1;
+    else
+      currentMessageNumber = numberOfMessagesWithinCompleteFrames - 1;
+  }
+}
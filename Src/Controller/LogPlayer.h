@@ -13,16 +13,23 @@
 #include "Representations/Infrastructure/JointRequest.h"
 #include "Representations/Infrastructure/Image.h"
 #include "Representations/Infrastructure/JPEGImage.h"
+#include "Tools/Logging/LogFileIndex.h"
 #include "Tools/MessageQueue/MessageQueue.h"
 #include "Tools/Streams/StreamHandler.h"
 
+#include <list>
 #include <memory>
 
+class QFile;
+
 /**
  * @class LogPlayer
  *
  * A message queue that can record and play logfiles.
  * The messages are played in the same time sequence as they were recorded.
+ * Indexed log files can also be opened with a block cache. In that case, the
+ * file is mapped into memory and only the blocks currently replayed are kept
+ * decompressed. Operations that process the whole log load it completely first.
  *
  * @author Martin Lötzsch
  */
@@ -44,15 +51,58 @@ public:
   bool streamSpecificationReplayed; /**< The stream specification has to be replayed once. Already done? */
   int lastImageFrameNumber; /**< The number of the last frame that contained an image. */
 
+  /** A condition on a value of a representation, e.g. "BallPercept.status == seen". */
+  struct Condition
+  {
+    MessageID id; /**< The representation the value belongs to. */
+    std::string column; /**< The path of the value as used by saveCSV, e.g. "RobotPose.validity". */
+    std::string op; /**< The comparison: ==, !=, <, <=, >, or >=. */
+    std::string value; /**< The value compared with. Numbers are compared numerically. */
+  };
+
 private:
+  /** A decompressed block of a log file that is mapped into memory. */
+  class CachedBlock : public MessageQueue
+  {
+  public:
+    int block; /**< The number of the block. */
+    std::vector<int> frameIndex; /**< The numbers of the messages the frames of this block start at. */
+
+    CachedBlock(int block) : block(block) {}
+
+    using MessageQueue::copyMessage;
+
+    /** Select a message for reading through "in". */
+    void select(int message) {queue.setSelectedMessageForReading(message);}
+
+    /** Create an index for fast random access to messages. */
+    void createIndex() {queue.createIndex();}
+
+    /** The id of the message selected last. */
+    MessageID getMessageID() const {return queue.getMessageID();}
+
+    /** The size of the message selected last. */
+    int getMessageSize() const {return queue.getMessageSize();}
+  };
+
   MessageQueue& targetQueue; /**< The queue into that messages from played logfiles shall be stored. */
-  int currentMessageNumber; /**< The current message number in the message queue. */
+  int currentMessageNumber; /**< The current message number in the message queue. If the log file is mapped, the number of the frame replayed last instead. */
   int numberOfMessagesWithinCompleteFrames; /**< The number of messages within complete frames. Messages behind that number will be skipped. */
   bool loop;
   int replayOffset;
   std::vector<int> frameIndex; /**< The message numbers the frames start at. */
+  std::vector<int> imageFrameIndex; /**< The numbers of all frames that contain an image, in ascending order. */
   std::array<int, 601> gcTimeIndex; /**< The frames correspending to Game Controller times. */
   std::unique_ptr<StreamHandler> streamHandler; /**< The stream specification of the log file entries. */
+  std::unique_ptr<LogFileIndex> logFileIndex; /**< The index of the log file if it contained one. */
+  std::unique_ptr<QFile> mappedFile; /**< The log file if it is mapped into memory instead of being loaded. */
+  const char* mappedData = nullptr; /**< The contents of the mapped log file. */
+  std::vector<size_t> blockOffsets; /**< The offsets of all compressed blocks in the mapped log file. */
+  std::vector<char> messageIDMapping; /**< The message id table of the mapped log file. */
+  std::list<CachedBlock> blockCache; /**< The blocks decompressed recently. The most recent one is first. */
+  size_t blockCacheSize = 0; /**< The maximum number of blocks decompressed at the same time. */
+  bool deltaEncoded = false; /**< Were the blocks of the log file delta encoded before compressing them? */
+  bool gcTimesIndexed = false; /**< Was the Game Controller time index of the mapped log file already created? */
 
   bool logfileLoaded = false;
   std::string logfilePath;
@@ -63,15 +113,21 @@ public:
    */
   LogPlayer(MessageQueue& targetQueue);
 
+  /** Destructor. Unmaps the log file if it is mapped. */
+  ~LogPlayer();
+
   /** Deletes all messages from the queue */
   void init();
 
   /**
    * Opens a log file and reads all messages into the queue.
    * @param fileName the name of the file to open
+   * @param blockCacheSize If not 0 and the log file contains an index, the
+   *                       file is mapped into memory and at most this number
+   *                       of blocks is decompressed at the same time.
    * @return if the reading was successful
    */
-  bool open(const std::string& fileName);
+  bool open(const std::string& fileName, size_t blockCacheSize = 0);
 
   bool isLogfileLoaded() { return logfileLoaded; }
   std::string getLogfilePath() { return logfilePath; }
@@ -174,6 +230,17 @@ public:
    */
   bool writeTimingData(const std::string& fileName);
 
+  /**
+   * Writes the given representations as a csv table with one row per frame
+   * and one column per streamed value, e.g. "RobotPose.translation.x".
+   * The columns are derived from the stream specification of the log.
+   * @param fileName The name of the file to write.
+   * @param messageIDs The ids of the representations to write.
+   * @param defaultStreamHandler The specification used if the log does not contain one.
+   * @return Whether writing the file was successful.
+   */
+  bool saveCSV(const std::string& fileName, const std::vector<MessageID>& messageIDs, StreamHandler& defaultStreamHandler);
+
   /**
    * Save an image to a file.
    * @param image The image to save.
@@ -212,6 +279,16 @@ public:
    */
   void keepFrames(const std::function<bool(InMessage&)>& filter);
 
+  /**
+   * The function keeps only the frames in which all conditions hold.
+   * Only the representations referenced by the conditions are decoded.
+   * @param conditions The conditions. A frame that lacks one of the
+   *                   representations referenced does not match.
+   * @param defaultStreamHandler The specification used if the log does not contain one.
+   * @return Were all representations referenced known to the specification?
+   */
+  bool keepFrames(const std::vector<Condition>& conditions, StreamHandler& defaultStreamHandler);
+
   /**
    * The function filters the message queue by message numbers.
    * @param savedMessages Vector of message numbers that should be kept.
@@ -230,14 +307,85 @@ public:
   void merge();
 
 private:
+  /**
+   * Opens the log file that was already read up to its first compressed block
+   * by mapping it into memory. Requires the index at the end of the file.
+   * @param file The log file.
+   * @return Was the index found?
+   */
+  bool map(InBinaryFile& file);
+
+  /**
+   * Decompresses a block of the mapped log file.
+   * @param block The number of the block.
+   * @param target The queue the messages of the block are appended to.
+   * @return Was the block decompressed successfully?
+   */
+  bool decompressBlock(size_t block, MessageQueue& target) const;
+
+  /**
+   * Returns a block of the mapped log file, decompressing it if it was not
+   * cached. If the cache is full, the block used least recently is removed.
+   * @param block The number of the block.
+   * @return The decompressed block.
+   */
+  CachedBlock& getBlock(int block);
+
+  /**
+   * Copies a message to the target queue. Also notes whether it is an image.
+   * @param message The number of the message.
+   * @param cachedBlock The block of the mapped log file the message is taken
+   *                    from. If nullptr, it is taken from the queue.
+   * @return The id of the message.
+   */
+  MessageID replayMessage(int message, CachedBlock* cachedBlock = nullptr);
+
+  /** Copies the messages of the frame after the current one to the target queue. */
+  void replayFrame();
+
+  /**
+   * Returns the position at which a frame starts.
+   * @param frame The number of the frame.
+   * @return The number of its first message or the frame number itself if the log file is mapped.
+   */
+  int getFrameStart(int frame) const {return mappedData ? frame : frameIndex[frame];}
+
+  /**
+   * Checks whether a message contains an image.
+   * @param id The id of the message.
+   * @param size The size of the message in bytes.
+   * @return Is it an image message?
+   */
+  static bool isImageMessage(MessageID id, int size);
+
+  /**
+   * Determines the number of frames and the image frame index of a mapped
+   * log file from its index. No block is decompressed, which happens when it
+   * is replayed for the first time.
+   */
+  void indexBlocks();
+
+  /**
+   * Creates the Game Controller time index of a mapped log file. This
+   * decompresses all blocks once, so it is only done when it is needed.
+   */
+  void indexGCTimes();
+
+  /**
+   * Loads all blocks of a mapped log file into the queue and unmaps the file.
+   * Does nothing if the log file is not mapped.
+   */
+  void loadAllBlocks();
+
   /**
    * The method counts the number of frames.
    */
   void countFrames();
 
   /**
-   * Creates the index of the first message numbers of all frames as well as the
-   * index of frames corresponding to Game Controller times.
+   * Creates the index of the first message numbers of all frames, the index of the
+   * frames containing images, and the index of frames corresponding to Game Controller times. The frames are
+   * counted in the same pass, so countFrames() is not needed in addition.
    */
   void createIndices();
 
@@ -10,7 +10,10 @@
 #include "Tools/MessageQueue/InMessage.h"
 #include "Platform/Time.h"
 #include "Platform/BHAssert.h"
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <vector>
 
 TimeInfo::TimeInfo(const std::string& name, int frameNoDivisor) : processName(name), frameNoDivisor(frameNoDivisor)
 {
@@ -20,6 +23,7 @@ TimeInfo::TimeInfo(const std::string& name, int frameNoDivisor) : processName(na
 void TimeInfo::reset()
 {
   infos.clear();
+  totals.clear();
   lastFrameNo = 0;
   lastStartTime = 0;
 }
@@ -44,6 +48,7 @@ bool TimeInfo::handleMessage(InMessage& message, bool justReadNames)
       {
         names[watchId] = watchName;
         infos[watchId] = Info();
+        totals[watchId] = Total();
       }
     }
 
@@ -58,7 +63,10 @@ bool TimeInfo::handleMessage(InMessage& message, bool justReadNames)
       message.bin >> watchId;
       message.bin >> time;
       if(!justReadNames)
+      {
         infos[watchId].push_front(static_cast<float>(time));
+        totals[watchId].add(time);
+      }
       infos[watchId].timeStamp = Time::getCurrentSystemTime();
     }
 
@@ -88,6 +96,28 @@ bool TimeInfo::handleMessage(InMessage& message, bool justReadNames)
     return false;
 }
 
+void TimeInfo::Total::add(unsigned time)
+{
+  sum += time;
+  max = std::max(max, time);
+  ++count;
+  const size_t bucket = static_cast<size_t>(4.f * std::log2(static_cast<float>(time) + 1.f));
+  ++histogram[std::min(bucket, histogram.size() - 1)];
+}
+
+unsigned TimeInfo::Total::percentile(float ratio) const
+{
+  const unsigned rank = static_cast<unsigned>(std::ceil(ratio * static_cast<float>(count)));
+  unsigned counted = 0;
+  for(size_t bucket = 0; bucket < histogram.size(); ++bucket)
+  {
+    counted += histogram[bucket];
+    if(counted >= rank && counted > 0)
+      return std::min(max, static_cast<unsigned>(std::exp2(static_cast<float>(bucket + 1) / 4.f)));
+  }
+  return max;
+}
+
 void TimeInfo::getStatistics(const Info& info, float& minTime, float& maxTime, float& avgTime) const
 {
   avgTime = info.average() / 1000.0f;
@@ -95,6 +125,16 @@ void TimeInfo::getStatistics(const Info& info, float& minTime, float& maxTime, f
   maxTime = info.maximum() / 1000.0f;
 }
 
+float TimeInfo::getPercentile(const Info& info, float ratio) const
+{
+  if(info.empty())
+    return 0.f;
+  std::vector<float> times(info.begin(), info.end());
+  const auto percentile = times.begin() + std::min(static_cast<size_t>(ratio * static_cast<float>(times.size())), times.size() - 1);
+  std::nth_element(times.begin(), percentile, times.end());
+  return *percentile / 1000.0f;
+}
+
 void TimeInfo::getProcessStatistics(float& outAvgFreq, float& outMin, float& outMax) const
 {
   outAvgFreq = processDeltas.sum() != 0.f ? 1000.0f / processDeltas.average() : 0.f;
@@ -10,6 +10,7 @@
 
 #include "Tools/RingBufferWithSum.h"
 
+#include <array>
 #include <string>
 #include <unordered_map>
 
@@ -37,8 +38,31 @@ public:
   using Info = InfoWithTimeStamp;
   using Infos = std::unordered_map<unsigned short, Info>;
 
+  /** Statistics about a stop watch since the last reset. */
+  struct Total
+  {
+    double sum = 0.; /**< The sum of all measurements in µs. */
+    unsigned max = 0; /**< The longest measurement in µs. */
+    unsigned count = 0; /**< The number of measurements. */
+    std::array<unsigned, 128> histogram; /**< Number of measurements per quarter octave of their duration in µs. */
+
+    Total() { histogram.fill(0); }
+
+    /** Adds a measurement in µs. */
+    void add(unsigned time);
+
+    /**
+     * Returns an upper bound of a percentile of all measurements.
+     * @param ratio The ratio of measurements that are not longer than the result, e.g. 0.99f.
+     * @return The percentile in µs. It is at most 19% too high.
+     */
+    unsigned percentile(float ratio) const;
+  };
+  using Totals = std::unordered_map<unsigned short, Total>;
+
   std::string processName;
   Infos infos;
+  Totals totals; /**< Statistics about all measurements since the last reset, e.g. for a whole log file. */
   unsigned int timeStamp; /**< The time stamp of the last change. */
 
 private:
@@ -80,6 +104,15 @@ public:
    */
   void getStatistics(const Info& info, float& outMinTime, float& outMaxTime, float& outAvgTime) const;
 
+  /**
+   * The function returns a percentile of the recent measurements of a stop watch.
+   * In contrast to the average, it reveals how long the slow frames take.
+   * @param info Information on the stop watch to query.
+   * @param ratio The ratio of measurements that are not longer than the result, e.g. 0.95f.
+   * @return The percentile in ms.
+   */
+  float getPercentile(const Info& info, float ratio) const;
+
   /**
    * Returns the frequency of the process attached to this time info.
    */
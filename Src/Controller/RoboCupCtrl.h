@@ -123,6 +123,9 @@ protected:
 
   /**
    * The function is called in each simulation step.
+   * The processes of all robots run in threads of their own and are only
+   * triggered by the data exchanged here, so they already execute in parallel.
+   * Only the exchange with the simulation is done one robot after the other.
    */
   virtual void update();
 
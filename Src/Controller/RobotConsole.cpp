@@ -204,8 +204,31 @@ void RobotConsole::addColorSpaceViews(const std::string& id, const std::string&
 
 void RobotConsole::handleAllMessages(MessageQueue& messageQueue)
 {
+  // The queue is only accessed by this thread, so JPEG images can be decompressed
+  // without blocking the views that are painted while the console is locked.
+  class JPEGDecoder : public MessageHandler
+  {
+  public:
+    std::list<Image>& images;
+
+    JPEGDecoder(std::list<Image>& images) : images(images) {}
+
+    bool handleMessage(InMessage& message)
+    {
+      if(message.getMessageID() != idJPEGImage)
+        return false;
+      JPEGImage jpi;
+      message.bin >> jpi;
+      images.emplace_back(false);
+      jpi.toImage(images.back());
+      return true;
+    }
+  } decoder(decodedJPEGImages);
+  messageQueue.handleAllMessages(decoder);
+
   SYNC;  // Only one thread can access *this now.
   messageQueue.handleAllMessages(*this);
+  decodedJPEGImages.clear();
 }
 
 bool RobotConsole::handleMessage(InMessage& message)
@@ -259,13 +282,19 @@ bool RobotConsole::handleMessage(InMessage& message)
     case idJPEGImage:
     {
       Image i(false);
-      JPEGImage jpi;
-      message.bin >> jpi;
-      jpi.toImage(i);
+      if(decodedJPEGImages.empty())
+      {
+        JPEGImage jpi;
+        message.bin >> jpi;
+        jpi.toImage(i);
+      }
+      const Image& image = decodedJPEGImages.empty() ? i : decodedJPEGImages.front();
       if(incompleteImages["raw image"].image)
-        incompleteImages["raw image"].image->from(i);
+        incompleteImages["raw image"].image->from(image);
       else
-        incompleteImages["raw image"].image = new DebugImage(i, true);
+        incompleteImages["raw image"].image = new DebugImage(image, true);
+      if(!decodedJPEGImages.empty())
+        decodedJPEGImages.pop_front();
       return true;
     }
     case idThumbnail:
@@ -848,6 +877,34 @@ void RobotConsole::pollForDirectMode()
   }
 }
 
+bool RobotConsole::isReplayFinished()
+{
+  SYNC;
+  return logFile != "" && logPlayer.state == LogPlayer::initial;
+}
+
+void RobotConsole::writeTimingReport(std::ostream& stream)
+{
+  SYNC;
+  stream << logFile << ": " << logPlayer.numberOfFrames << " frames" << std::endl;
+  for(char process : {'b', 'm'})
+  {
+    const TimeInfo& timeInfo = timeInfos.at(process);
+    std::vector<std::pair<std::string, const TimeInfo::Total*>> totals;
+    for(const auto& total : timeInfo.totals)
+      if(total.second.count)
+        totals.emplace_back(timeInfo.getName(total.first), &total.second);
+    std::sort(totals.begin(), totals.end());
+    for(const auto& total : totals)
+      stream << "  " << timeInfo.processName << "." << total.first
+             << ": avg " << total.second->sum / total.second->count / 1000.
+             << " ms, p50 " << total.second->percentile(0.5f) / 1000.f
+             << " ms, p99 " << total.second->percentile(0.99f) / 1000.f
+             << " ms, max " << total.second->max / 1000.f
+             << " ms, " << total.second->count << " measurements" << std::endl;
+  }
+}
+
 bool RobotConsole::handleConsoleLine(const std::string& line)
 {
   InConfigMemory stream(line.c_str(), line.size());
@@ -1298,6 +1355,31 @@ bool RobotConsole::log(In& stream, bool first)
       return logPlayer.writeTimingData(name);
     }
   }
+  else if(command == "saveCSV")
+  {
+    SYNC;
+    std::string name, buf;
+    stream >> name >> buf;
+    if(name.size() == 0 || buf.size() == 0)
+      return false;
+    std::vector<MessageID> messageIDs;
+    while(buf != "")
+    {
+      FOREACH_ENUM(MessageID, i)
+        if(buf == ::getName(i) || buf == ::getName(i) + 2)
+        {
+          messageIDs.push_back(i);
+          goto foundCSV;
+        }
+
+      return false;
+    foundCSV:
+      stream >> buf;
+    }
+    if((int)name.rfind('.') <= (int)name.find_last_of("\\/"))
+      name = name + ".csv";
+    return logPlayer.saveCSV(name, messageIDs, streamHandler);
+  }
   else if(command == "keep" || command == "remove")
   {
     SYNC;
@@ -1360,6 +1442,27 @@ bool RobotConsole::log(In& stream, bool first)
 
       return true;
     }
+    else if(command == "keep" && buf == "where")
+    {
+      std::vector<LogPlayer::Condition> conditions;
+      for(stream >> buf; buf != ""; stream >> buf)
+      {
+        LogPlayer::Condition condition;
+        condition.column = buf;
+        stream >> condition.op >> condition.value;
+        if(condition.value == "")
+          return false;
+        const std::string representation = buf.substr(0, buf.find_first_of(".["));
+        condition.id = undefined;
+        FOREACH_ENUM(MessageID, i)
+          if(representation == ::getName(i) + 2)
+            condition.id = i;
+        if(condition.id == undefined)
+          return false;
+        conditions.push_back(condition);
+      }
+      return !conditions.empty() && logPlayer.keepFrames(conditions, streamHandler);
+    }
     else if(command == "keep" && buf == "penaltyMarkPercept")
     {
       logPlayer.keepFrames([&](InMessage& message) -> bool
@@ -1521,7 +1624,8 @@ bool RobotConsole::log(In& stream, bool first)
     if(command == "load")
     {
       std::string name;
-      stream >> name;
+      unsigned blocks = 0;
+      stream >> name >> blocks;
       if(name.size() == 0)
         return false;
       else
@@ -1532,7 +1636,7 @@ bool RobotConsole::log(In& stream, bool first)
           name = std::string("Logs\\") + name;
         logFile = name;
         LogPlayer::LogPlayerState state = logPlayer.state;
-        bool result = logPlayer.open(name);
+        bool result = logPlayer.open(name, blocks);
         if(result)
           logPlayer.handleAllMessages(annotationInfos);
         if(result && state == LogPlayer::playing)
@@ -1593,6 +1697,8 @@ bool RobotConsole::log(In& stream, bool first)
     }
     else if(command == "time")
     {
+      //backup state, gotoFrame will change the state.
+      LogPlayer::LogPlayerState state = logPlayer.state;
       int minutes, seconds;
       stream >> minutes;
       stream >> seconds;
@@ -1609,7 +1715,7 @@ bool RobotConsole::log(In& stream, bool first)
       else
       {
         logPlayer.gotoFrame(std::max<>(std::min<>(frame - 1, logPlayer.numberOfFrames - 1), 0));
-        if(logPlayer.state == LogPlayer::playing)
+        if(state == LogPlayer::playing)
           logPlayer.play();
       }
       return true;
@@ -48,6 +48,7 @@
 #include "Visualization/DebugDrawing3D.h"
 
 #include <QString>
+#include <deque>
 #include <fstream>
 #include <list>
 
@@ -181,7 +182,7 @@ public:
 
   struct Plot
   {
-    std::list<float> points;
+    std::deque<float> points;
     unsigned timeStamp = 0;
   };
 
@@ -239,6 +240,7 @@ private:
   DebugDataInfos debugDataInfos; /** All debug data information. */
 
   Images incompleteImages; /** Buffers images of this frame (created on demand). */
+  std::list<Image> decodedJPEGImages; /**< JPEG images of the current message queue, decompressed before the console is locked. */
   Drawings incompleteImageDrawings; /**< Buffers incomplete image drawings from the debug queue. */
   Drawings incompleteFieldDrawings; /**< Buffers incomplete field drawings from the debug queue. */
   Drawings3D incompleteDrawings3D; /**< Buffers incomplete 3d drawings from the debug queue. */
@@ -316,6 +318,19 @@ public:
    */
   void handleConsole(const std::string& line);
 
+  /**
+   * The function states whether the replay of a log file has finished.
+   * @return Is a log file replayed that reached its end?
+   */
+  bool isReplayFinished();
+
+  /**
+   * The function writes the statistics of all stop watches collected since
+   * the log file was opened, i.e. over the whole replay.
+   * @param stream The stream the report is written to.
+   */
+  void writeTimingReport(std::ostream& stream);
+
   /**
    * The method is called when Shift+Ctrl+letter was pressed.
    * @param key A: 0 ... Z: 25.
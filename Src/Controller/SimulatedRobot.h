@@ -109,6 +109,8 @@ public:
 
   /**
    * Determines the camera image of the simulated robot.
+   * The rendered RGB image is converted directly into the YUYV layout of \c image
+   * in a single pass, so no intermediate copy is made.
    * @param image The determined image.
    * @param cameraInfo The information about the camera that took the image.
    */
@@ -64,11 +64,12 @@ QtVariantProperty* DataView::getProperty(const std::string& fqn, int propertyTyp
   else
   {
     //property already exists, load it.
-    pProp = theProperties[fqn];
+    pProp = propIt->second;
   }
 
-  //add to parent if there is one.
-  if(nullptr != pParent)
+  //add to parent if there is one. addSubProperty() searches the whole subtree
+  //of the property for cycles, so skip it if the property is already a child.
+  if(nullptr != pParent && !pParent->subProperties().contains(pProp))
     pParent->addSubProperty(pProp);
 
   return pProp;
@@ -77,7 +77,11 @@ void PropertyTreeCreator::deselect()
   ASSERT(property);
   stack.pop_back();
   if(!stack.empty())
-    stack.back().property->addSubProperty(property);
+  {
+    QtVariantProperty* parent = stack.back().property;
+    if(!parent->subProperties().contains(property))
+      parent->addSubProperty(property);
+  }
   else
     root = property;
 }
@@ -183,6 +183,7 @@ bool DotViewWidget::openDotFileContent(const QString& content)
 {
   if(content.isEmpty())
     return false;
+  lastDotFileContent = content;
 
   // generate dot file
   const QString dotFileName = QDir::temp().filePath("DotView.dot");
@@ -199,7 +200,11 @@ void DotViewWidget::update()
 {
   if(!dotViewObject.hasChanged())
     return;
-  openDotFileContent(dotViewObject.generateDotFileContent());
+
+  // The layout is expensive, so it is only recomputed if the graph itself changed
+  const QString content = dotViewObject.generateDotFileContent();
+  if(content != lastDotFileContent)
+    openDotFileContent(content);
 }
 
 QString DotViewWidget::builtDotCommand(const QString& fmt, const QString& src, const QString& dest) const
@@ -77,6 +77,7 @@ public:
 
 private:
   DotViewObject& dotViewObject; /**< The DotViewObject that created this widget */
+  QString lastDotFileContent; /**< The content of the dot graph file that is currently displayed */
 
   /**
    * saves the scroll and zoom state and destroys the widget
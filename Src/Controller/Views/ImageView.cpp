@@ -201,10 +201,10 @@ void ImageWidget::copyImage(const DebugImage& srcImage)
       int g = (int)(gain * (float)((*p >> 8) & 0xff));
       int b = (int)(gain * (float)((*p) & 0xff));
 
-      *p++ = (r < 0 ? 0 : r > 255 ? 255 : r) << 16 |
-             (g < 0 ? 0 : g > 255 ? 255 : g) << 8 |
-             (b < 0 ? 0 : b > 255 ? 255 : b) |
-             0xff000000;
+      *p = (r < 0 ? 0 : r > 255 ? 255 : r) << 16 |
+           (g < 0 ? 0 : g > 255 ? 255 : g) << 8 |
+           (b < 0 ? 0 : b > 255 ? 255 : b) |
+           0xff000000;
     }
   }
 }
@@ -244,7 +244,8 @@ void ImageWidget::segmentImage(const DebugImage& srcImage)
 
 void ImageWidget::paintImage(QPainter& painter, const DebugImage& srcImage)
 {
-  if(srcImage.timeStamp != lastImageTimeStamp || imageView.segmented)
+  if(srcImage.timeStamp != lastImageTimeStamp || imageView.segmented != lastSegmented ||
+     (imageView.segmented && imageView.console.colorCalibrationTimeStamp != lastColorTableTimeStamp))
   {
     if(imageView.segmented)
       copyImageSegmented(srcImage);
@@ -252,6 +253,7 @@ void ImageWidget::paintImage(QPainter& painter, const DebugImage& srcImage)
       copyImage(srcImage);
 
     lastImageTimeStamp = srcImage.timeStamp;
+    lastSegmented = imageView.segmented;
     if(imageView.segmented)
       lastColorTableTimeStamp = imageView.console.colorCalibrationTimeStamp;
   }
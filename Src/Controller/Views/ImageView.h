@@ -96,6 +96,7 @@ private:
   int imageHeight = Image::maxResolutionHeight;
   unsigned int lastImageTimeStamp = 0;
   unsigned int lastColorTableTimeStamp = 0;
+  bool lastSegmented = false;
   unsigned int lastDrawingsTimeStamp = 0;
   QPainter painter;
   QPointF dragStart;
@@ -243,15 +243,38 @@ void PlotWidget::paint(QPainter& painter)
     const std::list<RobotConsole::Layer>& plotList = plotView.console.plotViews[plotView.name];
     for(const RobotConsole::Layer& layer : plotList)
     {
-      const std::list<float>& list = plotView.console.plots[layer.layer].points;
+      const std::deque<float>& list = plotView.console.plots[layer.layer].points;
       size_t numOfPoints = std::min(list.size(), static_cast<size_t>(plotView.plotSize));
       if(numOfPoints > 1)
       {
-        std::list<float>::const_iterator k = list.end();
-        for(size_t i = 0; i < numOfPoints; ++i)
+        // If there are more values than pixels, only the minimum and maximum per pixel column are drawn.
+        const size_t numOfColumns = std::max(static_cast<size_t>(plotRect.width()), static_cast<size_t>(1));
+        std::deque<float>::const_iterator k = list.end();
+        if(numOfPoints > numOfColumns * 2)
         {
-          plotView.points[i].ry() = *(--k);
+          const float valuesPerColumn = plotSizeF / static_cast<float>(numOfColumns);
+          size_t i = 0;
+          size_t numOfDrawnPoints = 0;
+          for(size_t column = 0; column < numOfColumns && i < numOfPoints; ++column)
+          {
+            const size_t end = std::min(static_cast<size_t>(static_cast<float>(column + 1) * valuesPerColumn), numOfPoints);
+            float min = *(--k);
+            float max = min;
+            for(++i; i < end; ++i)
+            {
+              const float value = *(--k);
+              min = std::min(min, value);
+              max = std::max(max, value);
+            }
+            const float x = (static_cast<float>(column) + 0.5f) * valuesPerColumn;
+            plotView.points[numOfDrawnPoints++] = QPointF(x, min);
+            plotView.points[numOfDrawnPoints++] = QPointF(x, max);
+          }
+          numOfPoints = numOfDrawnPoints;
         }
+        else
+          for(size_t i = 0; i < numOfPoints; ++i)
+            plotView.points[i] = QPointF(static_cast<qreal>(i), *(--k));
 
         const ColorRGBA& color = layer.color;
         QPen pen(QColor(color.r, color.g, color.b));
@@ -304,11 +327,11 @@ void PlotWidget::determineMinMaxValue()
     const std::list<RobotConsole::Layer>& plotList = plotView.console.plotViews[plotView.name];
     for(const auto& layer : plotList)
     {
-      const std::list<float>& list = plotView.console.plots[layer.layer].points;
+      const std::deque<float>& list = plotView.console.plots[layer.layer].points;
       int numOfPoints = std::min((int)list.size(), (int)plotView.plotSize);
       if(numOfPoints > 1)
       {
-        std::list<float>::const_iterator k = list.begin();
+        std::deque<float>::const_iterator k = list.begin();
         for(int j = plotView.plotSize - numOfPoints; j < int(plotView.plotSize); ++j)
         {
           const float& value(*(k++));
@@ -380,7 +403,7 @@ void PlotWidget::exportAsGnuplot()
     numOfPlots = (int)plotList.size();
     for(const RobotConsole::Layer& layer : plotList)
     {
-      const std::list<float>& list = plotView.console.plots[layer.layer].points;
+      const std::deque<float>& list = plotView.console.plots[layer.layer].points;
       int curNumOfPoints = std::min((int)list.size(), (int)plotView.plotSize);
       if(curNumOfPoints < numOfPoints)
         numOfPoints = curNumOfPoints;
@@ -397,8 +420,8 @@ void PlotWidget::exportAsGnuplot()
     int currentPlot = 0;
     for(const RobotConsole::Layer layer : plotList)
     {
-      const std::list<float>& list = plotView.console.plots[layer.layer].points;
-      std::list<float>::const_reverse_iterator k = list.rbegin();
+      const std::deque<float>& list = plotView.console.plots[layer.layer].points;
+      std::deque<float>::const_reverse_iterator k = list.rbegin();
       for(int j = numOfPoints - 1; j >= 0; --j)
         data[j][currentPlot] = *(k++);
       ++currentPlot;
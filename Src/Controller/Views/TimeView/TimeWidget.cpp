@@ -36,19 +36,20 @@ struct Row
   NumberTableWidgetItem* min;
   NumberTableWidgetItem* max;
   NumberTableWidgetItem* avg;
+  NumberTableWidgetItem* p95;
 };
 
 TimeWidget::TimeWidget(TimeView& timeView) : timeView(timeView)
 {
   table = new QTableWidget();
-  table->setColumnCount(4);
+  table->setColumnCount(5);
   QStringList headerNames;
-  headerNames << "Stopwatch" << "Min" << "Max" << "Avg";
+  headerNames << "Stopwatch" << "Min" << "Max" << "Avg" << "95%";
   table->setHorizontalHeaderLabels(headerNames);
   table->verticalHeader()->setVisible(false);
   table->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
   table->verticalHeader()->setDefaultSectionSize(15);
-  table->horizontalHeader()->setSectionResizeMode(3, QHeaderView::Stretch);
+  table->horizontalHeader()->setSectionResizeMode(4, QHeaderView::Stretch);
   table->setEditTriggers(QAbstractItemView::NoEditTriggers);
   table->setAlternatingRowColors(true);
   table->setSortingEnabled(true);
@@ -142,6 +143,7 @@ void TimeWidget::update()
         //new item
         currentRow = new Row;
         currentRow->avg = new NumberTableWidgetItem();
+        currentRow->p95 = new NumberTableWidgetItem();
         currentRow->max = new NumberTableWidgetItem();
         currentRow->min = new NumberTableWidgetItem();
         currentRow->name = new QTableWidgetItem();
@@ -151,6 +153,7 @@ void TimeWidget::update()
         table->setItem(rowCount, 1, currentRow->min);
         table->setItem(rowCount, 2, currentRow->max);
         table->setItem(rowCount, 3, currentRow->avg);
+        table->setItem(rowCount, 4, currentRow->p95);
         items[infoPair.first] = currentRow;
       }
       float minTime = -1, maxTime = -1, avgTime = -1;
@@ -161,6 +164,7 @@ void TimeWidget::update()
       currentRow->avg->setText(QString::number(avgTime));
       currentRow->min->setText(QString::number(minTime));
       currentRow->max->setText(QString::number(maxTime));
+      currentRow->p95->setText(QString::number(timeView.info.getPercentile(infoPair.second, 0.95f)));
       currentRow->name->setText(QString(name.c_str())); //refresh name every time to eliminate unknown
     }
   }
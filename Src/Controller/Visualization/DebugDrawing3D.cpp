@@ -100,17 +100,21 @@ void DebugDrawing3D::draw2()
   glEnable(GL_BLEND);
   glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
-  // Draw all lines.
+  // Draw all lines. Consecutive lines of the same width are drawn in a single batch.
   if(!lines.empty())
   {
     glPushAttrib(GL_LINE_BIT);
-    for(const Line& l : lines)
+    for(auto l = lines.begin(); l != lines.end();)
     {
-      glLineWidth(l.width);
-      glColor4ub(l.color.r, l.color.g, l.color.b, l.color.a);
+      const float width = l->width;
+      glLineWidth(width);
       glBegin(GL_LINES);
-      glVertex3f(l.start.x(), l.start.y(), l.start.z());
-      glVertex3f(l.end.x(), l.end.y(), l.end.z());
+      for(; l != lines.end() && l->width == width; ++l)
+      {
+        glColor4ub(l->color.r, l->color.g, l->color.b, l->color.a);
+        glVertex3f(l->start.x(), l->start.y(), l->start.z());
+        glVertex3f(l->end.x(), l->end.y(), l->end.z());
+      }
       glEnd();
     }
     glPopAttrib();
@@ -120,29 +124,43 @@ void DebugDrawing3D::draw2()
   if(!dots.empty())
   {
     glPushAttrib(GL_POINT_BIT);
-    for(const Dot& d : dots)
+    for(auto d = dots.begin(); d != dots.end();)
     {
-      // Since each point may have a different size we can't handle all
-      // points in a single glBegin(GL_POINTS).
-      // ( glPointSize is not allowed in a glBegin(...). )
-      glPointSize(d.size);
-      glColor4ub(d.color.r, d.color.g, d.color.b, d.color.a);
+      // glPointSize is not allowed in a glBegin(...), so only consecutive
+      // points of the same size are handled in a single glBegin(GL_POINTS).
+      const float size = d->size;
+      glPointSize(size);
       glBegin(GL_POINTS);
-      glVertex3f(d.point.x(), d.point.y(), d.point.z());
+      for(; d != dots.end() && d->size == size; ++d)
+      {
+        glColor4ub(d->color.r, d->color.g, d->color.b, d->color.a);
+        glVertex3f(d->point.x(), d->point.y(), d->point.z());
+      }
       glEnd();
     }
     glPopAttrib();
   }
 
+  GLUquadric* quadric = gluNewQuadric();
+
+  // Spheres and ellipsoids share a unit sphere that is only tessellated once.
+  GLuint unitSphere = 0;
+  if(!spheres.empty() || !ellipsoids.empty())
+  {
+    unitSphere = glGenLists(1);
+    glNewList(unitSphere, GL_COMPILE);
+    gluSphere(quadric, 1, 16, 16);
+    glEndList();
+  }
+
   // draw spheres
   for(const Sphere& s : spheres)
   {
     glColor4ub(s.color.r, s.color.g, s.color.b, s.color.a);
     glPushMatrix();
     glTranslatef(s.point.x(), s.point.y(), s.point.z());
-    GLUquadric* q = gluNewQuadric();
-    gluSphere(q, s.radius, 16, 16);
-    gluDeleteQuadric(q);
+    glScalef(s.radius, s.radius, s.radius);
+    glCallList(unitSphere);
     glPopMatrix();
   }
 
@@ -155,32 +173,36 @@ void DebugDrawing3D::draw2()
     AngleAxisf aa(e.pose.rotation);
     glRotatef(toDegrees(aa.angle()), aa.axis().x(), aa.axis().y(), aa.axis().z());
     glScalef(e.radii.x(), e.radii.y(), e.radii.z());
-    GLUquadric* q = gluNewQuadric();
-    gluSphere(q, 1, 16, 16);
-    gluDeleteQuadric(q);
+    glCallList(unitSphere);
     glPopMatrix();
   }
 
+  if(unitSphere)
+    glDeleteLists(unitSphere, 1);
+
   // Draw all quads.
-  for(const Quad& q : quads)
+  if(!quads.empty())
   {
-    glColor4ub(q.color.r, q.color.g, q.color.b, q.color.a);
     glBegin(GL_QUADS);
-
-    const Vector3f& p1 = q.points[0];
-    const Vector3f& p2 = q.points[1];
-    const Vector3f& p3 = q.points[2];
-    const Vector3f& p4 = q.points[3];
-    Vector3f u = p2 - p1;
-    Vector3f v = p3 - p1;
-    Vector3f n = u.cross(v);
-    n.normalize();
-
-    glNormal3fv(&n.x());
-    glVertex3fv(&p1.x());
-    glVertex3fv(&p2.x());
-    glVertex3fv(&p3.x());
-    glVertex3fv(&p4.x());
+    for(const Quad& q : quads)
+    {
+      glColor4ub(q.color.r, q.color.g, q.color.b, q.color.a);
+
+      const Vector3f& p1 = q.points[0];
+      const Vector3f& p2 = q.points[1];
+      const Vector3f& p3 = q.points[2];
+      const Vector3f& p4 = q.points[3];
+      Vector3f u = p2 - p1;
+      Vector3f v = p3 - p1;
+      Vector3f n = u.cross(v);
+      n.normalize();
+
+      glNormal3fv(&n.x());
+      glVertex3fv(&p1.x());
+      glVertex3fv(&p2.x());
+      glVertex3fv(&p3.x());
+      glVertex3fv(&p4.x());
+    }
     glEnd();
   }
 
@@ -198,16 +220,14 @@ void DebugDrawing3D::draw2()
     if(c.rotation.z() != 0)
       glRotated(toDegrees(c.rotation.z()), 0, 0, 1);
     glTranslated(0, 0, -c.height / 2);
-    GLUquadric* q = gluNewQuadric();
-    gluCylinder(q, c.baseRadius, c.topRadius, c.height, 16, 1);
+    gluCylinder(quadric, c.baseRadius, c.topRadius, c.height, 16, 1);
     glRotated(180, 0, 1, 0);
     if(c.baseRadius > 0.f)
-      gluDisk(q, 0, c.baseRadius, 16, 1);
+      gluDisk(quadric, 0, c.baseRadius, 16, 1);
     glRotated(180, 0, 1, 0);
     glTranslated(0, 0, c.height);
     if(c.topRadius > 0.f)
-      gluDisk(q, 0, c.topRadius, 16, 1);
-    gluDeleteQuadric(q);
+      gluDisk(quadric, 0, c.topRadius, 16, 1);
     glPopMatrix();
   }
 
@@ -224,13 +244,13 @@ void DebugDrawing3D::draw2()
     if(pD.rotation.z() != 0)
       glRotated(toDegrees(pD.rotation.z()), 0, 0, 1);
 
-    GLUquadric* q = gluNewQuadric();
-    gluPartialDisk(q, pD.innerRadius, pD.outerRadius, 16, 10, toDegrees(pD.startAngle), toDegrees(pD.sweeptAngle));
+    gluPartialDisk(quadric, pD.innerRadius, pD.outerRadius, 16, 10, toDegrees(pD.startAngle), toDegrees(pD.sweeptAngle));
 
-    gluDeleteQuadric(q);
     glPopMatrix();
   }
 
+  gluDeleteQuadric(quadric);
+
   // draw 3d images
   if(!images.empty())
   {
@@ -8,6 +8,7 @@
 #include "OpenGLMethods.h"
 #include <Platform/OpenGL.h>
 #include "Tools/ImageProcessing/ColorModelConversions.h"
+#include <vector>
 
 /** returns (value+offset)/scale */
 float transformCoordinates(int scale, int offset, int value)
@@ -172,6 +173,9 @@ void OpenGLMethods::paintImagePixelsToOpenGLList(const DebugImage& image, int co
     float x, y, xn, yn;
     float z00, z01, z10, z11;
 
+    // In a color space, all pixels of the same color are painted to the same point
+    std::vector<bool> painted(zComponent == -1 ? 1 << 24 : 0);
+
     for(int j = y1; j < y2 - 2; j++)
     {
       for(int i = x1; i < x2 - 2; i++)
@@ -181,6 +185,10 @@ void OpenGLMethods::paintImagePixelsToOpenGLList(const DebugImage& image, int co
           unsigned char* channels = convertedImage[j * rgbImage.width + i].channels;
           if(colorModel == 0) //(padding is at 0 by yuv)
             channels++;
+          const unsigned color = channels[0] << 16 | channels[1] << 8 | channels[2];
+          if(painted[color])
+            continue;
+          painted[color] = true;
           x = -1.0f + channels[2] * tmp;
           y = -1.0f + channels[0] * tmp;
           z00 = -1.0f + channels[1] * tmp;
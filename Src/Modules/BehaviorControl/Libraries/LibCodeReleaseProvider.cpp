@@ -18,7 +18,7 @@ void LibCodeReleaseProvider::update(LibCodeRelease& libCodeRelease)
   };
   
    libCodeRelease.angleToCenter=(theRobotPose.inversePose * Vector2f(0.f, 0.f)).angle();
-   libCodeRelease.angleToBall=(theRobotPose.inversePose * Vector2f(robotToField(theRobotPose,theBallModel.estimate.position))).angle();
+   libCodeRelease.angleToBall=theBallModel.estimate.position.angle();
   
         static float odometryR = 0.f;
 	static float odometryX = 0.f;
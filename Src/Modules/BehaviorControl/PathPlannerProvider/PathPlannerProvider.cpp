@@ -128,35 +128,42 @@ void PathPlannerProvider::clipPenaltyArea(const Vector2f& position, float& left,
 
 void PathPlannerProvider::createNodes(const Pose2f& target, bool excludePenaltyArea)
 {
+  // Keep the memory of the blocked sectors for the nodes created next.
+  for(auto& node : nodes)
+  {
+    node.blockedSectors.clear();
+    blockedSectorsPool.emplace_back(std::move(node.blockedSectors));
+  }
   nodes.clear();
+  edgeArena.reset();
 
   // Reserve ennough space that prevents any reallocation, because the addresses of entries are used.
   nodes.reserve(sqr((excludePenaltyArea ? 8 : 6) +
                     (useObstacles ? theObstacleModel.obstacles.size() : theTeamPlayersModel.obstacles.size())));
 
   // Insert start and target
-  nodes.emplace_back(theRobotPose.translation, 0.f);
-  nodes.emplace_back(target.translation, 0.f);
+  addNode(theRobotPose.translation, 0.f);
+  addNode(target.translation, 0.f);
   Node& from(nodes.front());
   Node& to(nodes.back());
 
   // Insert goalposts
-  nodes.emplace_back(Vector2f(theFieldDimensions.xPosOpponentGoalPost, theFieldDimensions.yPosLeftGoal), goalPostRadius - radiusControlOffset);
-  nodes.emplace_back(Vector2f(theFieldDimensions.xPosOpponentGoalPost, theFieldDimensions.yPosRightGoal), goalPostRadius - radiusControlOffset);
-  nodes.emplace_back(Vector2f(theFieldDimensions.xPosOwnGoalPost, theFieldDimensions.yPosLeftGoal), goalPostRadius - radiusControlOffset);
-  nodes.emplace_back(Vector2f(theFieldDimensions.xPosOwnGoalPost, theFieldDimensions.yPosRightGoal), goalPostRadius - radiusControlOffset);
+  addNode(Vector2f(theFieldDimensions.xPosOpponentGoalPost, theFieldDimensions.yPosLeftGoal), goalPostRadius - radiusControlOffset);
+  addNode(Vector2f(theFieldDimensions.xPosOpponentGoalPost, theFieldDimensions.yPosRightGoal), goalPostRadius - radiusControlOffset);
+  addNode(Vector2f(theFieldDimensions.xPosOwnGoalPost, theFieldDimensions.yPosLeftGoal), goalPostRadius - radiusControlOffset);
+  addNode(Vector2f(theFieldDimensions.xPosOwnGoalPost, theFieldDimensions.yPosRightGoal), goalPostRadius - radiusControlOffset);
 
   if(excludePenaltyArea)
   {
     // The nodes around the penalty area will be intersected by barriers. Therefore, they can
     // be reached from two sides and must be clonable once.
-    nodes.emplace_back(Vector2f(theFieldDimensions.xPosOwnPenaltyArea, theFieldDimensions.yPosLeftPenaltyArea), penaltyAreaRadius - radiusControlOffset + epsilon);
+    addNode(Vector2f(theFieldDimensions.xPosOwnPenaltyArea, theFieldDimensions.yPosLeftPenaltyArea), penaltyAreaRadius - radiusControlOffset + epsilon);
     nodes.back().allowedClones = 1;
-    nodes.emplace_back(Vector2f(theFieldDimensions.xPosOwnPenaltyArea, theFieldDimensions.yPosRightPenaltyArea), penaltyAreaRadius - radiusControlOffset + epsilon);
+    addNode(Vector2f(theFieldDimensions.xPosOwnPenaltyArea, theFieldDimensions.yPosRightPenaltyArea), penaltyAreaRadius - radiusControlOffset + epsilon);
     nodes.back().allowedClones = 1;
-    nodes.emplace_back(Vector2f(theFieldDimensions.xPosOwnGroundline, theFieldDimensions.yPosLeftPenaltyArea), penaltyAreaRadius - radiusControlOffset + epsilon);
+    addNode(Vector2f(theFieldDimensions.xPosOwnGroundline, theFieldDimensions.yPosLeftPenaltyArea), penaltyAreaRadius - radiusControlOffset + epsilon);
     nodes.back().allowedClones = 1;
-    nodes.emplace_back(Vector2f(theFieldDimensions.xPosOwnGroundline, theFieldDimensions.yPosRightPenaltyArea), penaltyAreaRadius - radiusControlOffset + epsilon);
+    addNode(Vector2f(theFieldDimensions.xPosOwnGroundline, theFieldDimensions.yPosRightPenaltyArea), penaltyAreaRadius - radiusControlOffset + epsilon);
     nodes.back().allowedClones = 1;
   }
 
@@ -264,7 +271,39 @@ void PathPlannerProvider::addObstacle(const Vector2f& center, float radius)
      borders[1].base.x() < center.x() + radius &&
      borders[2].base.y() > center.y() - radius &&
      borders[3].base.y() < center.y() + radius)
-    nodes.emplace_back(center, radius);
+    addNode(center, radius);
+}
+
+PathPlannerProvider::Node& PathPlannerProvider::addNode(const Vector2f& center, float radius)
+{
+  ASSERT(nodes.size() < nodes.capacity());
+  nodes.emplace_back(center, radius);
+  Node& node = nodes.back();
+  if(!blockedSectorsPool.empty())
+  {
+    node.blockedSectors.swap(blockedSectorsPool.back());
+    blockedSectorsPool.pop_back();
+  }
+  return node;
+}
+
+PathPlannerProvider::Node& PathPlannerProvider::cloneNode(const Node& node)
+{
+  Node& clone = addNode(node.center, node.radius);
+  FOREACH_ENUM(Rotation, rotation)
+  {
+    const size_t numOfEdges = node.edges[rotation].end() - node.edges[rotation].begin();
+    clone.edges[rotation].first = clone.edges[rotation].last = edgeArena.allocate(numOfEdges);
+    for(const auto& edge : node.edges[rotation])
+    {
+      *clone.edges[rotation].last = Edge(&clone, edge.toNode, edge.fromAngle, edge.toPoint, edge.fromRotation, edge.toRotation, edge.length);
+      clone.edges[rotation].last++->pathLength = edge.pathLength;
+    }
+  }
+  clone.blockedSectors = node.blockedSectors;
+  clone.expanded = node.expanded;
+  clone.originalRadius = node.originalRadius;
+  return clone;
 }
 
 void PathPlannerProvider::plan(Node& from, Node& to, float speedRatio)
@@ -287,9 +326,9 @@ void PathPlannerProvider::plan(Node& from, Node& to, float speedRatio)
     if(candidate.edge->toNode->fromEdge[candidate.edge->toRotation] &&
        candidate.edge->toNode->allowedClones > 0)
     {
-      nodes.emplace_back(*candidate.edge->toNode);
+      Node& clone = cloneNode(*candidate.edge->toNode);
       --candidate.edge->toNode->allowedClones;
-      candidate.edge->toNode = &nodes.back();
+      candidate.edge->toNode = &clone;
     }
     if(!candidate.edge->toNode->fromEdge[candidate.edge->toRotation])
     {
@@ -368,32 +407,8 @@ void PathPlannerProvider::expand(Node& node, const Node& to, Rotation rotation,
 
 void PathPlannerProvider::findNeighbors(Node& node)
 {
-  struct Tangent : public Edge
-  {
-    ENUM(Side,
-    {,
-      none,
-      left,
-      right,
-    });
-
-    Side side; /**< Is this the left or right side of the corridor to the other node? */
-    float circleDistance; /**< The closest distance between the borders of the two node connected by this tangent. */
-    bool dummy; /**< Is this just a helper and should not be transformed into a real edge? */
-    bool ended = false; /**< Has the matching left tangent already processed for this right tangent? */
-    int matchingRightTangent = -1; /**< The index of the matching right tangent for this left tangent. */
-
-    /**
-     * Constructor.
-     * @param edge The edge that might be added to the graph if is not blocked by obstacles.
-     * @param side Is this the left or right side of the corridor to the other node?
-     * @param circleDistance The closest distance between the borders of the two node connected by this tangent.
-     * @param dummy Is this just a helper and should not be transformed into a real edge?
-     */
-    Tangent(const Edge& edge, Side side, float circleDistance, bool dummy)
-      : Edge(edge), side(side), circleDistance(circleDistance), dummy(dummy) {}
-  };
-  std::vector<Tangent> tangents[numOfRotations];
+  FOREACH_ENUM(Rotation, rotation)
+    tangents[rotation].clear();
 
   // search all nodes except for start node
   for(auto neighbor = nodes.begin() + 1; neighbor != nodes.end(); ++neighbor)
@@ -460,7 +475,7 @@ void PathPlannerProvider::findNeighbors(Node& node)
                 // Clone target node if it was already reached and clones are allowed.
                 if(neighbor->allowedClones > 0)
                 {
-                  nodes.push_back(*neighbor);
+                  cloneNode(*neighbor);
                   --neighbor->allowedClones;
                 }
               }
@@ -559,8 +574,7 @@ void PathPlannerProvider::findNeighbors(Node& node)
     // Create index for tangents sorted by angle.
     // Since indices are used to reference between tangents,
     // the original vector of tangents must stay unchanged.
-    std::vector<Tangent*> index;
-    index.reserve(t.size());
+    index.clear();
     for(auto& tangent : t)
       index.push_back(&tangent);
     std::sort(index.begin(), index.end(),
@@ -570,8 +584,11 @@ void PathPlannerProvider::findNeighbors(Node& node)
               });
 
     // Sweep through all tangents, managing a set of current nodes sorted by their distance.
-    std::vector<Tangent*> sweepline;
-    sweepline.reserve(t.size());
+    sweepline.clear();
+
+    // At most all tangents become edges.
+    EdgeRange& edges = node.edges[rotation];
+    edges.first = edges.last = edgeArena.allocate(t.size());
     const auto byDistance = [](const Tangent* t1, const Tangent* t2) -> bool
     {
       return t1->circleDistance > t2->circleDistance;
@@ -602,7 +619,7 @@ void PathPlannerProvider::findNeighbors(Node& node)
                 goto doNotAddTangent;
             }
           }
-        node.edges[rotation].emplace_back(*tangent);
+        *edges.last++ = *tangent;
 
       doNotAddTangent:
         ;
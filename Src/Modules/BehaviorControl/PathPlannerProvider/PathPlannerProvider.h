@@ -83,6 +83,9 @@ class PathPlannerProvider : public PathPlannerProviderBase
     float length; /**< The length of this edge. */
     float pathLength; /**< The overall length of the path until arriving at toNode. Will be set by A* seach. */
 
+    /** Default constructor for preallocated edges. */
+    Edge() = default;
+
     /**
      * Constructor.
      * @param fromNode The node from which this edge starts.
@@ -97,10 +100,62 @@ class PathPlannerProvider : public PathPlannerProviderBase
       : fromNode(fromNode), toNode(toNode), fromAngle(fromAngle), toPoint(toPoint), fromRotation(fromRotation), toRotation(toRotation), length(length) {}
   };
 
+  /** A range of edges that were allocated consecutively in the edge arena. */
+  struct EdgeRange
+  {
+    Edge* first = nullptr; /**< The first edge of the range. */
+    Edge* last = nullptr; /**< The end of the range, i.e. the position after the last edge. */
+
+    Edge* begin() const {return first;}
+    Edge* end() const {return last;}
+  };
+
+  /**
+   * Memory for all edges of the graph. The memory is kept between planning
+   * runs, so after the first few runs, no memory is allocated anymore.
+   * The addresses of the edges stay valid until the arena is reset.
+   */
+  class EdgeArena
+  {
+    static const size_t blockSize = 1024; /**< The minimum number of edges per block. */
+    std::vector<std::vector<Edge>> blocks; /**< The blocks of memory. They are never resized after creation. */
+    size_t currentBlock = 0; /**< The block from which edges are currently allocated. */
+    size_t used = 0; /**< The number of edges already used in the current block. */
+
+  public:
+    /** Frees all edges, but keeps the memory. */
+    void reset()
+    {
+      currentBlock = 0;
+      used = 0;
+    }
+
+    /**
+     * Allocates consecutive edges.
+     * @param numOfEdges The number of edges required.
+     * @return The address of the first edge.
+     */
+    Edge* allocate(size_t numOfEdges)
+    {
+      if(currentBlock < blocks.size() && used + numOfEdges > blocks[currentBlock].size())
+      {
+        ++currentBlock;
+        used = 0;
+      }
+      if(currentBlock == blocks.size())
+        blocks.emplace_back(std::max(blockSize, numOfEdges));
+      else if(blocks[currentBlock].size() < numOfEdges)
+        blocks[currentBlock] = std::vector<Edge>(numOfEdges); // not used in this run yet
+      Edge* edges = blocks[currentBlock].data() + used;
+      used += numOfEdges;
+      return edges;
+    }
+  };
+
   /** The nodes of the visibility graph, i.e. the obstacles. */
   struct Node : public Geometry::Circle
   {
-    std::vector<Edge> edges[numOfRotations]; /** The outgoing edges per rotation. */
+    EdgeRange edges[numOfRotations]; /** The outgoing edges per rotation. */
     std::vector<Rangef> blockedSectors; /**< Angular sectors that are blocked by overlapping other obstacles. */
     Edge* fromEdge[numOfRotations]; /**< From which edge was this node reached first (per rotation) during the A* search? */
     bool expanded = false; /**< Were the outgoing edges of this node already expanded? */
@@ -116,24 +171,33 @@ class PathPlannerProvider : public PathPlannerProviderBase
     {
       fromEdge[cw] = fromEdge[ccw] = nullptr;
     }
+  };
+
+  /** A candidate for an edge while searching for the neighbors of a node. */
+  struct Tangent : public Edge
+  {
+    ENUM(Side,
+    {,
+      none,
+      left,
+      right,
+    });
+
+    Side side; /**< Is this the left or right side of the corridor to the other node? */
+    float circleDistance; /**< The closest distance between the borders of the two node connected by this tangent. */
+    bool dummy; /**< Is this just a helper and should not be transformed into a real edge? */
+    bool ended = false; /**< Has the matching left tangent already processed for this right tangent? */
+    int matchingRightTangent = -1; /**< The index of the matching right tangent for this left tangent. */
 
     /**
-     * The copy constructor copies all edges, but sets this node as their origin.
-     * The new node has not been reached by from an edge yet.
-     * @param other The other node that is copied.
+     * Constructor.
+     * @param edge The edge that might be added to the graph if is not blocked by obstacles.
+     * @param side Is this the left or right side of the corridor to the other node?
+     * @param circleDistance The closest distance between the borders of the two node connected by this tangent.
+     * @param dummy Is this just a helper and should not be transformed into a real edge?
      */
-    Node(const Node& other) : Node(other.center, other.radius)
-    {
-      FOREACH_ENUM(Rotation, rotation)
-        for(auto& edge : other.edges[rotation])
-        {
-          edges[rotation].emplace_back(this, edge.toNode, edge.fromAngle, edge.toPoint, edge.fromRotation, edge.toRotation, edge.length);
-          edges[rotation].back().pathLength = edge.pathLength;
-        }
-      blockedSectors = other.blockedSectors;
-      expanded = other.expanded;
-      originalRadius = other.originalRadius;
-    }
+    Tangent(const Edge& edge, Side side, float circleDistance, bool dummy)
+      : Edge(edge), side(side), circleDistance(circleDistance), dummy(dummy) {}
   };
 
   /** A structure to manage the open edges during the A* search. */
@@ -188,8 +252,13 @@ class PathPlannerProvider : public PathPlannerProviderBase
     }
   };
 
+  EdgeArena edgeArena; /**< The memory for the edges of all nodes. */
   std::vector<Node> nodes; /**< All nodes of the visibility graph, i.e. all obstacles, and starting point (1st entry) and target (2nd entry). */
   std::vector<Candidate> candidates; /**< All open edges during the A* search. */
+  std::vector<std::vector<Rangef>> blockedSectorsPool; /**< Memory for blocked sectors of nodes that currently do not exist. */
+  std::vector<Tangent> tangents[numOfRotations]; /**< The tangents to all other nodes during findNeighbors(). */
+  std::vector<Tangent*> index; /**< The tangents of one rotation sorted by angle during findNeighbors(). */
+  std::vector<Tangent*> sweepline; /**< The tangents of the sweepline during findNeighbors(). */
   std::vector<Barrier> barriers; /**< Barrier lines that cannot be crossed during planning. */
   std::vector<Geometry::Line> borders; /**< The border of the field plus a tolerance. */
   bool walkStraight = false; /**< Currently walking straight? */
@@ -239,6 +308,22 @@ class PathPlannerProvider : public PathPlannerProviderBase
    */
   void addObstacle(const Vector2f& center, float radius);
 
+  /**
+   * Appends a node to the nodes. It reuses the memory of blocked sectors of previous nodes.
+   * @param center The center of the node.
+   * @param radius The radius of the node.
+   * @return The new node.
+   */
+  Node& addNode(const Vector2f& center, float radius);
+
+  /**
+   * Appends a clone of a node to the nodes. The clone gets copies of all edges,
+   * but with itself as their origin. It has not been reached by an edge yet.
+   * @param node The node that is cloned.
+   * @return The clone.
+   */
+  Node& cloneNode(const Node& node);
+
   /**
    * Plan a shortest path. The result can be tracked backwards from the target node.
    * @param from The starting node. It is implicitely assumed that this is also the first entry in the vector "nodes".
@@ -24,10 +24,53 @@
 
 MAKE_MODULE(TeamMessageHandler, communication)
 
+void TeamMessageHandler::update(TeamMessageBudget& teamMessageBudget)
+{
+  determineBudget(teamMessageBudget);
+}
+
+void TeamMessageHandler::determineBudget(TeamMessageBudget& budget) const
+{
+  // Without a GameController, there is neither a budget nor a remaining time.
+  const int secsRemaining = static_cast<short>(theGameInfo.secsRemaining);
+
+  // The budget is counted for the whole game, i.e. it is only reset before the first half starts.
+  if(theGameInfo.state == STATE_INITIAL && theGameInfo.firstHalf && secsRemaining >= secsPerHalf)
+    messagesSent = 0;
+
+  budget.limited = theGameInfo.timeLastPackageReceived && secsRemaining > 0;
+  budget.sent = messagesSent;
+  if(!budget.limited)
+  {
+    budget.remaining = 0;
+    budget.interval = sendInterval;
+    return;
+  }
+
+  const int players = theGameInfo.playersPerTeam ? theGameInfo.playersPerTeam : Settings::highestValidPlayerNumber;
+  budget.remaining = std::max(0, messageBudget / players - messagesSent);
+
+  // Regular messages are spread evenly over the rest of the game.
+  const int secsRemainingInGame = secsRemaining + (theGameInfo.firstHalf ? secsPerHalf : 0);
+  const int regularMessages = static_cast<int>(static_cast<float>(budget.remaining) * regularShare);
+  budget.interval = regularMessages > 0 ? std::max(sendInterval, secsRemainingInGame * 1000 / regularMessages) : 0;
+}
+
+bool TeamMessageHandler::eventOccurred() const
+{
+  return (theFrameInfo.getTimeSince(theBallModel.timeWhenLastSeen) < ballSeenTimeout) != ballSeenWhenLastSent
+         || theBehaviorStatus.role != roleWhenLastSent
+         || theWhistle.lastTimeWhistleDetected != whistleWhenLastSent;
+}
+
 void TeamMessageHandler::update(BHumanMessageOutputGenerator& outputGenerator)
 {
   outputGenerator.theBHumanArbitraryMessage.queue.clear();
 
+  TeamMessageBudget budget;
+  determineBudget(budget);
+  const int timeSinceLastSent = theFrameInfo.getTimeSince(timeLastSent);
+
   outputGenerator.sendThisFrame =
 #ifndef SITTING_TEST
 #ifdef TARGET_ROBOT
@@ -35,7 +78,10 @@ void TeamMessageHandler::update(BHumanMessageOutputGenerator& outputGenerator)
     !(theMotionInfo.motion == MotionRequest::specialAction && theMotionInfo.specialActionRequest.specialAction == SpecialActionRequest::playDead) &&
 #endif
 #endif // !SITTING_TEST
-    theFrameInfo.getTimeSince(timeLastSent) >= sendInterval;
+    (budget.limited
+     ? budget.remaining > 0 && ((budget.interval && timeSinceLastSent >= budget.interval)
+                                || (timeSinceLastSent >= sendInterval && eventOccurred()))
+     : timeSinceLastSent >= sendInterval);
 
   outputGenerator.generate = [this, &outputGenerator](RoboCup::SPLStandardMessage* const m)
   {
@@ -129,12 +175,18 @@ void TeamMessageHandler::writeMessage(BHumanMessageOutputGenerator& outputGenera
 
   outputGenerator.sentMessages++;
   timeLastSent = theFrameInfo.time;
+
+  ++messagesSent;
+  ballSeenWhenLastSent = theFrameInfo.getTimeSince(theBallModel.timeWhenLastSeen) < ballSeenTimeout;
+  roleWhenLastSent = theBehaviorStatus.role;
+  whistleWhenLastSent = theWhistle.lastTimeWhistleDetected;
 }
 
 void TeamMessageHandler::update(TeamData& teamData)
 {
-  teamData.generate = [this, &teamData](const RoboCup::SPLStandardMessage* const m)
+  teamData.generate = [this, &teamData](const RoboCup::SPLStandardMessage* const m, unsigned receiveTimestamp)
   {
+    receivedMessageContainer.receiveTimestamp = receiveTimestamp;
     if(readSPLStandardMessage(m))
       return parseMessageIntoBMate(getBMate(teamData));
 
@@ -172,11 +224,15 @@ void TeamMessageHandler::maintainBMateList(TeamData& teamData) const
       teammate.isGoalkeeper = teammate.number == 1;
     }
 
-    // Remove elements that are too old:
+    // Remove elements that are too old. Teammates send with the same budget,
+    // so they are only dropped after missing at least two regular messages.
+    TeamMessageBudget budget;
+    determineBudget(budget);
+    const int timeout = std::max(networkTimeout, 2 * budget.interval);
     auto teammate = teamData.teammates.begin();
     while(teammate != teamData.teammates.end())
     {
-      if(theFrameInfo.getTimeSince(teammate->timeWhenLastPacketReceived) > networkTimeout)
+      if(theFrameInfo.getTimeSince(teammate->timeWhenLastPacketReceived) > timeout)
         teammate = teamData.teammates.erase(teammate);
       else
         ++teammate;
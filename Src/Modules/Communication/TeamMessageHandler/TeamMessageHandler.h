@@ -31,6 +31,7 @@
 #include "Tools/Module/Module.h"
 #include "Representations/Communication/BHumanMessage.h"
 #include "Representations/Communication/TeamData.h"
+#include "Representations/Communication/TeamMessageBudget.h"
 #include "Tools/Communication/BNTP.h"
 
 MODULE(TeamMessageHandler,
@@ -64,11 +65,16 @@ MODULE(TeamMessageHandler,
 
   PROVIDES(BHumanMessageOutputGenerator),
   PROVIDES(TeamData),
+  PROVIDES(TeamMessageBudget),
 
   DEFINES_PARAMETERS(
   {,
-    (int)(200) sendInterval, /**<  Time in ms between two messages that are sent to the teammates */
-    (int)(4000) networkTimeout, /**< Time in ms after which teammates are considered as unconnected */
+    (int)(200) sendInterval, /**<  Minimum time in ms between two messages that are sent to the teammates */
+    (int)(1200) messageBudget, /**< The number of messages the whole team may send per game */
+    (int)(600) secsPerHalf, /**< The duration of a half in s */
+    (float)(0.7f) regularShare, /**< The share of the remaining messages spent on regular messages. The rest is kept for events. */
+    (int)(1000) ballSeenTimeout, /**< Time in ms after which the ball counts as no longer seen */
+    (int)(4000) networkTimeout, /**< Minimum time in ms after which teammates are considered as unconnected. Raised to twice the regular send interval. */
 
     (int)(5000) minTimeBetween2RejectSounds, /*< Time in ms after which another sound output is allowed */
   }),
@@ -91,6 +97,26 @@ private:
   // v- output stuff
   mutable unsigned timeLastSent = 0;
 
+  // v- message budget
+  mutable int messagesSent = 0; /**< The number of messages sent in the current game. */
+  mutable bool ballSeenWhenLastSent = false; /**< Was the ball seen when the last message was sent? */
+  mutable Role::RoleType roleWhenLastSent = Role::undefined; /**< The own role when the last message was sent. */
+  mutable unsigned whistleWhenLastSent = 0; /**< The time of the last whistle when the last message was sent. */
+
+  void update(TeamMessageBudget& teamMessageBudget);
+
+  /**
+   * Determines how many messages this robot may still send in the current game.
+   * @param budget The budget that is determined.
+   */
+  void determineBudget(TeamMessageBudget& budget) const;
+
+  /**
+   * Did anything happen since the last message was sent that the teammates
+   * should know about immediately?
+   */
+  bool eventOccurred() const;
+
   void update(BHumanMessageOutputGenerator& outputGenerator);
   void generateMessage(BHumanMessageOutputGenerator& outputGenerator) const;
   void writeMessage(BHumanMessageOutputGenerator& outputGenerator, RoboCup::SPLStandardMessage* const m) const;
@@ -98,9 +98,10 @@ void CameraSettingsOptimizer::autoExposure(CameraSettings::CameraSettingsCollect
   const unsigned short oldExposure = static_cast<unsigned short>(settings.settings[CameraSettings::exposure]);
   const unsigned char oldGain = static_cast<unsigned char>(settings.settings[CameraSettings::gain]);
 
-  // Compute weighted average luminance
-  const unsigned char* px = theECImage.grayscaled[highestScanline];
-  const unsigned char* const imgEnd = theECImage.grayscaled[theECImage.grayscaled.height];
+  // Compute weighted average luminance. It is sampled from the camera image, because
+  // preparing the ECImage would convert all rows below the highest scanline.
+  const Image::Pixel* px = theImage[0] + theImage.width * highestScanline;
+  const Image::Pixel* const imgEnd = theImage[theImage.height];
   const ptrdiff_t stepSize = std::max<ptrdiff_t>(1, (imgEnd - px) / exposureScanPoints);
   unsigned char min = 255;
   unsigned char max = 0;
@@ -109,15 +110,15 @@ void CameraSettingsOptimizer::autoExposure(CameraSettings::CameraSettingsCollect
   float weightSum = 0;
   for(; px < imgEnd; px += stepSize, pos += stepSize)
   {
-    const short x = static_cast<short>((((pos << 9) / theECImage.grayscaled.width) & 0x1FF) - 256);
-    const short y = static_cast<short>((pos / theECImage.grayscaled.width) * 256 / theECImage.grayscaled.height);
+    const short x = static_cast<short>((((pos << 9) / theImage.width) & 0x1FF) - 256);
+    const short y = static_cast<short>((pos / theImage.width) * 256 / theImage.height);
     const short weight = static_cast<short>(sqrt(sqr(x) + sqr(y)));
     weightSum += weight / 256.f;
-    avg += (*px * weight) >> 8;
-    if(*px < min)
-      min = *px;
-    if(*px > max)
-      max = *px;
+    avg += (px->y * weight) >> 8;
+    if(px->y < min)
+      min = px->y;
+    if(px->y > max)
+      max = px->y;
   }
   avg = static_cast<unsigned int>(static_cast<float>(avg) / weightSum);
   MODIFY("avgLum", avg);
@@ -125,6 +126,10 @@ void CameraSettingsOptimizer::autoExposure(CameraSettings::CameraSettingsCollect
   // Determine target value
   int diff = 128 - avg; // balance image contrast
 
+  // Hysteresis: small deviations do not change the settings
+  if(std::abs(diff) <= luminanceTolerance)
+    return;
+
   // Clamp exposure and gain values, modifying difference to target value
   unsigned short newExposure = static_cast<unsigned short>(std::max<int>(std::min<int>(oldExposure + diff / 2, maxExposure), minExposure));
   unsigned char newGain = static_cast<unsigned char>(std::max<int>(std::min<int>(oldGain + diff / 2, maxGain), minGain));
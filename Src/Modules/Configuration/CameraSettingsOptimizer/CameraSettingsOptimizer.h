@@ -9,7 +9,6 @@
 #include "Representations/Perception/ImagePreprocessing/CameraMatrix.h"
 #include "Representations/Infrastructure/Image.h"
 #include "Representations/Infrastructure/RobotInfo.h"
-#include "Representations/Perception/ImagePreprocessing/ECImage.h"
 #include "Representations/Infrastructure/CameraSettings.h"
 
 #include <array>
@@ -19,7 +18,6 @@ MODULE(CameraSettingsOptimizer,
   REQUIRES(RobotInfo),
   USES(CameraInfo),
   USES(CameraMatrix),
-  USES(ECImage),
   USES(Image),
   PROVIDES(CameraSettings),
   DEFINES_PARAMETERS(
@@ -33,6 +31,7 @@ MODULE(CameraSettingsOptimizer,
     (unsigned char)(30) whiteLuminanceRange,
     (unsigned char)(4) whiteBalanceChangeEffectExponent,
     (unsigned short)(128) exposureScanPoints,
+    (unsigned char)(8) luminanceTolerance,
     (unsigned short)(0) minExposure,
     (unsigned short)(160) maxExposure,
     (unsigned char)(64) minGain,
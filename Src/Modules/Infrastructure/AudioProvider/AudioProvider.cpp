@@ -7,12 +7,14 @@
 
 #include "AudioProvider.h"
 #include "Platform/SystemCall.h"
+#include "Platform/Time.h"
 
 MAKE_MODULE(AudioProvider, cognitionInfrastructure)
 
 #ifdef TARGET_ROBOT
 
-AudioProvider::AudioProvider()
+AudioProvider::AudioProvider() :
+  head(0), tail(0), timestamp(0), lastError(0)
 {
   allChannels ? channels = 4 : channels = 2;
   int brokenFirst = (theDamageConfigurationHead.audioChannelsDefect[0] ? 1 : 0) + (theDamageConfigurationHead.audioChannelsDefect[1] ? 1 : 0);
@@ -42,34 +44,72 @@ AudioProvider::AudioProvider()
   ASSERT(channels <= 4);
   short buf[4];
   VERIFY(snd_pcm_readi(handle, buf, 1) >= 0);
+
+  thread.start(this, &AudioProvider::capture);
 }
 
 AudioProvider::~AudioProvider()
 {
+  thread.stop();
   snd_pcm_close(handle);
 }
 
+void AudioProvider::capture()
+{
+  Thread::nameThread("AudioCapture");
+  short period[periodSize * 4];
+  while(thread.isRunning())
+  {
+    // The device is non-blocking, so waiting with a timeout keeps the thread responsive to stop().
+    if(!snd_pcm_wait(handle, 100))
+      continue;
+
+    const snd_pcm_sframes_t frames = snd_pcm_readi(handle, period, periodSize);
+    if(frames == -EAGAIN)
+      continue;
+    else if(frames < 0)
+    {
+      lastError = static_cast<int>(frames);
+      snd_pcm_recover(handle, static_cast<int>(frames), 1);
+      VERIFY(snd_pcm_readi(handle, period, 1) >= 0);
+      continue;
+    }
+
+    const unsigned count = static_cast<unsigned>(frames) * channels;
+    const unsigned h = head.load(std::memory_order_relaxed);
+    if(bufferSize - (h - tail.load(std::memory_order_acquire)) < count)
+      continue; // The process did not take the samples for a long time.
+    for(unsigned i = 0; i < count; ++i)
+      buffer[(h + i) & (bufferSize - 1)] = period[i];
+    timestamp.store(Time::getCurrentSystemTime(), std::memory_order_relaxed);
+    head.store(h + count, std::memory_order_release);
+  }
+}
+
 void AudioProvider::update(AudioData& audioData)
 {
+  const unsigned h = head.load(std::memory_order_acquire);
   if(onlySoundInSet && theGameInfo.state != STATE_SET)
+  {
+    // Drop the samples, so the first samples provided in SET are recent.
+    tail.store(h, std::memory_order_release);
     return;
+  }
+
+  const int error = lastError.exchange(0);
+  if(error)
+    OUTPUT_WARNING("Lost audio stream (" << error << "), recovering...");
 
   audioData.channels = channels;
   audioData.sampleRate = sampleRate;
+  audioData.timestamp = timestamp.load(std::memory_order_relaxed);
 
-  unsigned available = std::min((unsigned) snd_pcm_avail(handle), maxFrames);
-  audioData.samples.resize(available * channels);
-
-  int status = snd_pcm_readi(handle, audioData.samples.data(), available);
-  if(status < 0)
-  {
-    OUTPUT_WARNING("Lost audio stream (" << status << "), recovering...");
-    snd_pcm_recover(handle, status, 1);
-    ASSERT(channels <= 4);
-    short buf[4];
-    VERIFY(snd_pcm_readi(handle, buf, 1) >= 0);
-    audioData.samples.clear();
-  }
+  const unsigned t = tail.load(std::memory_order_relaxed);
+  const unsigned available = std::min((h - t) / channels, maxFrames) * channels;
+  audioData.samples.resize(available);
+  for(unsigned i = 0; i < available; ++i)
+    audioData.samples[i] = buffer[(t + i) & (bufferSize - 1)];
+  tail.store(t + available, std::memory_order_release);
 }
 
 #else // !defined TARGET_ROBOT
@@ -9,10 +9,12 @@
 #ifdef TARGET_ROBOT
 #include <alsa/asoundlib.h>
 #endif
+#include "Platform/Thread.h"
 #include "Tools/Module/Module.h"
 #include "Representations/Infrastructure/AudioData.h"
 #include "Representations/Infrastructure/GameInfo.h"
 #include "Representations/Configuration/DamageConfiguration.h"
+#include <atomic>
 
 MODULE(AudioProvider,
 {,
@@ -30,12 +32,29 @@ MODULE(AudioProvider,
   }),
 });
 
+/**
+ * The samples are captured by a thread of their own, so no samples are
+ * lost if a frame of the process takes longer. The thread passes them
+ * through a lock-free ring buffer to the process.
+ */
 class AudioProvider : public AudioProviderBase
 {
 private:
 #ifdef TARGET_ROBOT
+  static const unsigned bufferSize = 1 << 16; /**< The number of samples in the ring buffer. Must be a power of 2. */
+  static const unsigned periodSize = 256; /**< The maximum number of frames read by the capture thread at once. */
+
   snd_pcm_t* handle;
   int channels;
+  short buffer[bufferSize]; /**< The ring buffer of samples captured, but not provided yet. */
+  std::atomic<unsigned> head; /**< The number of samples ever captured. Only written by the capture thread. */
+  std::atomic<unsigned> tail; /**< The number of samples ever taken from the buffer. Only written by the process. */
+  std::atomic<unsigned> timestamp; /**< The time when the last samples were captured. */
+  std::atomic<int> lastError; /**< The last error of the device that was recovered from or 0. */
+  Thread thread; /**< The capture thread. */
+
+  /** The main function of the capture thread. */
+  void capture();
 #endif
   void update(AudioData& audioData);
 
@@ -49,7 +49,26 @@ void CameraProvider::update(Image& image)
 {
 #ifdef CAMERA_INCLUDED
   ASSERT(!currentImageCamera);
-  if(upperCamera->hasImage() && (!lowerCamera->hasImage() || upperCamera->getTimeStamp() < lowerCamera->getTimeStamp()))
+  const bool preferUpper = preferUpperCamera
+                           || (preferRequestedCamera && theHeadMotionRequest.cameraControlMode == HeadMotionRequest::upperCamera);
+  const bool preferLower = !preferUpper
+                           && preferRequestedCamera && theHeadMotionRequest.cameraControlMode == HeadMotionRequest::lowerCamera;
+  if(preferUpper && consecutiveDrops < maxConsecutiveDrops && upperCamera->hasImage() && lowerCamera->hasImage()
+     && lowerCamera->getTimeStamp() < upperCamera->getTimeStamp())
+  {
+    lowerCamera->releaseImage(); // would be outdated after the upper image was processed
+    ++consecutiveDrops;
+  }
+  else if(preferLower && consecutiveDrops < maxConsecutiveDrops && upperCamera->hasImage() && lowerCamera->hasImage()
+          && upperCamera->getTimeStamp() < lowerCamera->getTimeStamp())
+  {
+    upperCamera->releaseImage(); // would be outdated after the lower image was processed
+    ++consecutiveDrops;
+  }
+  const bool useUpper = upperCamera->hasImage() && (!lowerCamera->hasImage() || upperCamera->getTimeStamp() < lowerCamera->getTimeStamp());
+  if(!(useUpper ? preferUpper : preferLower))
+    consecutiveDrops = 0; // an image of the camera that is not preferred is processed
+  if(useUpper)
     useImage(true, std::max(lastImageTimeStamp + 1, (unsigned)(upperCamera->getTimeStamp() / 1000) - Time::getSystemTimeBase()), upperCameraInfo, image, upperCamera,
              const_cast<CameraSettings::CameraSettingsCollection&>(theCameraSettings.upper), const_cast<AutoExposureWeightTable&>(theAutoExposureWeightTable));
   else
@@ -61,7 +80,13 @@ void CameraProvider::update(Image& image)
 #endif // CAMERA_INCLUDED
   STOPWATCH("compressJPEG")
   {
-    DEBUG_RESPONSE("representation:JPEGImage") OUTPUT(idJPEGImage, bin, JPEGImage(image));
+    DEBUG_RESPONSE("representation:JPEGImage")
+    {
+      if(compressJPEGInBackground)
+        jpegEncoder.process(image);
+      else
+        OUTPUT(idJPEGImage, bin, JPEGImage(image));
+    }
   }
 }
 
@@ -76,8 +101,11 @@ void CameraProvider::useImage(bool isUpper, unsigned timestamp, CameraInfo& came
                               CameraSettings::CameraSettingsCollection& settings, AutoExposureWeightTable& autoExposureWeightTable)
 {
 #ifdef CAMERA_INCLUDED
+  // The image only references the frame buffer of the driver. The buffer is
+  // returned to the driver in waitForFrameData2(), i.e. after this frame ended.
   image.setResolution(cameraInfo.width / 2, cameraInfo.height / 2, true);
   image.setImage(const_cast<unsigned char*>(naoCam->getImage()));
+  ASSERT(image.isReference);
   image.timeStamp = timestamp;
 
   naoCam->setSettings(settings, autoExposureWeightTable);
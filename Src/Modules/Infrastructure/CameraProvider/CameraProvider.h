@@ -16,6 +16,8 @@
 #include "Representations/Infrastructure/FrameInfo.h"
 #include "Representations/Infrastructure/Image.h"
 #include "Representations/Infrastructure/RobotInfo.h"
+#include "Representations/MotionControl/HeadMotionRequest.h"
+#include "Tools/Debugging/AsyncJPEGEncoder.h"
 #include "Tools/Module/Module.h"
 
 class NaoCamera;
@@ -25,6 +27,7 @@ MODULE(CameraProvider,
   USES(CameraIntrinsicsNext),
   USES(CameraResolutionRequest),
   USES(AutoExposureWeightTable),
+  USES(HeadMotionRequest),
   REQUIRES(CameraSettings),
   REQUIRES(Image),
   REQUIRES(RobotInfo),
@@ -39,6 +42,10 @@ MODULE(CameraProvider,
     (unsigned)(1000) maxWaitForImage, /** Timeout in ms for waiting for new images. */
     (unsigned)(10000) maxDelayAfterInit, /**< Maximum delay until image is received after camera was initialized. */
     (unsigned)(4000) notOkDelay, /** How long after first camera reset to report that camera is not ok. */
+    (bool)(false) preferUpperCamera, /**< If both cameras have an image, use the upper one and drop an older lower one to reduce the latency of upper images. */
+    (unsigned)(1) maxConsecutiveDrops, /**< How many images of the other camera may be dropped in a row when a camera is preferred. */
+    (bool)(false) preferRequestedCamera, /**< If both cameras have an image, use the one the HeadMotionRequest aims with and drop an older one of the other camera. */
+    (bool)(true) compressJPEGInBackground, /**< Compress streamed JPEG images in a thread of their own and drop images while it is busy. */
   }),
 });
 
@@ -54,6 +61,7 @@ private:
   CameraInfo lowerCameraInfo;
   CameraIntrinsics cameraIntrinsics;
   CameraResolution cameraResolution;
+  AsyncJPEGEncoder jpegEncoder; /**< Compresses the images requested as JPEGImage in the background. */
 #ifdef CAMERA_INCLUDED
   unsigned int upperImageReceived = 0;
   unsigned int lowerImageReceived = 0;
@@ -61,6 +69,7 @@ private:
   unsigned int timeWhenCamerasWereOk = 0;
   unsigned int lastImageTimeStamp = 0;
   unsigned long long lastImageTimeStampLL = 0;
+  unsigned consecutiveDrops = 0; /**< The number of images of the not preferred camera dropped in a row. */
 #endif
 
 public:
@@ -0,0 +1,18 @@
+/**
+ * @file Modules/Infrastructure/CameraResolutionGovernor/CameraResolutionGovernor.cpp
+ * This file implements a module that reduces the resolution of the upper camera
+ * when the cpu gets hot, before it throttles itself.
+ */
+
+#include "CameraResolutionGovernor.h"
+
+MAKE_MODULE(CameraResolutionGovernor, cognitionInfrastructure)
+
+void CameraResolutionGovernor::update(CameraResolutionRequest& cameraResolutionRequest)
+{
+  const bool throttled = throttledFrequency && theRobotHealth.cpuFrequency && theRobotHealth.cpuFrequency < throttledFrequency;
+  if(!reduced && (theRobotHealth.cpuTemperature >= reduceTemperature || throttled))
+    reduced = cameraResolutionRequest.setRequest(reducedResolutionUpper, CameraResolution::defaultRes);
+  else if(reduced && theRobotHealth.cpuTemperature < restoreTemperature && !throttled)
+    reduced = !cameraResolutionRequest.setRequest(CameraResolution::defaultRes, CameraResolution::defaultRes);
+}
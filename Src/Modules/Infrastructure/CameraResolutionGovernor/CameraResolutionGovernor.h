@@ -0,0 +1,37 @@
+/**
+ * @file Modules/Infrastructure/CameraResolutionGovernor/CameraResolutionGovernor.h
+ * This file declares a module that reduces the resolution of the upper camera
+ * when the cpu gets hot, before it throttles itself.
+ */
+
+#pragma once
+
+#include "Tools/Module/Module.h"
+#include "Representations/Infrastructure/CameraResolution.h"
+#include "Representations/Infrastructure/RobotHealth.h"
+
+MODULE(CameraResolutionGovernor,
+{,
+  REQUIRES(RobotHealth),
+  PROVIDES(CameraResolutionRequest),
+  DEFINES_PARAMETERS(
+  {,
+    (unsigned char)(85) reduceTemperature, /**< The cpu temperature (in °C) at which the resolution is reduced. */
+    (unsigned char)(75) restoreTemperature, /**< The cpu temperature (in °C) below which the configured resolution is restored. */
+    (unsigned short)(0) throttledFrequency, /**< The cpu clock (in MHz) below which the cpu counts as throttled. 0 ignores the clock. */
+    ((CameraResolution) Resolutions)(CameraResolution::w320h240) reducedResolutionUpper, /**< The resolution of the upper camera while the cpu is hot. */
+  }),
+});
+
+/**
+ * @class CameraResolutionGovernor
+ * Requests a lower resolution of the upper camera while the cpu is hot or
+ * throttled and restores the configured one after it cooled down. The current
+ * state can be read from the CameraResolutionRequest.
+ */
+class CameraResolutionGovernor : public CameraResolutionGovernorBase
+{
+  bool reduced = false; /**< Is the reduced resolution currently requested? */
+
+  void update(CameraResolutionRequest& cameraResolutionRequest);
+};
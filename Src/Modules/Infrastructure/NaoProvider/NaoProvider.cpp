@@ -147,9 +147,10 @@ void NaoProvider::update(FrameInfo& frameInfo)
 {
   frameInfo.time = std::max(frameInfo.time + 1, Time::getCurrentSystemTime());
 
-  if(gameControlData.packetNumber != naoBody.getGameControlData().packetNumber)
+  const uint8_t packetNumber = gameControlData.packetNumber;
+  naoBody.getGameControlData(gameControlData);
+  if(gameControlData.packetNumber != packetNumber)
     gameControlTimeStamp = frameInfo.time;
-  gameControlData = naoBody.getGameControlData();
 }
 
 void NaoProvider::update(FsrSensorData& fsrSensorData)
@@ -179,6 +180,15 @@ void NaoProvider::update(InertialSensorData& inertialSensorData)
 
   inertialSensorData.angle.x() = sensors[angleXSensor];
   inertialSensorData.angle.y() = sensors[angleYSensor];
+
+  // The samples of the skipped frames use the same layout and signs as the current one.
+  float samples[InertialSensorData::maxNumOfPreviousSamples][NaoBody::numOfInertialValues];
+  inertialSensorData.numOfPreviousSamples = static_cast<unsigned char>(naoBody.getPreviousInertialSamples(samples[0], InertialSensorData::maxNumOfPreviousSamples));
+  for(unsigned i = 0; i < inertialSensorData.numOfPreviousSamples; ++i)
+  {
+    inertialSensorData.previousGyros[i] = Vector3a(samples[i][gyroXSensor - gyroXSensor], samples[i][gyroYSensor - gyroXSensor], -samples[i][gyroZSensor - gyroXSensor]);
+    inertialSensorData.previousAccs[i] = Vector3f(-samples[i][accXSensor - gyroXSensor], samples[i][accYSensor - gyroXSensor], -samples[i][accZSensor - gyroXSensor]);
+  }
 }
 
 void NaoProvider::update(JointSensorData& jointSensorData)
@@ -214,6 +224,23 @@ void NaoProvider::update(KeyStates& keyStates)
     keyStates.pressed[i] = sensors[j] != 0;
 }
 
+void NaoProvider::update(MotionCycleTiming& motionCycleTiming)
+{
+  motionCycleTiming.waitTime = naoBody.getWaitTime();
+  motionCycleTiming.sensorAge = naoBody.getSensorAge();
+  motionCycleTiming.computeTime = naoBody.getComputeTime();
+  MotionCycleTiming::add(motionCycleTiming.waitTimes, motionCycleTiming.waitTime);
+  if(motionCycleTiming.computeTime) // nothing was sent before the first frame
+    MotionCycleTiming::add(motionCycleTiming.computeTimes, motionCycleTiming.computeTime);
+
+  const volatile unsigned* latencies = naoBody.getDCMTiming(motionCycleTiming.dcmCycles,
+                                                            motionCycleTiming.missedActuatorCycles,
+                                                            motionCycleTiming.droppedSensorCycles);
+  static_assert(MotionCycleTiming::numOfBins == lbhNumOfTimingBins, "Histogram sizes do not match");
+  for(int i = 0; i < MotionCycleTiming::numOfBins; ++i)
+    motionCycleTiming.latencies[i] = latencies[i];
+}
+
 void NaoProvider::update(OpponentTeamInfo& opponentTeamInfo)
 {
   (RoboCup::TeamInfo&) opponentTeamInfo = gameControlData.teams[gameControlData.teams[0].teamNumber == Global::getSettings().teamNumber ? 1 : 0];
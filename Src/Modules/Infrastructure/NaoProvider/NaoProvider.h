@@ -16,6 +16,7 @@
 #include "Representations/Infrastructure/JointAngles.h"
 #include "Representations/Infrastructure/JointRequest.h"
 #include "Representations/Infrastructure/LEDRequest.h"
+#include "Representations/Infrastructure/MotionCycleTiming.h"
 #include "Representations/Infrastructure/RobotInfo.h"
 #include "Representations/Infrastructure/SensorData/FsrSensorData.h"
 #include "Representations/Infrastructure/SensorData/InertialSensorData.h"
@@ -38,6 +39,7 @@ MODULE(NaoProvider,
   PROVIDES(InertialSensorData),
   PROVIDES(JointSensorData),
   PROVIDES(KeyStates),
+  PROVIDES(MotionCycleTiming),
   PROVIDES(OpponentTeamInfo),
   PROVIDES(OwnTeamInfo),
   PROVIDES(RawGameInfo),
@@ -78,6 +80,7 @@ private:
   void update(InertialSensorData& inertialSensorData);
   void update(JointSensorData& jointSensorData);
   void update(KeyStates& keyStates);
+  void update(MotionCycleTiming& motionCycleTiming);
   void update(OpponentTeamInfo& opponentTeamInfo);
   void update(OwnTeamInfo& ownTeamInfo);
   void update(RawGameInfo& rawGameInfo);
@@ -99,6 +102,7 @@ private:
   void update(InertialSensorData& inertialSensorData) {}
   void update(JointSensorData& jointSensorData) {}
   void update(KeyStates& keyStates) {}
+  void update(MotionCycleTiming& motionCycleTiming) {}
   void update(OpponentTeamInfo& opponentTeamInfo) {}
   void update(OwnTeamInfo& ownTeamInfo) {}
   void update(RawGameInfo& rawGameInfo) {}
@@ -19,5 +19,7 @@ void MotionRobotHealthProvider::update(MotionRobotHealth& motionRobotHealth)
   motionRobotHealth.avgMotionTime = float(timeBuffer.average());
   motionRobotHealth.maxMotionTime = float(timeBuffer.maximum());
   motionRobotHealth.minMotionTime = float(timeBuffer.minimum());
+  motionRobotHealth.missedActuatorCycles = theMotionCycleTiming.missedActuatorCycles;
+  motionRobotHealth.droppedSensorCycles = theMotionCycleTiming.droppedSensorCycles;
   lastExecutionTime = now;
 }
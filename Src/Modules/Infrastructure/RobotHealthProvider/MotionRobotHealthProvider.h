@@ -8,10 +8,12 @@
 
 #include "Tools/Module/Module.h"
 #include "Tools/RingBufferWithSum.h"
+#include "Representations/Infrastructure/MotionCycleTiming.h"
 #include "Representations/Infrastructure/RobotHealth.h"
 
 MODULE(MotionRobotHealthProvider,
 {,
+  USES(MotionCycleTiming),
   PROVIDES(MotionRobotHealth),
 });
 
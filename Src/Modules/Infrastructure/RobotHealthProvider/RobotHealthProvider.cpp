@@ -11,8 +11,12 @@
 #include "Tools/Streams/InStreams.h"
 
 #include <algorithm>
+#include <fstream>
 #include <iterator>
 #include <numeric>
+#ifdef TARGET_ROBOT
+#include <sys/resource.h>
+#endif
 
 void RobotHealthProvider::update(RobotHealth& robotHealth)
 {
@@ -47,6 +51,25 @@ void RobotHealthProvider::update(RobotHealth& robotHealth)
 
   if(theFrameInfo.getTimeSince(lastRelaxedHealthComputation) > 5000)
   {
+#ifdef TARGET_ROBOT
+    // CPU clock and the counters of the whole process that indicate jitter
+    std::ifstream frequencyFile("/sys/devices/system/cpu/cpu0/cpufreq/scaling_cur_freq");
+    unsigned frequency = 0;
+    if(frequencyFile >> frequency)
+      robotHealth.cpuFrequency = static_cast<unsigned short>(frequency / 1000);
+    rusage usage;
+    if(!getrusage(RUSAGE_SELF, &usage))
+    {
+      const float seconds = static_cast<float>(theFrameInfo.getTimeSince(lastRelaxedHealthComputation)) / 1000.f;
+      if(lastPageFaults >= 0)
+      {
+        robotHealth.pageFaults = static_cast<unsigned short>(std::min(65535.f, static_cast<float>(usage.ru_majflt - lastPageFaults) / seconds));
+        robotHealth.contextSwitches = static_cast<unsigned short>(std::min(65535.f, static_cast<float>(usage.ru_nivcsw - lastContextSwitches) / seconds));
+      }
+      lastPageFaults = usage.ru_majflt;
+      lastContextSwitches = usage.ru_nivcsw;
+    }
+#endif
     lastRelaxedHealthComputation = theFrameInfo.time;
 
     // transfer maximal temperature, battery level and total current from SensorData:
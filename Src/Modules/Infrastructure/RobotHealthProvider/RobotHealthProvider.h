@@ -53,6 +53,8 @@ class RobotHealthProvider : public RobotHealthProviderBase
 #ifdef TARGET_ROBOT
   NaoBody naoBody;
   unsigned int lastWlanCheckedTime = 0;
+  long lastPageFaults = -1; /**< Major page faults of the process at the last relaxed health computation. */
+  long lastContextSwitches = -1; /**< Involuntary context switches of the process at the last relaxed health computation. */
 #endif
 
   /** The main function, called every cycle
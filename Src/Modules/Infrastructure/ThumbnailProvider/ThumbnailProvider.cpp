@@ -5,6 +5,7 @@
 
 #include "ThumbnailProvider.h"
 #include "Platform/BHAssert.h"
+#include "Tools/ImageProcessing/AVX.h"
 #include "Tools/ImageProcessing/Resize.h"
 
 MAKE_MODULE(ThumbnailProvider, cognitionInfrastructure)
@@ -19,12 +20,21 @@ void ThumbnailProvider::update(Thumbnail& thumbnail)
   {
     if(downScales == 0)
     {
+      theECImage.prepareAll();
       thumbnail.imageGrayscale = theECImage.grayscaled;
       thumbnail.imageU = theECImage.ued;
       thumbnail.imageV = theECImage.ved;
     }
+    else if(theImagePyramid.timeStamp == theECImage.timeStamp && static_cast<unsigned>(downScales) <= theImagePyramid.numOfLevels()
+            && theImagePyramid.hasColorChannels())
+    {
+      thumbnail.imageGrayscale = theImagePyramid.getGrayscale(downScales);
+      thumbnail.imageU = theImagePyramid.getU(downScales);
+      thumbnail.imageV = theImagePyramid.getV(downScales);
+    }
     else
     {
+      theECImage.prepareAll();
       Resize::shrinkGrayscaleNxN(theECImage.grayscaled, thumbnail.imageGrayscale, downScales);
       Resize::shrinkColorChannelNxN(theECImage.ued, thumbnail.imageU, downScales);
       Resize::shrinkColorChannelNxN(theECImage.ved, thumbnail.imageV, downScales);
@@ -32,7 +42,7 @@ void ThumbnailProvider::update(Thumbnail& thumbnail)
   }
   else
   {
-    switch(thumbnail.scale)
+    switch(simdSupported() ? thumbnail.scale : 0)
     {
       case 8:
         Resize::shrink8x8SSE(theImage, thumbnail.image);
@@ -8,11 +8,13 @@
 #include "Representations/Infrastructure/CameraInfo.h"
 #include "Representations/Infrastructure/Thumbnail.h"
 #include "Representations/Perception/ImagePreprocessing/ECImage.h"
+#include "Representations/Perception/ImagePreprocessing/ImagePyramid.h"
 
 MODULE(ThumbnailProvider,
 {,
   REQUIRES(Image),
   REQUIRES(ECImage),
+  USES(ImagePyramid),
   REQUIRES(CameraInfo),
   PROVIDES_WITHOUT_MODIFY(Thumbnail),
   LOADS_PARAMETERS(
@@ -106,8 +106,15 @@ struct BallHypothesis
     }
   }
 
+  /**
+   * Integrates a measurement of the ball position. As only the position is measured,
+   * the measurement matrix just selects the first two rows of the state. Therefore,
+   * the corresponding blocks are used directly instead of multiplying with it.
+   * @param measurement The measured ball position.
+   * @param measurementCov The covariance of the measurement.
+   * @param theBallPercept The ball percept the measurement is based on.
+   */
   void sensorUpdate(const Vector2f& measurement, const Matrix2f& measurementCov,
-                    const Matrix2x4f& c, const Matrix4x2f& cTransposed,
                     const BallPercept& theBallPercept)
   {
     if(type == BallHypothesis::moving)
@@ -129,13 +136,13 @@ struct BallHypothesis
       height = weight * BallLocatorTools::getProbabilityAtMean(cov.topLeftCorner(2, 2));
       age++;
 
-      Matrix2f covPlusSensorCov = c * cov * cTransposed;
+      Matrix2f covPlusSensorCov = cov.topLeftCorner<2, 2>();
       covPlusSensorCov += measurementCov;
-      Matrix4x2f k = cov * cTransposed * covPlusSensorCov.inverse();
-      Vector2f innovation = measurement - c * x;
-      Vector4f correction = k * innovation;
-      x += correction;
-      cov -= k * c * cov;
+      const Matrix4x2f k = cov.leftCols<2>() * covPlusSensorCov.inverse();
+      const Vector2f innovation = measurement - x.head<2>();
+      x.noalias() += k * innovation;
+      const Matrix2x4f covTopRows = cov.topRows<2>();
+      cov.noalias() -= k * covTopRows;
     }
     else // type == State::stationary
     {
@@ -392,13 +392,10 @@ void BallLocator::handleCollisionWithFeet(const Vector2f& leftFootCenter, const
 
 void BallLocator::sensorUpdate(const Vector2f& measurement, const Matrix2f& measurementCov)
 {
-  static const Matrix2x4f c = Matrix2x4f::Identity();
-  static const Matrix4x2f cTransposed = c.transpose();
-
   COVARIANCE2D("module:BallLocator:field", measurementCov, measurement);
 
   for(BallHypothesis* state = states, *end = states + stateCount; state < end; ++state)
-    state->sensorUpdate(measurement, measurementCov, c, cTransposed, theBallPercept);
+    state->sensorUpdate(measurement, measurementCov, theBallPercept);
 }
 
 void BallLocator::normalizeWeights(BallHypothesis*& bestState, BallHypothesis*& worstStationaryState, BallHypothesis*& worstMovingState)
@@ -452,9 +449,9 @@ void BallLocator::normalizeWeights(BallHypothesis*& bestState, BallHypothesis*&
 void BallLocator::createNewStates(const Vector2f& ballPercept, const float ballPerceptRadius, const Matrix2f& ballPerceptCov, BallHypothesis* worstStationaryState, BallHypothesis* worstMovingState)
 {
   // create new fixed state
-  ASSERT(worstStationaryState || stateCount < sizeof(states) / sizeof(*states));
+  ASSERT(worstStationaryState || stateCount < maxNumOfStates);
   BallHypothesis* newState = worstStationaryState;
-  if(stateCount < sizeof(states) / sizeof(*states))
+  if(stateCount < maxNumOfStates)
     newState = &states[stateCount++];
   ASSERT(newState);
   newState->type = BallHypothesis::stationary;
@@ -468,9 +465,9 @@ void BallLocator::createNewStates(const Vector2f& ballPercept, const float ballP
   // create new moving state
   if(hasLastBallPercept)
   {
-    ASSERT(worstMovingState || stateCount < sizeof(states) / sizeof(*states));
+    ASSERT(worstMovingState || stateCount < maxNumOfStates);
     BallHypothesis* newState = worstMovingState;
-    if(stateCount < sizeof(states) / sizeof(*states))
+    if(stateCount < maxNumOfStates)
       newState = &states[stateCount++];
     ASSERT(newState);
     newState->type = BallHypothesis::moving;
@@ -100,7 +100,8 @@ private:
 
   float deltaTime; /**< Time difference in seconds to previous image */
 
-  BallHypothesis states[12];
+  enum {maxNumOfStates = 12}; /**< The capacity of the fixed pool of hypotheses. */
+  BallHypothesis states[maxNumOfStates]; /**< The pool of hypotheses. The first stateCount entries are in use. */
   unsigned int stateCount;
   BallHypothesis* bestState = nullptr;
 
@@ -31,16 +31,13 @@ void FieldCoverageProvider::update(FieldCoverage& fieldCoverage)
     {
       InternalCell& c = cells[i];
       const Vector2f positionRelative = theRobotPose.inversePose * c.positionOnField;
-      const Angle angle = positionRelative.angle();
+      const float sqrDistance = positionRelative.squaredNorm();
+      if(sqrDistance >= sqrBallVisibilityRange) // cheaper than computing the angle first
+        continue;
 
-      if(angleLeft > angle && angle > angleRight)
-      {
-        const float sqrDistance = positionRelative.squaredNorm();
-        if(sqrDistance < sqrBallVisibilityRange && !isViewBlocked(angle, sqrDistance))
-        {
-          c.timestamp = theFrameInfo.time;
-        }
-      }
+      const Angle angle = positionRelative.angle();
+      if(angleLeft > angle && angle > angleRight && !isViewBlocked(angle, sqrDistance))
+        c.timestamp = theFrameInfo.time;
     }
     nextLineToCalculate = (nextLineToCalculate + 1) % numOfCellsY;
   }
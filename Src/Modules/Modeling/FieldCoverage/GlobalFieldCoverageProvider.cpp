@@ -21,11 +21,10 @@ void GlobalFieldCoverageProvider::update(GlobalFieldCoverage& globalFieldCoverag
 
   if(theCognitionStateChanges.lastGameState != STATE_SET && theGameInfo.state == STATE_SET)
   {
-    const int min = -static_cast<int>(Vector2f(theFieldDimensions.xPosOpponentGroundline, theFieldDimensions.yPosLeftSideline).squaredNorm()) / 1000;
     for(size_t i = 0; i < globalFieldCoverage.grid.size(); ++i)
     {
       globalFieldCoverage.grid[i].timestamp = theFrameInfo.time;
-      globalFieldCoverage.grid[i].coverage = min + static_cast<int>(globalFieldCoverage.grid[i].positionOnField.squaredNorm()) / 1000;
+      globalFieldCoverage.grid[i].coverage = resetCoverage[i];
     }
   }
 
@@ -45,7 +44,7 @@ void GlobalFieldCoverageProvider::update(GlobalFieldCoverage& globalFieldCoverag
 
   for(size_t y = 0; y < theFieldCoverage.lines.size(); ++y)
     addLine(theFieldCoverage.lines[y]);
-  for(const auto teammate : theTeamData.teammates)
+  for(const auto& teammate : theTeamData.teammates)
     if(!teammate.theFieldCoverage.lines.empty() && teammate.mateType == Teammate::TeamOrigin::BHumanRobot)
       addLine(teammate.theFieldCoverage.lines.back());
 
@@ -95,8 +94,6 @@ void GlobalFieldCoverageProvider::accountForBallDropIn(GlobalFieldCoverage& glob
     const Vector2i dropInCell(static_cast<int>((globalFieldCoverage.ballDropInPosition.x() - theFieldDimensions.xPosOwnGroundline) / cellLengthX),
                               static_cast<int>((globalFieldCoverage.ballDropInPosition.y() - theFieldDimensions.yPosRightSideline) / cellLengthY));
 
-    const int min = -static_cast<int>(Vector2f(theFieldDimensions.xPosOpponentGroundline, theFieldDimensions.yPosLeftSideline).squaredNorm()) / 1000;
-
     const int yOtherLine = numOfCellsY - 1 - dropInCell.y();
 
     const int otherLineTime = -sqr(6000) / 1000;
@@ -125,7 +122,7 @@ void GlobalFieldCoverageProvider::accountForBallDropIn(GlobalFieldCoverage& glob
         for(int x = 0; x < numOfCellsX; ++x)
         {
           globalFieldCoverage.grid[y * numOfCellsX + x].timestamp = theFrameInfo.time;
-          globalFieldCoverage.grid[y * numOfCellsX + x].coverage = min + static_cast<int>(globalFieldCoverage.grid[y * numOfCellsX + x].positionOnField.squaredNorm()) / 1000;
+          globalFieldCoverage.grid[y * numOfCellsX + x].coverage = resetCoverage[y * numOfCellsX + x];
         }
       }
     }
@@ -190,4 +187,10 @@ void GlobalFieldCoverageProvider::init(GlobalFieldCoverage& globalFieldCoverage)
     positionOnFieldX = theFieldDimensions.xPosOwnGroundline + cellLengthX / 2.f;
     positionOnFieldY += cellLengthY;
   }
+
+  const int min = -static_cast<int>(Vector2f(theFieldDimensions.xPosOpponentGroundline, theFieldDimensions.yPosLeftSideline).squaredNorm()) / 1000;
+  resetCoverage.clear();
+  resetCoverage.reserve(globalFieldCoverage.grid.size());
+  for(const GlobalFieldCoverage::Cell& cell : globalFieldCoverage.grid)
+    resetCoverage.push_back(min + static_cast<int>(cell.positionOnField.squaredNorm()) / 1000);
 }
@@ -55,6 +55,7 @@ public:
 private:
   float cellLengthX;
   float cellLengthY;
+  std::vector<int> resetCoverage; /**< The coverage per cell after a reset. It rises with the distance to the field center. */
 
   unsigned lastTimeBallWentOut = 0;
   Vector2f ballOutPosition = Vector2f::Zero();
@@ -0,0 +1,73 @@
+/**
+ * @file LatencyCompensator.cpp
+ *
+ * This file implements a module that predicts the outputs of the modeling modules
+ * to the point of time when the motion requested in this frame will actually be
+ * executed.
+ */
+
+#include "LatencyCompensator.h"
+#include "Tools/Modeling/BallPhysics.h"
+
+MAKE_MODULE(LatencyCompensator, modeling)
+
+void LatencyCompensator::update(LatencyCompensatedWorldModel& latencyCompensatedWorldModel)
+{
+  updateSpeed();
+
+  const float t = static_cast<float>(latency) / 1000.f;
+  latencyCompensatedWorldModel.time = theFrameInfo.time + latency;
+
+  // Extrapolate the own motion, assuming that the current speed is kept.
+  const Pose2f& offset = latencyCompensatedWorldModel.odometryOffset = Pose2f(speed.rotation * t, speed.translation * t);
+  const Pose2f inverseOffset = offset.inverse();
+  latencyCompensatedWorldModel.robotPose = theRobotPose + offset;
+
+  // The ball follows the ball physics and is then transformed into the predicted robot coordinates.
+  latencyCompensatedWorldModel.ballIsValid = theFrameInfo.getTimeSince(theBallModel.timeWhenLastSeen) <= ballValidityTimeout;
+  if(latencyCompensatedWorldModel.ballIsValid)
+  {
+    Vector2f position = theBallModel.estimate.position;
+    Vector2f velocity = theBallModel.estimate.velocity;
+    BallPhysics::propagateBallPositionAndVelocity(position, velocity, t, theBallSpecification.friction);
+    latencyCompensatedWorldModel.ballPosition = inverseOffset * position;
+    latencyCompensatedWorldModel.ballVelocity = velocity.rotate(-offset.rotation);
+  }
+
+  // The team ball is in field coordinates. Therefore, only the ball physics is applied.
+  latencyCompensatedWorldModel.teamBallIsValid = theTeamBallModel.isValid;
+  if(theTeamBallModel.isValid)
+  {
+    latencyCompensatedWorldModel.teamBallPosition = theTeamBallModel.position;
+    latencyCompensatedWorldModel.teamBallVelocity = theTeamBallModel.velocity;
+    BallPhysics::propagateBallPositionAndVelocity(latencyCompensatedWorldModel.teamBallPosition,
+                                                  latencyCompensatedWorldModel.teamBallVelocity,
+                                                  t, theBallSpecification.friction);
+  }
+
+  // Obstacles keep their estimated velocity (in mm/ms) and are then transformed into the predicted robot coordinates.
+  latencyCompensatedWorldModel.obstacles = theObstacleModel.obstacles;
+  for(Obstacle& obstacle : latencyCompensatedWorldModel.obstacles)
+  {
+    const Vector2f motion = obstacle.velocity * static_cast<float>(latency);
+    obstacle.center = inverseOffset * (obstacle.center + motion);
+    obstacle.left = inverseOffset * (obstacle.left + motion);
+    obstacle.right = inverseOffset * (obstacle.right + motion);
+    obstacle.velocity.rotate(-offset.rotation);
+  }
+}
+
+void LatencyCompensator::updateSpeed()
+{
+  if(lastTime != 0 && theFrameInfo.time > lastTime && theFrameInfo.getTimeSince(lastTime) <= maxTimeBetweenFrames)
+  {
+    const float dt = static_cast<float>(theFrameInfo.getTimeSince(lastTime)) / 1000.f;
+    const Pose2f offset = Pose2f(theOdometryData) - lastOdometryData;
+    speed.translation += (offset.translation / dt - speed.translation) * speedFilterFactor;
+    speed.rotation = speed.rotation + (offset.rotation / dt - speed.rotation) * speedFilterFactor;
+  }
+  else if(lastTime == 0 || theFrameInfo.time != lastTime)
+    speed = Pose2f();
+  lastOdometryData = theOdometryData;
+  lastTime = theFrameInfo.time;
+}
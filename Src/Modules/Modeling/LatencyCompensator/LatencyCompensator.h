@@ -0,0 +1,55 @@
+/**
+ * @file LatencyCompensator.h
+ *
+ * This file declares a module that predicts the outputs of the modeling modules
+ * to the point of time when the motion requested in this frame will actually be
+ * executed. The robot's own motion is extrapolated from the recent odometry.
+ * The ball additionally follows the ball physics.
+ */
+
+#pragma once
+
+#include "Representations/Configuration/BallSpecification.h"
+#include "Representations/Infrastructure/FrameInfo.h"
+#include "Representations/Modeling/BallModel.h"
+#include "Representations/Modeling/LatencyCompensatedWorldModel.h"
+#include "Representations/Modeling/ObstacleModel.h"
+#include "Representations/Modeling/RobotPose.h"
+#include "Representations/Modeling/TeamBallModel.h"
+#include "Representations/MotionControl/OdometryData.h"
+#include "Tools/Module/Module.h"
+
+MODULE(LatencyCompensator,
+{,
+  REQUIRES(BallModel),
+  REQUIRES(BallSpecification),
+  REQUIRES(FrameInfo),
+  REQUIRES(ObstacleModel),
+  REQUIRES(OdometryData),
+  REQUIRES(RobotPose),
+  REQUIRES(TeamBallModel),
+  PROVIDES(LatencyCompensatedWorldModel),
+  DEFINES_PARAMETERS(
+  {,
+    (int)(80) latency,                  /**< The time between taking an image and executing the motion request based on it (in ms). */
+    (float)(0.3f) speedFilterFactor,    /**< How much does a new odometry measurement change the estimated speed (0..1)? */
+    (int)(500) maxTimeBetweenFrames,    /**< If frames are farther apart, the speed estimate is reset (in ms). */
+    (int)(1000) ballValidityTimeout,    /**< The ball is only predicted if it was seen within this time (in ms). */
+  }),
+});
+
+class LatencyCompensator : public LatencyCompensatorBase
+{
+  Pose2f lastOdometryData; /**< The odometry of the previous frame. */
+  unsigned lastTime = 0; /**< The time of the previous frame. 0 if there was none. */
+  Pose2f speed; /**< The filtered speed of the robot (in mm/s and radians/s). */
+
+  /**
+   * Updates the latency compensated world model.
+   * @param latencyCompensatedWorldModel The representation updated.
+   */
+  void update(LatencyCompensatedWorldModel& latencyCompensatedWorldModel);
+
+  /** Updates the estimate of the robot's speed from the odometry since the previous frame. */
+  void updateSpeed();
+};
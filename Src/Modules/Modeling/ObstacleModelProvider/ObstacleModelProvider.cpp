@@ -295,6 +295,9 @@ void ObstacleModelProvider::tryToMerge(const InternalObstacle& measurement)
   }
   float distanceSquared = 0.f;
   const float thisMergeDistance = measurement.type == Obstacle::goalpost ? goalMergeDistance : mergeDistance;
+  const float mergeBonsu = (measurement.center.squaredNorm() / sqr(1000.f));
+  const float robotDepths = (mergeBonsu >= 2.f && mergeBonsu <= 6.f ? std::floor(mergeBonsu) : 0.f) * Obstacle::getRobotDepth(); //for every meter there is a bonus of a robot radius in mm
+  const float mergeDistanceSquared = sqr(robotDepths + thisMergeDistance);
   float possibleMergeDistSquared = maxDistOnFieldSquared;
   size_t atMerge = 0; //element matching the merge condition
   size_t noEKF = std::numeric_limits<size_t>::max(); //hopefully, this is not reached
@@ -302,9 +305,6 @@ void ObstacleModelProvider::tryToMerge(const InternalObstacle& measurement)
   {
     if(merged[i])
       continue;
-    const float mergeBonsu = (measurement.center.squaredNorm() / sqr(1000.f));
-    const float robotDepths = (mergeBonsu >= 2.f && mergeBonsu <= 6.f ? std::floor(mergeBonsu) : 0.f) * Obstacle::getRobotDepth(); //for every meter there is a bonus of a robot radius in mm
-    const float mergeDistanceSquared = sqr(robotDepths + thisMergeDistance);
     distanceSquared = (measurement.center - iWantToBeAnObstacle[i].center).squaredNorm();
     if(distanceSquared <= mergeDistanceSquared && distanceSquared <= possibleMergeDistSquared) //found probably matching obstacle
     {
@@ -343,15 +343,27 @@ void ObstacleModelProvider::mergeOverlapping()
 {
   if(iWantToBeAnObstacle.size() < 2)
     return;
+
+  // Obstacles merged into others are only flagged here and removed in a single pass at the end.
+  // Otherwise, each merge would move all obstacles behind the one removed.
+  halfWidthsSquared.resize(iWantToBeAnObstacle.size());
+  for(size_t i = 0; i < iWantToBeAnObstacle.size(); ++i)
+    halfWidthsSquared[i] = ((iWantToBeAnObstacle[i].left - iWantToBeAnObstacle[i].right) * .5f).squaredNorm();
+  removed.assign(iWantToBeAnObstacle.size(), false);
+  bool anyRemoved = false;
   for(size_t i = 0; i < iWantToBeAnObstacle.size(); ++i)
   {
+    if(removed[i])
+      continue;
     for(size_t j = iWantToBeAnObstacle.size() - 1; j > i; --j)
     {
+      if(removed[j])
+        continue;
       //seen in this frame (obviously should not merged) and due to oscillating obstacles should also not merged
       if((iWantToBeAnObstacle[i].lastSeen + frameTimeDiff >= theFrameInfo.time && iWantToBeAnObstacle[j].lastSeen + frameTimeDiff >= theFrameInfo.time)
          || (std::max(iWantToBeAnObstacle[i].lastSeen, iWantToBeAnObstacle[j].lastSeen) - std::min(iWantToBeAnObstacle[i].lastSeen, iWantToBeAnObstacle[j].lastSeen) < mergeOverlapTimeDiff))
         continue;
-      const float overlapSquared = ((iWantToBeAnObstacle[i].left - iWantToBeAnObstacle[i].right) * .5f).squaredNorm() + ((iWantToBeAnObstacle[j].left - iWantToBeAnObstacle[j].right) * .5f).squaredNorm();
+      const float overlapSquared = halfWidthsSquared[i] + halfWidthsSquared[j];
       const float distanceOfCentersSquared = (iWantToBeAnObstacle[j].center - iWantToBeAnObstacle[i].center).squaredNorm();
       if(((distanceOfCentersSquared <= overlapSquared || distanceOfCentersSquared < sqr(2 * Obstacle::getRobotDepth())) &&
           ((iWantToBeAnObstacle[i].type >= Obstacle::unknown && iWantToBeAnObstacle[j].type >= Obstacle::unknown)
@@ -364,11 +376,26 @@ void ObstacleModelProvider::mergeOverlapping()
         iWantToBeAnObstacle[i].lastSeen = std::max(iWantToBeAnObstacle[i].lastSeen, iWantToBeAnObstacle[j].lastSeen);
         iWantToBeAnObstacle[i].seenCount = std::max(iWantToBeAnObstacle[i].seenCount, iWantToBeAnObstacle[j].seenCount);
         iWantToBeAnObstacle[i].notSeenButShouldSeenCount = iWantToBeAnObstacle[i].notSeenButShouldSeenCount + iWantToBeAnObstacle[j].notSeenButShouldSeenCount / 2;
+        halfWidthsSquared[i] = ((iWantToBeAnObstacle[i].left - iWantToBeAnObstacle[i].right) * .5f).squaredNorm();
 
-        iWantToBeAnObstacle.erase(iWantToBeAnObstacle.begin() + j);
+        removed[j] = true;
+        anyRemoved = true;
       }
     }
   }
+
+  if(anyRemoved)
+  {
+    size_t numOfKept = 0;
+    for(size_t i = 0; i < iWantToBeAnObstacle.size(); ++i)
+      if(!removed[i])
+      {
+        if(numOfKept != i)
+          iWantToBeAnObstacle[numOfKept] = iWantToBeAnObstacle[i];
+        ++numOfKept;
+      }
+    iWantToBeAnObstacle.erase(iWantToBeAnObstacle.begin() + numOfKept, iWantToBeAnObstacle.end());
+  }
 }
 
 void ObstacleModelProvider::considerTeammates()
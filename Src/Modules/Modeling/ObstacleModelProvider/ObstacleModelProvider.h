@@ -132,6 +132,8 @@ private:
 
   std::vector<InternalObstacle, Eigen::aligned_allocator<InternalObstacle>> iWantToBeAnObstacle; /**< List of obstacles. */
   std::vector<bool> merged; /**< This is to merge obstacles once for every "percept" per frame */
+  std::vector<bool> removed; /**< Obstacles that were merged into others by mergeOverlapping(). */
+  std::vector<float> halfWidthsSquared; /**< The squared half widths of the obstacles while merging overlapping ones. */
 
   float odometryNoiseX, odometryNoiseY;
   float odometryRotation;
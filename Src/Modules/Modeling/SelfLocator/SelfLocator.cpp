@@ -348,13 +348,15 @@ void SelfLocator::sensorUpdate()
   bool useLines = true;
   bool useLandmarks = true;
   bool usePoses = true;
+  bool cacheRegistrations = true;
   MODIFY("module:SelfLocator:useLines", useLines);
   MODIFY("module:SelfLocator:useLandmarks", useLandmarks);
   MODIFY("module:SelfLocator:usePoses", usePoses);
+  MODIFY("module:SelfLocator:cacheRegistrations", cacheRegistrations);
   for(int i = 0; i < numberOfSamples; ++i)
   {
     const Pose2f samplePose = samples->at(i).getPose();
-    perceptRegistration.update(samplePose, registeredPercepts, inverseCameraMatrix, currentRotationDeviation);
+    perceptRegistration.update(samplePose, registeredPercepts, inverseCameraMatrix, currentRotationDeviation, cacheRegistrations);
     if(usePoses)
       for(const auto& pose : registeredPercepts.poses)
         samples->at(i).updateByPose(pose, theCameraMatrix, inverseCameraMatrix, currentRotationDeviation, theFieldDimensions);
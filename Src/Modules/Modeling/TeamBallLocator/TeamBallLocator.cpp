@@ -78,15 +78,7 @@ void TeamBallLocator::updateBalls()
   // I have new ball information!
   unsigned i = theRobotInfo.number;
   if(balls[i].size() == 0 || balls[i][0].time != theBallModel.timeWhenLastSeen)
-  {
-    Ball newBall;
-    newBall.robotPose           = theRobotPose;
-    newBall.pos                 = theBallModel.estimate.position;
-    newBall.vel                 = theBallModel.estimate.velocity;
-    newBall.time                = theBallModel.timeWhenLastSeen;
-    newBall.valid = true;
-    balls[i].push_front(newBall);
-  }
+    addBall(balls[i], theRobotPose, theBallModel);
   // Observations by teammates:
   for(auto const& teammate : theTeamData.teammates)
   {
@@ -97,15 +89,7 @@ void TeamBallLocator::updateBalls()
        teammate.theBallModel.lastPerception != Vector2f::Zero() &&
        teammate.theBallModel.estimate.position != Vector2f::Zero() &&
        !ballIsNearOtherTeammate(teammate))
-    {
-      Ball newBall;
-      newBall.robotPose           = teammate.theRobotPose;
-      newBall.pos                 = teammate.theBallModel.estimate.position;
-      newBall.vel                 = teammate.theBallModel.estimate.velocity;
-      newBall.time                = teammate.theBallModel.timeWhenLastSeen;
-      newBall.valid = true;
-      balls[teammate.number].push_front(newBall);
-    }
+      addBall(balls[teammate.number], teammate.theRobotPose, teammate.theBallModel);
   }
   // If any teammate is not PLAYING anymore, invalidate the observations that happened during the time
   // before the status changed:
@@ -135,6 +119,28 @@ void TeamBallLocator::updateBalls()
   }
 }
 
+void TeamBallLocator::addBall(RingBuffer<Ball, BALL_BUFFER_LENGTH>& buffer, const Pose2f& robotPose, const BallModel& ballModel)
+{
+  Ball newBall;
+  newBall.robotPose           = robotPose;
+  newBall.pos                 = ballModel.estimate.position;
+  newBall.vel                 = ballModel.estimate.velocity;
+  newBall.time                = ballModel.timeWhenLastSeen;
+  newBall.valid = true;
+  newBall.absPos = robotPose * newBall.pos;
+  newBall.absVel = newBall.vel;
+  newBall.absVel.rotate(robotPose.rotation);
+
+  const float camHeight = 550.f;
+  const float angleOfCamera = std::atan(newBall.pos.norm() / camHeight); // angle of camera when looking at the ball
+  const float ballPositionWithPositiveDeviation = std::tan(angleOfCamera + 1_deg) * camHeight; // ball position when angle of camera is a bit different in position direction
+  const float ballPositionWithNegativeDeviation = std::tan(angleOfCamera - 1_deg) * camHeight; // ball position when angle of camera is a bit different in negative direction
+  const float ballDeviation = (ballPositionWithNegativeDeviation - ballPositionWithPositiveDeviation) / 2; // averaged deviation of the ball position
+  newBall.distanceWeighting = 1.0f / ballDeviation;
+
+  buffer.push_front(newBall);
+}
+
 bool TeamBallLocator::ballIsNearOtherTeammate(const Teammate& teammate)
 {
   Vector2f teammateGlobalBallPos = teammate.theRobotPose * teammate.theBallModel.estimate.position;
@@ -176,9 +182,8 @@ unsigned TeamBallLocator::computeTeamBallModel(Vector2f& pos, Vector2f& vel)
         float weighting = computeWeighting(ball);
         if(weighting != 0.f)
         {
-          Vector2f absPos = ball.robotPose * ball.pos;
-          Vector2f absVel = ball.vel;
-          absVel.rotate(ball.robotPose.rotation);
+          Vector2f absPos = ball.absPos;
+          Vector2f absVel = ball.absVel;
           if(ball.time < theFrameInfo.time)
           {
             float t = (theFrameInfo.time - ball.time) / 1000.f;
@@ -222,13 +227,7 @@ float TeamBallLocator::computeWeighting(const TeamBallLocator::Ball& ball) const
     return 0.f;
 
   float weighting = 1.0f - (1.0f / (1.0f + std::exp(-(theFrameInfo.getTimeSince(ball.time) - (float)ballLastSeenTimeout) / scalingFactorBallSinceLastSeen))); // sigmoid function based on ball_time_since_last_seen
-
-  const float camHeight = 550.f;
-  const float angleOfCamera = std::atan(ball.pos.norm() / camHeight); // angle of camera when looking at the ball
-  const float ballPositionWithPositiveDeviation = std::tan(angleOfCamera + 1_deg) * camHeight; // ball position when angle of camera is a bit different in position direction
-  const float ballPositionWithNegativeDeviation = std::tan(angleOfCamera - 1_deg) * camHeight; // ball position when angle of camera is a bit different in negative direction
-  const float ballDeviation = (ballPositionWithNegativeDeviation - ballPositionWithPositiveDeviation) / 2; // averaged deviation of the ball position
-  weighting *= 1.0f / ballDeviation;
+  weighting *= ball.distanceWeighting;
 
   return std::abs(weighting);
 }
@@ -57,6 +57,9 @@ public:
     Vector2f vel = Vector2f::Zero();   /**< Velocity of the ball (relative to the observer) */
     unsigned time;                     /**< Point of time (in ms) of the observation */
     bool valid;                        /**< This observation can be considered */
+    Vector2f absPos = Vector2f::Zero(); /**< Position of the ball on the field at the time of the observation */
+    Vector2f absVel = Vector2f::Zero(); /**< Velocity of the ball on the field at the time of the observation */
+    float distanceWeighting = 0.f;     /**< The part of the weighting that depends on the distance to the observer */
   };
 
 private:
@@ -72,6 +75,15 @@ private:
   /** Adds new information to the ball buffer */
   void updateBalls();
 
+  /**
+   * Adds a new observation to a ball buffer. All values that do not depend on the
+   * current time are computed only once here instead of in every frame.
+   * @param buffer The buffer of the observing robot.
+   * @param robotPose The pose of the observing robot.
+   * @param ballModel The ball model of the observing robot.
+   */
+  void addBall(RingBuffer<Ball, BALL_BUFFER_LENGTH>& buffer, const Pose2f& robotPose, const BallModel& ballModel);
+
   /** As the name says */
   bool ballIsNearOtherTeammate(const Teammate& teammate);
 
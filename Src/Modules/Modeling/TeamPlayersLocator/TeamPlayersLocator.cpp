@@ -9,7 +9,6 @@
  */
 
 #include "TeamPlayersLocator.h"
-#include "Tools/Math/Covariance.h"
 #include "Tools/Modeling/Obstacle.h"
 #include <algorithm>
 #include <limits>
@@ -89,7 +88,6 @@ void TeamPlayersLocator::update(TeamPlayersModel& teamPlayersModel)
           {
             if(isGoalPost(p) || isTeammate(p, squaredDistanceThreshold, teammate.number))
               continue;
-            Obstacle converted = Obstacle(Covariance::rotateCovarianceMatrix(obstacle.covariance, teammate.theRobotPose.rotation), p, obstacle.type);
             if(isInsideOwnDetectionArea(p, teammate.number, obstacle.lastSeen)
                && !collideOtherDetectionArea(p, teammate.number, ownTeam, obstacle.center.cast<float>().squaredNorm()))
               obstacles.emplace_back(Obstacle(obstacle.covariance, p, obstacle.lastSeen, obstacle.type));
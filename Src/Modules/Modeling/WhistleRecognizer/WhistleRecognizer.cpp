@@ -12,6 +12,7 @@
 #include "Tools/Debugging/Annotation.h"
 #include "Tools/Settings.h"
 #include "Tools/Debugging/DebugDrawings.h"
+#include "Platform/File.h"
 #include "Platform/SystemCall.h"
 
 MAKE_MODULE(WhistleRecognizer, modeling)
@@ -19,6 +20,8 @@ MAKE_MODULE(WhistleRecognizer, modeling)
 // We currently do not have a working FFTW3 implementation
 // for Windows in our repository.
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include "Platform/Thread.h"
 
@@ -37,17 +40,29 @@ WhistleRecognizer::WhistleRecognizer()
 
   // Allocate memeory for FFTW plans
   whistleInput8kHz = (double*) fftw_malloc(sizeof(double) * WHISTLE_FFT_LEN);
+  fftInput         = (fftw_complex*) fftw_malloc(sizeof(fftw_complex) * (WHISTLE_BUFF_LEN + 1));
   fftDataIn        = (fftw_complex*) fftw_malloc(sizeof(fftw_complex) * (WHISTLE_BUFF_LEN + 1));
   corrBuff         = (double*) fftw_malloc(sizeof(double) * WHISTLE_FFT_LEN);
 
   // Create plans
-  //  - after plan has been created, in and out buffer are set to zero
   //  - plan has to be created only once
+  //  - the input of the FFT is the input data followed by zero padding
+  //  - the input of the inverse FFT is a product of spectra, so the spectrum of the input is preserved
   // Creation of FFTW plans is not thread-safe, thus we need to synchronize with the other threads
   //   - This is only relevant for simulations that contain multiple robots
+  // Measuring the plans takes a noticeable time at startup. Therefore, the result is cached
+  // as FFTW wisdom, so that later starts of the process only need to look it up.
   SYNC;
-  fft2048  = fftw_plan_dft_r2c_1d(WHISTLE_FFT_LEN, whistleInput8kHz, fftDataIn, FFTW_MEASURE);   // build plan that fftw needs to compute the fft
+  const std::string wisdomFile = std::string(File::getBHDir()) + "/Config/fftwWisdom.dat";
+  const bool hadWisdom = fftw_import_wisdom_from_filename(wisdomFile.c_str()) != 0;
+  fft2048  = fftw_plan_dft_r2c_1d(WHISTLE_FFT_LEN, whistleInput8kHz, fftInput, FFTW_MEASURE);   // build plan that fftw needs to compute the fft
   ifft2048 = fftw_plan_dft_c2r_1d(WHISTLE_FFT_LEN, fftDataIn, corrBuff, FFTW_MEASURE); // build plan that fftw needs to compute the fft
+  if(!hadWisdom)
+    fftw_export_wisdom_to_filename(wisdomFile.c_str());
+
+  // Planning with FFTW_MEASURE overwrites the buffers, so the zero padding is only set now.
+  for(int j = WHISTLE_BUFF_LEN; j < WHISTLE_FFT_LEN; ++j)
+    whistleInput8kHz[j] = 0.0;
 
   // Load reference whistle
   ASSERT(whistleFiles.size());
@@ -69,6 +84,7 @@ WhistleRecognizer::~WhistleRecognizer()
   fftw_destroy_plan(fft2048);
   fftw_destroy_plan(ifft2048);
   fftw_free(whistleInput8kHz);
+  fftw_free(fftInput);
   fftw_free(fftDataIn);
   fftw_free(corrBuff);
   for(unsigned int i = 0; i < fftCmpData.size(); ++i)
@@ -165,14 +181,18 @@ void WhistleRecognizer::update(Whistle& whistle)
     currentVolume  = computeCurrentVolume();
     const bool vol = currentVolume > volumeThreshold;
 
-    std::vector<float> correlationsC0;
-    std::vector<float> correlationsC1;
-    for(unsigned int i = 0; i < whistleFiles.size(); ++i)
+    // Without enough volume, no whistle is accepted anyway, so the correlations are not computed.
+    // Otherwise, the spectrum of each channel is computed once and correlated with all reference whistles.
+    std::vector<float> correlationsC0(whistleFiles.size(), 0.f);
+    std::vector<float> correlationsC1(whistleFiles.size(), 0.f);
+    if(vol)
     {
-      float c0Corr = getWhistleCorrelationInPercent(inputChannel0, i);
-      float c1Corr = getWhistleCorrelationInPercent(inputChannel1, i);
-      correlationsC0.push_back(c0Corr);
-      correlationsC1.push_back(c1Corr);
+      computeSpectrum(inputChannel0);
+      for(unsigned int i = 0; i < whistleFiles.size(); ++i)
+        correlationsC0[i] = getWhistleCorrelationInPercent(i);
+      computeSpectrum(inputChannel1);
+      for(unsigned int i = 0; i < whistleFiles.size(); ++i)
+        correlationsC1[i] = getWhistleCorrelationInPercent(i);
     }
     bestWhistleIndex0 = listContainsValueHigherThan100(correlationsC0, bestCorrelationChannel0);
     bestWhistleIndex1 = listContainsValueHigherThan100(correlationsC1, bestCorrelationChannel1);
@@ -254,27 +274,25 @@ void WhistleRecognizer::update(Whistle& whistle)
   }
 }
 
-float WhistleRecognizer::getWhistleCorrelationInPercent(const RingBuffer<float, WHISTLE_BUFF_LEN>& inputChannel, unsigned whistleNumber)
+void WhistleRecognizer::computeSpectrum(const RingBuffer<float, WHISTLE_BUFF_LEN>& inputChannel)
 {
-  //  if(lastTimefft2048Computed != theFrameInfo.time)
-  //  {
   for(int j = 0; j < WHISTLE_BUFF_LEN; j++)
-  {
     whistleInput8kHz[j] = inputChannel[j]; // write just the half of dataIn and the rest is zero padded
-  }
-  fftw_execute(fft2048); /* compute the fft - repeat as needed */
-  //    lastTimefft2048Computed = theFrameInfo.time;
-  //  }
+  fftw_execute(fft2048); /* compute the fft */
+}
+
+float WhistleRecognizer::getWhistleCorrelationInPercent(unsigned whistleNumber)
+{
   /*
    * Now multiply the FFT of dataIn with the conjugete FFT of cmpData
    */
   const int REAL = 0;     // real value of complex
   const int IMAG = 1;     // imaginary value of complex
+  const fftw_complex* const cmpData = fftCmpData[whistleNumber];
   for(int j = 0; j < WHISTLE_BUFF_LEN + 1; j++)
   {
-    const double realFFTDataIn = fftDataIn[j][REAL];
-    fftDataIn[j][REAL] = realFFTDataIn * fftCmpData[whistleNumber][j][REAL] - fftDataIn[j][IMAG] * fftCmpData[whistleNumber][j][IMAG]; // real x real - imag x imag
-    fftDataIn[j][IMAG] = fftDataIn[j][IMAG] * fftCmpData[whistleNumber][j][REAL] + realFFTDataIn * fftCmpData[whistleNumber][j][IMAG]; // real x imag + imag x real
+    fftDataIn[j][REAL] = fftInput[j][REAL] * cmpData[j][REAL] - fftInput[j][IMAG] * cmpData[j][IMAG]; // real x real - imag x imag
+    fftDataIn[j][IMAG] = fftInput[j][IMAG] * cmpData[j][REAL] + fftInput[j][REAL] * cmpData[j][IMAG]; // real x imag + imag x real
   }
   fftw_execute(ifft2048); // calculate the ifft which is now the same as the correlation
 
@@ -285,13 +303,8 @@ float WhistleRecognizer::getWhistleCorrelationInPercent(const RingBuffer<float,
    */
   double correlation = 0.0;
   for(int j = 0; j < WHISTLE_CORR_LEN; j++)
-  {
-    corrBuff[j] /= maxAutoCorrelationValue[whistleNumber];
-    if(correlation < corrBuff[j])
-      correlation = corrBuff[j];
-    else if(correlation < -corrBuff[j])
-      correlation = -corrBuff[j];
-  }
+    correlation = std::max(correlation, std::abs(corrBuff[j]));
+  correlation /= maxAutoCorrelationValue[whistleNumber];
   return (static_cast<float>(correlation) / whistleThresholds[whistleNumber]) * 100.f;
 }
 
@@ -323,11 +336,7 @@ void WhistleRecognizer::printCorrelationResults(int channelNumber, const std::ve
 
 void WhistleRecognizer::recordNewReferenceWhistle()
 {
-  for(int j = 0; j < WHISTLE_BUFF_LEN; j++)
-  {
-    whistleInput8kHz[j] = inputChannel0[j]; // write just the half of dataIn and the rest is zero padded
-  }
-  fftw_execute(fft2048); /* compute the fft - repeat as needed */
+  computeSpectrum(inputChannel0);
   /*
    * Now multiply the FFT of dataIn with the conjugate FFT of cmpData
    */
@@ -335,10 +344,9 @@ void WhistleRecognizer::recordNewReferenceWhistle()
   const int IMAG = 1;     // imaginary value of complex
   for(int j = 0; j < WHISTLE_BUFF_LEN + 1; j++)
   {
-    newfftCmpData[j][REAL] = fftDataIn[j][REAL];
-    newfftCmpData[j][IMAG] = -fftDataIn[j][IMAG];
-    const double realFFTDataIn = fftDataIn[j][REAL];
-    fftDataIn[j][REAL] = realFFTDataIn * realFFTDataIn + fftDataIn[j][IMAG] * fftDataIn[j][IMAG]; // real x real + imag x imag
+    newfftCmpData[j][REAL] = fftInput[j][REAL];
+    newfftCmpData[j][IMAG] = -fftInput[j][IMAG];
+    fftDataIn[j][REAL] = fftInput[j][REAL] * fftInput[j][REAL] + fftInput[j][IMAG] * fftInput[j][IMAG]; // real x real + imag x imag
     fftDataIn[j][IMAG] = 0.0;
   }
   fftw_execute(ifft2048); // calculate the ifft which is now the same as the correlation
@@ -72,7 +72,8 @@ private:
   RingBuffer<float, WHISTLE_BUFF_LEN> inputChannel1;  /**< Audio data from the second channel */
   fftw_plan fft2048, ifft2048;                        /**< Plans for FFT and inverse FFT of an array of size 2048 */
   double* whistleInput8kHz;                           /**< Input data for whistle recognition */
-  fftw_complex* fftDataIn;                            /**< Output buffer of the FFT / input for inverse FFTW */
+  fftw_complex* fftInput;                             /**< Output buffer of the FFT, i.e. the spectrum of the current input */
+  fftw_complex* fftDataIn;                            /**< Input for inverse FFTW */
   double* corrBuff;                                   /**< Buffer of the resulting correlation (output of inverse FFTW) */
   std::vector<fftw_complex*> fftCmpData;              /**< Reference whistles */
   fftw_complex* newfftCmpData;                        /**< Buffer for storing a new whistle */
@@ -88,13 +89,18 @@ private:
   std::queue<Whistle> lastDetectedWhistles;
 
   /**
-   * Method for recognizing a whistle in one channel
+   * Computes the spectrum of the audio data of one channel in fftInput.
    * @param inputChannel The incoming audio data
+   */
+  void computeSpectrum(const RingBuffer<float, WHISTLE_BUFF_LEN>& inputChannel);
+
+  /**
+   * Method for recognizing a whistle in the channel the spectrum of which
+   * was computed last.
    * @param whistleNumber The whistle to correlate with
-   * @param correlation Returns the correlation of the incoming data with the preconfigured reference whistle
    * @return The match with the correlation limit in percent (can be higher than 100 %
    */
-  float getWhistleCorrelationInPercent(const RingBuffer<float, WHISTLE_BUFF_LEN>& inputChannel, unsigned whistleNumber);
+  float getWhistleCorrelationInPercent(unsigned whistleNumber);
 
   /**
    * Method searches for value higher than 100 and returns the index of element with the highest value.
@@ -58,7 +58,11 @@ ZmpBalancer::ZmpBalancer():
 
 Pose3f ZmpBalancer::calcComInStand(const JointAngles& angles)
 {
-  RobotModel robotModel(angles, theRobotDimensions, theMassCalibration);
+  return calcComInStand(RobotModel(angles, theRobotDimensions, theMassCalibration));
+}
+
+Pose3f ZmpBalancer::calcComInStand(const RobotModel& robotModel) const
+{
   Pose3f supportAnkleTorso = rightIsSupportFoot ? robotModel.limbs[Limbs::footRight] : robotModel.limbs[Limbs::footLeft];
   Pose3f supportAnkleInCom = Pose3f(robotModel.centerOfMass).inverse() * supportAnkleTorso;
 
@@ -79,6 +83,8 @@ void ZmpBalancer::calcJointAngles(const Pose3f& comInStand, const Pose3f& swingI
 
   /*Up to here we have foot in com position, but we need foot in torso position and
    there is no fast forward solution to compute ComInTorso, so its calculated iterative*/
+  RobotModel robotModel;
+  JointAngles previousCuttedAngles;
   for(int i = 0; ; ++i)
   {
     //Compute Joint Angles
@@ -94,8 +100,12 @@ void ZmpBalancer::calcJointAngles(const Pose3f& comInStand, const Pose3f& swingI
     for(int j = firstSwingLegJoint; j < firstSwingLegJoint + 6; j++)
       cuttedAngles.angles[j] = theJointAngles.angles[j];
 
-    //Compute Com
-    RobotModel robotModel(cuttedAngles, theRobotDimensions, theMassCalibration);
+    //Compute Com, only the legs change between iterations
+    if(i == 0)
+      robotModel.setJointData(cuttedAngles, theRobotDimensions, theMassCalibration);
+    else
+      robotModel.updateJointData(cuttedAngles, previousCuttedAngles, theRobotDimensions, theMassCalibration);
+    previousCuttedAngles = cuttedAngles;
     Vector3f delta = (robotModel.centerOfMass - comInTorso) * 1.3f;
 
     if(i >= 7 || (std::abs(delta.x()) < 0.05f && std::abs(delta.y()) < 0.05f/* && std::abs(delta.z()) < 0.05f*/))
@@ -126,7 +136,7 @@ Pose3f ZmpBalancer::init(bool rightIsSupportFoot, const BalancingParameter& para
 
   //calculate current com and torso height
   Pose3f supportAnkle = rightIsSupportFoot ? theRobotModel.limbs[Limbs::footRight] : theRobotModel.limbs[Limbs::footLeft];
-  Pose3f comInStand = calcComInStand(theJointAngles);
+  Pose3f comInStand = calcComInStand(theRobotModel); // theRobotModel was computed from theJointAngles
   this->initialComHeight = comHeight = comInStand.translation.z();
 
   //initialize ZmpController
@@ -232,7 +242,7 @@ bool ZmpBalancer::addBalance(JointRequest& jointRequest, const std::vector<float
   RobotModel robotModel(jointRequest, theRobotDimensions, theMassCalibration);
   Pose3f leftInRight = robotModel.limbs[Limbs::footRight].inverse() * robotModel.limbs[Limbs::footLeft];
   Pose3f swingFootInSupport = rightIsSupportFoot ? leftInRight  : leftInRight.inverse();
-  Pose3f com = calcComInStand(jointRequest);
+  Pose3f com = calcComInStand(robotModel);
 
   return calcBalancedJoints(jointRequest, swingFootInSupport, com.translation.z(), com.rotation, zmpPreviewsX, zmpPreviewsY, param, representation);
 }
@@ -263,30 +273,30 @@ bool ZmpBalancer::calcBalancedJoints(JointRequest& jointRequest, const Pose3f& s
   stateY = Vector3f(com.position.y() * (1 - param.sensorFeedbackY.x()) + param.sensorFeedbackY.x() * state.com.position.y(), com.velocity.y() * (1 - param.sensorFeedbackY.y()) + param.sensorFeedbackY.y() * state.com.velocity.y(), stateY(2) * (1 - param.sensorFeedbackY.z()) + param.sensorFeedbackY.z() * state.zmp.y());
 
   // control position using ZMPController
-  VectorXf zmpPreviewsX = VectorXf::Zero(param.previewControllerX.numOfZmpPreviews);
-  VectorXf zmpPreviewsY = VectorXf::Zero(param.previewControllerY.numOfZmpPreviews);
+  zmpPreviewBufferX.setZero(param.previewControllerX.numOfZmpPreviews);
+  zmpPreviewBufferY.setZero(param.previewControllerY.numOfZmpPreviews);
 
   int indexOffset = param.strictInitialTrajectory ? 4 : 0;
   unsigned int initialSize = std::max(static_cast<int>(initialZMPTrajectoryX.size()) - indexOffset, 0);
   for(unsigned int i = 0; i < param.previewControllerX.numOfZmpPreviews; i++)
   {
     if(i < initialSize)
-      zmpPreviewsX[i] = initialZMPTrajectoryX[i + indexOffset];
+      zmpPreviewBufferX[i] = initialZMPTrajectoryX[i + indexOffset];
     else if(i < nextZMPPreviewsX.size() + initialSize)
-      zmpPreviewsX[i] = nextZMPPreviewsX[i - initialSize];
+      zmpPreviewBufferX[i] = nextZMPPreviewsX[i - initialSize];
     else
-      zmpPreviewsX[i] = zmpPreviewsX[i - 1];
+      zmpPreviewBufferX[i] = zmpPreviewBufferX[i - 1];
   }
 
   initialSize = initialSize = std::max(static_cast<int>(initialZMPTrajectoryY.size()) - indexOffset, 0);
   for(unsigned int i = 0; i < param.previewControllerY.numOfZmpPreviews; i++)
   {
     if(i < initialSize)
-      zmpPreviewsY[i] = initialZMPTrajectoryY[i + indexOffset];
+      zmpPreviewBufferY[i] = initialZMPTrajectoryY[i + indexOffset];
     else if(i < nextZMPPreviewsY.size() + initialSize)
-      zmpPreviewsY[i] = nextZMPPreviewsY[i - initialSize];
+      zmpPreviewBufferY[i] = nextZMPPreviewsY[i - initialSize];
     else
-      zmpPreviewsY[i] = zmpPreviewsY[i - 1];
+      zmpPreviewBufferY[i] = zmpPreviewBufferY[i - 1];
   }
 
   if(initialZMPTrajectoryY.size() > 0 && (!param.strictInitialTrajectory || (initialZMPTrajectoryY[0] > state.com.position.y() && rightIsSupportFoot) || (!rightIsSupportFoot && initialZMPTrajectoryY[0] < state.com.position.y()))) //last zmp position reached
@@ -297,16 +307,16 @@ bool ZmpBalancer::calcBalancedJoints(JointRequest& jointRequest, const Pose3f& s
 
   if(param.usePreviewController)
   {
-    stateX = zmpControllerX.control(stateX, zmpPreviewsX, comHeight, param.previewControllerX);
-    stateY = zmpControllerY.control(stateY, zmpPreviewsY, comHeight, param.previewControllerY);
+    stateX = zmpControllerX.control(stateX, zmpPreviewBufferX, comHeight, param.previewControllerX);
+    stateY = zmpControllerY.control(stateY, zmpPreviewBufferY, comHeight, param.previewControllerY);
   }
   else
   {
-    stateX(0) = zmpPreviewsX[0];
-    stateY(0) = zmpPreviewsY[0];
+    stateX(0) = zmpPreviewBufferX[0];
+    stateY(0) = zmpPreviewBufferY[0];
   }
 
-  float stabilizationFactor = Rangef(0.f, 1.f).limit(1.f - std::min(std::abs(zmpPreviewsY[0]), std::abs(stateY[0])) / param.stabilizationRange) * initTime;
+  float stabilizationFactor = Rangef(0.f, 1.f).limit(1.f - std::min(std::abs(zmpPreviewBufferY[0]), std::abs(stateY[0])) / param.stabilizationRange) * initTime;
 
   // compute current tilt
   Pose3f realSupportSole = rightIsSupportFoot ? theRobotModel.soleRight : theRobotModel.soleLeft;
@@ -329,7 +339,7 @@ bool ZmpBalancer::calcBalancedJoints(JointRequest& jointRequest, const Pose3f& s
   //RotationMatrix torsoRotation = AngleAxisf(0, Vector3f::UnitY());
   torsoRotation *= AngleAxisf((1.f - initTime) * torsoRotationOffset.y(), Vector3f::UnitY());
   torsoRotation *= AngleAxisf((1.f - initTime) * torsoRotationOffset.x(), Vector3f::UnitX());
-  torsoRotation *= AngleAxisf(-(sign * 50 + zmpPreviewsY[0]) *  param.oneLeggedTorsoRotation / 50.f, Vector3f::UnitX());
+  torsoRotation *= AngleAxisf(-(sign * 50 + zmpPreviewBufferY[0]) *  param.oneLeggedTorsoRotation / 50.f, Vector3f::UnitX());
   torsoRotation *= AngleAxisf(-param.balanceWithHip.x() *  tilt.x() * stabilizationFactor, Vector3f::UnitX());
   torsoRotation *= AngleAxisf(-param.balanceWithHip.y() *  tilt.y(), Vector3f::UnitY());
   Pose3f comInStand(torsoRotation, Vector3f(stateX(0), stateY(0), comHeight));
@@ -406,8 +416,8 @@ bool ZmpBalancer::calcBalancedJoints(JointRequest& jointRequest, const Pose3f& s
   representation.comYvel = state.com.velocity.y();
   representation.kneeDiff = kneeDiff;
 
-  //OUTPUT_TEXT("" << state.com.position.y() << "," << stateY(0) << "," << zmpPreviewsY[0] << "," << tilt.x());
-  //OUTPUT_TEXT("" << state.com.position.x() << "," << stateX(0) << "," << zmpPreviewsX[0] << "," << tilt.y());
+  //OUTPUT_TEXT("" << state.com.position.y() << "," << stateY(0) << "," << zmpPreviewBufferY[0] << "," << tilt.x());
+  //OUTPUT_TEXT("" << state.com.position.x() << "," << stateX(0) << "," << zmpPreviewBufferX[0] << "," << tilt.y());
 
   return((theFootSupport.support < -0.4 && rightIsSupportFoot) || (theFootSupport.support > 0.4 && !rightIsSupportFoot)) && initialZMPTrajectoryY.size() < 5;
 }
@@ -83,6 +83,11 @@ private:
    */
   Pose3f calcComInStand(const JointAngles& angles);
 
+  /**
+   * Calculates center of mass relative to the center of support foot on ground for a given robot model
+   */
+  Pose3f calcComInStand(const RobotModel& robotModel) const;
+
   /**
    * Calculates a new set of Joint angles under consideration of a swing foot position, a torso rotation and center of mass relative to a support foot
    */
@@ -98,6 +103,8 @@ private:
 
   ZmpController zmpControllerX;
   ZmpController zmpControllerY;
+  VectorXf zmpPreviewBufferX; // zmp previews passed to zmpControllerX, kept to avoid reallocating them every frame
+  VectorXf zmpPreviewBufferY; // zmp previews passed to zmpControllerY
   LIPStateEstimator estimator;
 
   Vector3f comInTorso;      // last com In Torso translation for a quick iterative computation of the current comInTorso
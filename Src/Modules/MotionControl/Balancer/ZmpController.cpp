@@ -18,6 +18,20 @@ ZmpController::ZmpController()
 {}
 
 void ZmpController::init(float cycleTime)
+{
+  if(this->cycleTime != cycleTime)
+  {
+    this->cycleTime = cycleTime;
+    gainTable.clear();
+  }
+  calculateModel(comHeight, A, B);
+
+  C << 0.f, 0.f, 1.f;
+
+  calculateGains();
+}
+
+void ZmpController::calculateModel(float comHeight, Matrix3f& A, Vector3f& B) const
 {
   const float gtt_2h = Constants::g * cycleTime * cycleTime / (2.f * comHeight);
   const float gt_h = Constants::g * cycleTime / comHeight;
@@ -27,14 +41,12 @@ void ZmpController::init(float cycleTime)
 
   const float ttt_6 = cycleTime * cycleTime * cycleTime / 6.f;
   B << ttt_6, 0.5f * cycleTime* cycleTime, ttt_6 - comHeight* cycleTime / Constants::g;
-
-  C << 0.f, 0.f, 1.f;
-
-  calculateGains();
 }
 
 void ZmpController::reset(float comHeight, float cycleTime, ZmpControllerParameters params)
 {
+  if(params != this->params)
+    gainTable.clear();
   this->params = params;
   this->lastParams = params;
   this->comHeight = comHeight;
@@ -50,8 +62,11 @@ Vector3f ZmpController::control(const Vector3f& inputState, const VectorXf& Zmps
   ASSERT(static_cast<unsigned>(Zmps.size()) == params.numOfZmpPreviews);
   if(this->comHeight != comHeight || params != lastParams)
   {
+    if(params != lastParams)
+      gainTable.clear();
     this->comHeight = comHeight;
     lastParams = params;
+    calculateModel(comHeight, A, B);
     calculateGains();
   }
 
@@ -72,53 +87,84 @@ Vector3f ZmpController::control(const Vector3f& inputState, const VectorXf& Zmps
     return Vector3f::Zero();
 }
 
+const ZmpController::Gains& ZmpController::getGains(int index)
+{
+  auto entry = gainTable.find(index);
+  if(entry == gainTable.end())
+  {
+    entry = gainTable.emplace(index, Gains()).first;
+    Matrix3f A;
+    Vector3f B;
+    calculateModel(static_cast<float>(index) * comHeightStep, A, B);
+    calculateGains(A, B, entry->second);
+  }
+  return entry->second;
+}
+
 void ZmpController::calculateGains()
 {
   DECLARE_PLOT("module:ZmpWalkingEngine:ZmpController:previewGains");
   ASSERT(params.numOfZmpPreviews > 0);
 
-  const Vector4f B = (Vector4f() << this->C * this->B, this->B).finished();
+  const float gridPos = comHeight / comHeightStep;
+  const int index = static_cast<int>(std::floor(gridPos));
+  const float ratio = gridPos - static_cast<float>(index);
+  const Gains& lower = getGains(index);
+  const Gains& upper = getGains(index + 1);
+
+  operational = lower.operational && upper.operational;
+  if(operational)
+  {
+    GI = lower.GI + (upper.GI - lower.GI) * ratio;
+    Gx = lower.Gx + (upper.Gx - lower.Gx) * ratio;
+    Gd = lower.Gd + (upper.Gd - lower.Gd) * ratio;
+  }
+  else
+  {
+    GI = 0.f;
+    Gx = RowVector3f::Zero();
+    Gd = RowVectorXf::Zero(params.numOfZmpPreviews);
+  }
+
+  for(int i = 0; i < Gd.size(); ++i)
+  {
+    PLOT("module:ZmpWalkingEngine:ZmpController:previewGains", Gd(i));
+  }
+}
+
+void ZmpController::calculateGains(const Matrix3f& A3, const Vector3f& B3, Gains& gains) const
+{
+  const Vector4f B = (Vector4f() << this->C * B3, B3).finished();
   const Vector4f I = Vector4f::Identity();
-  const Matrix4x3f F = (Matrix4x3f() << this->C * this->A, this->A).finished();
+  const Matrix4x3f F = (Matrix4x3f() << this->C * A3, A3).finished();
   const Matrix4f A = (Matrix4f() << I, F).finished();
   const Matrix4f Q = (Matrix4f() << params.Qe, RowVector3f::Zero(),
                       Vector3f::Zero(), Matrix3f(params.Qx.asDiagonal())).finished();
 
   Matrix4f K;
-  operational = dare(A, B, Q, params.R, K);
-  if(operational)
+  gains.operational = dare(A, B, Q, params.R, K);
+  if(gains.operational)
   {
     const RowVector4f Bt = B.transpose();
     const RowVector4f BtK = Bt* K;
     const float rBtKBinv = 1.f / (params.R + BtK* B);
 
-    GI = rBtKBinv * BtK* I;
-    Gx = rBtKBinv * BtK* F;
+    gains.GI = rBtKBinv * BtK* I;
+    gains.Gx = rBtKBinv * BtK* F;
 
     const Matrix4f Act = (A - B * rBtKBinv * BtK* A).transpose();
     const Vector4f KI = K * I;
 
-    Gd.resize(params.numOfZmpPreviews);
-    Gd(0) = 0.f;
-    Gd(1) = -GI;
+    gains.Gd.resize(params.numOfZmpPreviews);
+    gains.Gd(0) = 0.f;
+    gains.Gd(1) = -gains.GI;
     Vector4f X = -Act* KI;
     for(unsigned i = 2; i < params.numOfZmpPreviews; ++i)
     {
-      Gd(i) = rBtKBinv * Bt* X;
+      gains.Gd(i) = rBtKBinv * Bt* X;
       X = Act* X;
     }
   }
-  else
-  {
-    GI = 0.f;
-    Gx = RowVector3f::Zero();
-    Gd = RowVectorXf::Zero(params.numOfZmpPreviews);
-  }
-
-  for(int i = 0; i < Gd.size(); ++i)
-  {
-    PLOT("module:ZmpWalkingEngine:ZmpController:previewGains", Gd(i));
-  }
 }
 
 bool ZmpController::dare(const Matrix4f& A, const Vector4f& B, const Matrix4f& Q, float R, Matrix4f& K) const
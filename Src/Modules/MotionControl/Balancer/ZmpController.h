@@ -2,6 +2,7 @@
 
 #include "Tools/Math/Eigen.h"
 #include "Tools/Streams/AutoStreamable.h"
+#include <unordered_map>
 
 STREAMABLE(ZmpControllerParameters,
 {
@@ -15,6 +16,12 @@ STREAMABLE(ZmpControllerParameters,
   (bool)(true) useIntegrator,
 });
 
+/**
+ * A preview controller for the ZMP. Solving the Riccati equation for its gains
+ * is expensive, but the gains only depend on the parameters, the cycle time,
+ * and the height of the center of mass. Therefore, the gains are computed for
+ * a grid of heights, each grid point only once, and interpolated in between.
+ */
 class ZmpController
 {
 protected:
@@ -24,14 +31,28 @@ protected:
   RowVector3f C;
 
 private:
+  static constexpr float comHeightStep = 5.f; /**< The distance between CoM heights the gains are computed for (in mm). */
+
+  /** The gains of the controller for a certain CoM height. */
+  struct Gains
+  {
+    bool operational = false;
+    float GI = 0.f;
+    RowVector3f Gx = RowVector3f::Zero();
+    RowVectorXf Gd;
+  };
+
   ZmpControllerParameters params;
   ZmpControllerParameters lastParams;
+  float cycleTime = 0.f;
   bool operational = false;
 
   float GI;
   RowVector3f Gx;
   RowVectorXf Gd;
 
+  std::unordered_map<int, Gains> gainTable; /**< The gains for multiples of comHeightStep. Cleared when the parameters or the cycle time change. */
+
   float integrationError = 0.f;
 
 public:
@@ -43,6 +64,31 @@ public:
   void plot() const;
 
 private:
+  /**
+   * Computes the system matrices for a CoM height.
+   * @param comHeight The height of the center of mass.
+   * @param A The system matrix.
+   * @param B The input matrix.
+   */
+  void calculateModel(float comHeight, Matrix3f& A, Vector3f& B) const;
+
+  /**
+   * Returns the gains for a grid point. They are computed if they are not in the table yet.
+   * @param index The index of the grid point, i.e. the CoM height divided by comHeightStep.
+   * @return The gains.
+   */
+  const Gains& getGains(int index);
+
+  /** Interpolates the gains for the current CoM height from the neighboring grid points. */
   void calculateGains();
+
+  /**
+   * Solves the Riccati equation for the gains.
+   * @param A The system matrix.
+   * @param B The input matrix.
+   * @param gains The gains computed.
+   */
+  void calculateGains(const Matrix3f& A, const Vector3f& B, Gains& gains) const;
+
   bool dare(const Matrix4f& A, const Vector4f& B, const Matrix4f& Q, float R, Matrix4f& K) const;
 };
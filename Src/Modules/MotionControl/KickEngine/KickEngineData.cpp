@@ -118,6 +118,7 @@ bool KickEngineData::checkPhaseTime(const FrameInfo& frame, const JointAngles& j
   else if(currentParameters.loop && phaseNumber == currentParameters.numberOfPhases)
   {
     phaseNumber = 0;
+    coefficientsPhaseNumber = -1;
     //calculateOrigins(currentKickRequest, ja, torsoMatrix);
     currentParameters.initFirstPhaseLoop(origins, currentParameters.phaseParameters[currentParameters.numberOfPhases - 1].comTra[2], Vector2f(ja.angles[Joints::headPitch], ja.angles[Joints::headYaw]));
 
@@ -195,10 +196,9 @@ void KickEngineData::calcLegJoints(const Joints::Joint& joint, JointRequest& joi
   const float leg1 = anklePos.z() == 0.0f ? 0.0f : (std::atan(anklePos.y() / -anklePos.z()));
   const float leg3 = pi - a2;
 
-  const RotationMatrix rotateBecauseOfHip = RotationMatrix::aroundZ(0).rotateX(bodyAngle.x()).rotateY(bodyAngle.y());
   //calculate inverse foot rotation so that they are flat to the ground
   RotationMatrix footRot = RotationMatrix::aroundX(leg1).rotateY(leg2 + leg3);
-  footRot = footRot.inverse() /* * zRot*/ * rotateBecauseOfHip;
+  footRot = footRot.inverse() /* * zRot*/ * rotateBodyTilt;
 
   //and add additonal foot rotation (which is probably not flat to the ground)
   const float leg4 = std::atan2(footRot(0, 2), footRot(2, 2)) + footRotAng.y();
@@ -378,6 +378,7 @@ void KickEngineData::addDynPoint(const DynPoint& dynPoint, const TorsoMatrix& to
 
   const int phaseNumber = dynPoint.phaseNumber;
   const int limb = dynPoint.limb;
+  coefficientsPhaseNumber = -1;
 
   if(dynPoint.duration > 0)
     currentParameters.phaseParameters[phaseNumber].duration = dynPoint.duration;
@@ -540,15 +541,27 @@ void KickEngineData::setCycleTime(float time)
   cycletime = time;
 }
 
+void KickEngineData::calcCoefficients()
+{
+  for(int i = 0; i < Phase::numOfLimbs; ++i)
+    currentParameters.getCoefficients(phaseNumber, i, coefficients[i]);
+  currentParameters.getHeadRefCoefficients(phaseNumber, headCoefficients);
+  currentParameters.getComRefCoefficients(phaseNumber, comCoefficients);
+  coefficientsPhaseNumber = phaseNumber;
+}
+
 void KickEngineData::calcPositions()
 {
+  if(coefficientsPhaseNumber != phaseNumber)
+    calcCoefficients();
+
   for(int i = 0; i < Phase::numOfLimbs; ++i)
-    positions[i] = currentParameters.getPosition(phase, phaseNumber, i);
+    positions[i] = KickEngineParameters::evaluate(coefficients[i], phase);
 
   if(!currentParameters.ignoreHead)
-    head = currentParameters.getHeadRefPosition(phase, phaseNumber);
+    head = KickEngineParameters::evaluate(headCoefficients, phase);
 
-  ref << currentParameters.getComRefPosition(phase, phaseNumber),
+  ref << KickEngineParameters::evaluate(comCoefficients, phase),
       (toLeftSupport) ? positions[Phase::leftFootTra].z() : positions[Phase::rightFootTra].z();
 }
 
@@ -578,6 +591,7 @@ void KickEngineData::initData(const FrameInfo& frame, const MotionRequest& mr, s
     phaseNumber = 0;
     timeStamp = frame.time;
     currentParameters = params[motionID];
+    coefficientsPhaseNumber = -1;
     toLeftSupport = currentParameters.standLeft;
 
     ref = Vector3f::Zero();
@@ -606,6 +620,7 @@ void KickEngineData::initData(const FrameInfo& frame, const MotionRequest& mr, s
     balanceSum.y() = std::tan(angleX - Constants::pi) * height;
     balanceSum.y() /= -currentParameters.kix;
 
+    coefficientsPhaseNumber = -1;
     currentParameters.initFirstPhaseLoop(origins, Vector2f(com.x(), com.y()), Vector2f(ja.angles[Joints::headPitch], (mr.kickRequest.mirror) ? -ja.angles[Joints::headYaw] : ja.angles[Joints::headYaw]));
 
     if(!wasActive)
@@ -71,6 +71,15 @@ private:
 
   KickEngineParameters currentParameters;
 
+  /**
+   * The polynomial coefficients of the trajectories of the phase coefficientsPhaseNumber.
+   * They are only recomputed when a new phase is entered or the control points were changed.
+   */
+  Vector3f coefficients[Phase::numOfLimbs][4];
+  Vector2f comCoefficients[4];
+  Vector2f headCoefficients[4];
+  int coefficientsPhaseNumber = -1; /**< The phase the coefficients belong to. -1 if they are invalid. */
+
   RobotModel robotModel;
   RobotModel comRobotModel;
 
@@ -100,6 +109,7 @@ public:
   void setCycleTime(float time);
   void calcPhaseState();
   void calcPositions();
+  void calcCoefficients();
   void setRobotModel(const RobotModel& rm);
   bool isMotionAlmostOver();
   void setCurrentKickRequest(const MotionRequest& mr);
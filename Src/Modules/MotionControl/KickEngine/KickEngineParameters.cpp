@@ -103,58 +103,64 @@ void KickEngineParameters::calcControlPoints()
   }
 }
 
-Vector3f KickEngineParameters::getPosition(const float& phase, const int& phaseNumber, const int& limb)
+namespace
 {
-  Vector3f p0, p1;
-  if(phaseNumber == 0)
-    p0 = p1 = phaseParameters[phaseNumber].originPos[limb];
-  else
+  template<typename V> void toPolynomial(const V& p0, const V& p1, const V& p2, const V& p3, V* coefficients)
   {
-    p0 = phaseParameters[phaseNumber - 1].controlPoints[limb][2];
-    p1 = phaseParameters[phaseNumber].controlPoints[limb][0];
+    coefficients[0] = -p0 + p1 * 3 - p2 * 3 + p3;
+    coefficients[1] = p0 * 3 - p1 * 6 + p2 * 3;
+    coefficients[2] = p0 * -3 + p1 * 3;
+    coefficients[3] = p0;
   }
+}
 
-  const Vector3f p2 = phaseParameters[phaseNumber].controlPoints[limb][1];
-  const Vector3f p3 = phaseParameters[phaseNumber].controlPoints[limb][2];
-
-  return (-p0 + p1 * 3 - p2 * 3 + p3) * phase * phase * phase + (p0 * 3 - p1 * 6 + p2 * 3) * phase * phase + (p0 * -3 + p1 * 3) * phase + p0;
+Vector3f KickEngineParameters::getPosition(const float& phase, const int& phaseNumber, const int& limb)
+{
+  Vector3f coefficients[4];
+  getCoefficients(phaseNumber, limb, coefficients);
+  return evaluate(coefficients, phase);
 }
 
 Vector2f KickEngineParameters::getComRefPosition(const float& phase, const int& phaseNumber)
 {
-  Vector2f p0, p1;
-  if(phaseNumber == 0)
-    p0 = p1 = phaseParameters[phaseNumber].comOriginPos;
-  else
-  {
-    p0 = phaseParameters[phaseNumber - 1].comTra[2];
-    p1 = phaseParameters[phaseNumber].comTra[0];
-  }
-
-  const Vector2f p2 = phaseParameters[phaseNumber].comTra[1];
-  const Vector2f p3 = phaseParameters[phaseNumber].comTra[2];
-
-  //bezier
-  return (-p0 + p1 * 3 - p2 * 3 + p3) * phase * phase * phase + (p0 * 3 - p1 * 6 + p2 * 3) * phase * phase + (p0 * -3 + p1 * 3) * phase + p0;
+  Vector2f coefficients[4];
+  getComRefCoefficients(phaseNumber, coefficients);
+  return evaluate(coefficients, phase);
 }
 
 Vector2f KickEngineParameters::getHeadRefPosition(const float& phase, const int& phaseNumber)
 {
-  Vector2f p0, p1;
+  Vector2f coefficients[4];
+  getHeadRefCoefficients(phaseNumber, coefficients);
+  return evaluate(coefficients, phase);
+}
+
+void KickEngineParameters::getCoefficients(int phaseNumber, int limb, Vector3f* coefficients) const
+{
+  const Phase& current = phaseParameters[phaseNumber];
   if(phaseNumber == 0)
-  {
-    p0 = p1 = phaseParameters[phaseNumber].headOrigin;
-  }
+    toPolynomial(current.originPos[limb], current.originPos[limb], current.controlPoints[limb][1], current.controlPoints[limb][2], coefficients);
   else
-  {
-    p0 = phaseParameters[phaseNumber - 1].headTra[2];
-    p1 = phaseParameters[phaseNumber].headTra[0];
-  }
+    toPolynomial(phaseParameters[phaseNumber - 1].controlPoints[limb][2], current.controlPoints[limb][0],
+                 current.controlPoints[limb][1], current.controlPoints[limb][2], coefficients);
+}
 
-  const Vector2f p2 = phaseParameters[phaseNumber].headTra[1];
-  const Vector2f p3 = phaseParameters[phaseNumber].headTra[2];
+void KickEngineParameters::getComRefCoefficients(int phaseNumber, Vector2f* coefficients) const
+{
+  const Phase& current = phaseParameters[phaseNumber];
+  if(phaseNumber == 0)
+    toPolynomial(current.comOriginPos, current.comOriginPos, current.comTra[1], current.comTra[2], coefficients);
+  else
+    toPolynomial(phaseParameters[phaseNumber - 1].comTra[2], current.comTra[0], current.comTra[1], current.comTra[2], coefficients);
+}
 
-  return (-p0 + p1 * 3 - p2 * 3 + p3) * phase * phase * phase + (p0 * 3 - p1 * 6 + p2 * 3) * phase * phase + (p0 * -3 + p1 * 3) * phase + p0;
+void KickEngineParameters::getHeadRefCoefficients(int phaseNumber, Vector2f* coefficients) const
+{
+  const Phase& current = phaseParameters[phaseNumber];
+  if(phaseNumber == 0)
+    toPolynomial(current.headOrigin, current.headOrigin, current.headTra[1], current.headTra[2], coefficients);
+  else
+    toPolynomial(phaseParameters[phaseNumber - 1].headTra[2], current.headTra[0], current.headTra[1], current.headTra[2], coefficients);
 }
 
 void KickEngineParameters::initFirstPhase()
@@ -55,6 +55,28 @@ STREAMABLE(KickEngineParameters,
   Vector2f getComRefPosition(const float& phase, const int& phaseNumber);
   Vector2f getHeadRefPosition(const float& phase, const int& phaseNumber);
 
+  /**
+   * The methods convert the Bezier curves of a phase into the coefficients
+   * c of the polynomial c[0] * t^3 + c[1] * t^2 + c[2] * t + c[3].
+   * @param phaseNumber The phase the coefficients are determined for.
+   * @param limb The limb the coefficients are determined for (getCoefficients only).
+   * @param coefficients An array of four elements that receives the coefficients.
+   */
+  void getCoefficients(int phaseNumber, int limb, Vector3f* coefficients) const;
+  void getComRefCoefficients(int phaseNumber, Vector2f* coefficients) const;
+  void getHeadRefCoefficients(int phaseNumber, Vector2f* coefficients) const;
+
+  /**
+   * Evaluates a cubic polynomial using Horner's scheme.
+   * @param coefficients The four coefficients, highest order first.
+   * @param t The parameter in [0 .. 1].
+   * @return The value of the polynomial.
+   */
+  template<typename V> static V evaluate(const V* coefficients, float t)
+  {
+    return ((coefficients[0] * t + coefficients[1]) * t + coefficients[2]) * t + coefficients[3];
+  }
+
   void initFirstPhase();
   void initFirstPhase(const Vector3f* origins, const Vector2f& head);
   void initFirstPhaseLoop(const Vector3f* origins, const Vector2f& lastCom, const Vector2f& head);
@@ -9,62 +9,97 @@
 
 #include "SpecialActions.h"
 #include "Tools/Motion/MofCompiler.h"
+#include <cstring>
 
 MAKE_MODULE(SpecialActions, motionControl)
 
 thread_local SpecialActions* SpecialActions::theInstance = nullptr;
 
-void SpecialActions::MotionNetData::load(std::vector<float>& motionData)
+const short SpecialActions::MotionNetData::noJumpTable[SpecialActionRequest::numOfSpecialActionIDs + 1] = {0};
+
+/** The size of the jump table at the beginning of a motion net image, padded to keep the nodes aligned. */
+static const size_t jumpTableSize = (sizeof(short) * (SpecialActionRequest::numOfSpecialActionIDs + 1) + 7) & ~static_cast<size_t>(7);
+
+void SpecialActions::MotionNetData::useImage()
+{
+  label_extern_start = reinterpret_cast<const short*>(image.getData());
+  nodeArray = reinterpret_cast<const MotionNetNode*>(image.getData() + jumpTableSize);
+}
+
+bool SpecialActions::MotionNetData::load(char* errorBuffer, size_t size)
+{
+  *errorBuffer = 0;
+  const uint64_t hash = MofCompiler::hashMofs();
+  if(image.load("motionNet.dat", imageVersion, hash) && image.getSize() >= jumpTableSize)
+  {
+    useImage();
+    return true;
+  }
+
+  std::vector<float> motionData;
+  MofCompiler* mofCompiler = new MofCompiler;
+  const bool success = mofCompiler->compileMofs(errorBuffer, size, motionData);
+  delete mofCompiler;
+  if(success)
+    load(motionData, "motionNet.dat", hash);
+  return success;
+}
+
+void SpecialActions::MotionNetData::load(const std::vector<float>& motionData, const std::string& name, uint64_t hash)
 {
   int dataCounter = 0;
 
+  std::vector<char> newImage(jumpTableSize);
+  short* jumpTable = reinterpret_cast<short*>(newImage.data());
   for(int i = 0; i < SpecialActionRequest::numOfSpecialActionIDs; ++i)
-    label_extern_start[i] = static_cast<short>(motionData[dataCounter++]);
-  label_extern_start[SpecialActionRequest::numOfSpecialActionIDs] = 0;
+    jumpTable[i] = static_cast<short>(motionData[dataCounter++]);
+  jumpTable[SpecialActionRequest::numOfSpecialActionIDs] = 0;
 
   int numberOfNodes = static_cast<int>(motionData[dataCounter++]);
 
-  if(nodeArray)
-    delete[] nodeArray;
-
-  nodeArray = new MotionNetNode[numberOfNodes];
-
-  for(int i = 0; i < numberOfNodes; ++i)
+  std::vector<MotionNetNode> nodes(numberOfNodes);
+  for(MotionNetNode& node : nodes)
   {
     short s = static_cast<short>(motionData[dataCounter++]);
 
     switch(s)
     {
       case 2:
-        nodeArray[i].d[0] = static_cast<short>(MotionNetNode::typeTransition);
-        nodeArray[i].d[1] = motionData[dataCounter++];
-        nodeArray[i].d[Joints::numOfJoints + 3] = motionData[dataCounter++];
+        node.d[0] = static_cast<short>(MotionNetNode::typeTransition);
+        node.d[1] = motionData[dataCounter++];
+        node.d[Joints::numOfJoints + 3] = motionData[dataCounter++];
         break;
       case 1:
-        nodeArray[i].d[0] = static_cast<short>(MotionNetNode::typeConditionalTransition);
-        nodeArray[i].d[1] = motionData[dataCounter++];
-        nodeArray[i].d[2] = motionData[dataCounter++];
-        nodeArray[i].d[Joints::numOfJoints + 3] = motionData[dataCounter++];
+        node.d[0] = static_cast<short>(MotionNetNode::typeConditionalTransition);
+        node.d[1] = motionData[dataCounter++];
+        node.d[2] = motionData[dataCounter++];
+        node.d[Joints::numOfJoints + 3] = motionData[dataCounter++];
         break;
       case 4:
-        nodeArray[i].d[0] = static_cast<short>(MotionNetNode::typeStiffness);
+        node.d[0] = static_cast<short>(MotionNetNode::typeStiffness);
         for(int j = 1; j < Joints::numOfJoints + 3; j++)
-          nodeArray[i].d[j] = motionData[dataCounter++];
+          node.d[j] = motionData[dataCounter++];
         break;
       case 3:
-        nodeArray[i].d[0] = static_cast<short>(MotionNetNode::typeData);
+        node.d[0] = static_cast<short>(MotionNetNode::typeData);
         for(int j = 1; j < Joints::numOfJoints + 1; ++j)
         {
-          nodeArray[i].d[j] = motionData[dataCounter++];
-          if(nodeArray[i].d[j] != JointAngles::off    &&
-             nodeArray[i].d[j] != JointAngles::ignore)
-            nodeArray[i].d[j] = Angle::fromDegrees(nodeArray[i].d[j]);
+          node.d[j] = motionData[dataCounter++];
+          if(node.d[j] != JointAngles::off    &&
+             node.d[j] != JointAngles::ignore)
+            node.d[j] = Angle::fromDegrees(node.d[j]);
         }
         for(int k = Joints::numOfJoints + 1; k < Joints::numOfJoints + 4; ++k)
-          nodeArray[i].d[k] = motionData[dataCounter++];
+          node.d[k] = motionData[dataCounter++];
         break;
     }
   }
+
+  newImage.resize(jumpTableSize + nodes.size() * sizeof(MotionNetNode));
+  if(!nodes.empty())
+    std::memcpy(newImage.data() + jumpTableSize, nodes.data(), nodes.size() * sizeof(MotionNetNode));
+  image.set(std::move(newImage), name, imageVersion, hash);
+  useImage();
 }
 
 SpecialActions::SpecialActions() :
@@ -79,14 +114,9 @@ SpecialActions::SpecialActions() :
 {
   theInstance = this;
 
-  std::vector<float> motionData;
   char errorBuffer[10000];
-  MofCompiler* mofCompiler = new MofCompiler;
-  if(!mofCompiler->compileMofs(errorBuffer, sizeof(errorBuffer), motionData))
+  if(!motionNetData.load(errorBuffer, sizeof(errorBuffer)))
     OUTPUT_TEXT("Error while parsing mof files:");
-  else
-    motionNetData.load(motionData);
-  delete mofCompiler;
 
   if(*errorBuffer)
     OUTPUT_TEXT("  " << errorBuffer);
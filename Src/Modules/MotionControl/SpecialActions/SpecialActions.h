@@ -16,6 +16,7 @@
 #include "Representations/Infrastructure/JointRequest.h"
 #include "Tools/MessageQueue/InMessage.h"
 #include "Tools/Module/Module.h"
+#include "Tools/PrecomputedTable.h"
 
 MODULE(SpecialActions,
 {,
@@ -60,7 +61,7 @@ private:
       dataRepetitionCounter = static_cast<int>(d[Joints::numOfJoints + 2]);
     }
 
-    void toStiffnessRequest(StiffnessData& stiffnessRequest, int& stiffnessInterpolationTime)
+    void toStiffnessRequest(StiffnessData& stiffnessRequest, int& stiffnessInterpolationTime) const
     {
       for(int i = 0; i < Joints::numOfJoints; i++)
         stiffnessRequest.stiffnesses[i] = static_cast<int>(d[i + 1]);
@@ -75,24 +76,44 @@ private:
 
   /**
    * MotionNetData encapsulates all the motion data in the motion net.
+   * The motion net is stored as a binary image that starts with the jump
+   * table, followed by the nodes. The image compiled from the mof files
+   * is saved, so later runs just map it into memory and use it in place.
    */
   class MotionNetData
   {
-  public:
-    /** Default constructor. */
-    MotionNetData() : nodeArray(0) {}
+  private:
+    static const unsigned imageVersion = 1; /**< The version of the layout of the image file. */
+    static const short noJumpTable[SpecialActionRequest::numOfSpecialActionIDs + 1]; /**< Used while no motion net was loaded. */
+
+    PrecomputedTable image; /**< The image of the motion net. */
 
-    /** Destructor. */
-    ~MotionNetData() {if(nodeArray) delete[] nodeArray;}
+    /** Points label_extern_start and nodeArray to the current image. */
+    void useImage();
+
+  public:
+    /**
+     * Maps the image of the motion net if it matches the mof files.
+     * Otherwise, it compiles the mof files and saves the image.
+     * @param errorBuffer A buffer that receives any error message output.
+     * @param size The length of the buffer.
+     * @return Was the motion net loaded?
+     */
+    bool load(char* errorBuffer, size_t size);
 
-    /** Loads the motion net. */
-    void load(std::vector<float>& motionData);
+    /**
+     * Loads a motion net from the output of the MofCompiler.
+     * @param motionData The motion data.
+     * @param name The name of the file the image is saved to. If empty, it is not saved.
+     * @param hash The hash of the mof files the motion data was compiled from.
+     */
+    void load(const std::vector<float>& motionData, const std::string& name = "", uint64_t hash = 0);
 
     /** jump table from extern.mof: get start index from request */
-    short label_extern_start[SpecialActionRequest::numOfSpecialActionIDs + 1];
+    const short* label_extern_start = noJumpTable;
 
     /** The motion net */
-    MotionNetNode* nodeArray;
+    const MotionNetNode* nodeArray = nullptr;
   };
 
   /**
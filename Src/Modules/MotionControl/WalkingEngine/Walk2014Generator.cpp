@@ -106,7 +106,7 @@ void Walk2014Generator::reset(WalkGenerator& generator)
   weightShiftStatus = weightDidNotShift;
   filteredGyroX = filteredGyroY = 0_deg;
   prevForwardL = prevForwardR = 0.f;
-  prevLeftL = prevLeftR = 0_deg;
+  prevTanLeftL = prevTanLeftR = 0.f;
   prevTurn = 0_deg;
   weightShiftMisses = 0;
   slowWeightShifts = 0;
@@ -332,17 +332,21 @@ void Walk2014Generator::calcJoints(WalkGenerator& generator,
   } // end of changing support foot
 
   // 8. Odometry update for localization
-  generator.odometryOffset = calcOdometryOffset(generator.isLeftPhase);
+  const float tanLeftL = std::tan(leftL);
+  const float tanLeftR = std::tan(leftR);
+  generator.odometryOffset = calcOdometryOffset(generator.isLeftPhase, tanLeftL, tanLeftR);
 
   // 9.1 Foot poses
-  Pose3f leftFoot = Pose3f(0, theRobotDimensions.yHipOffset, 0)
-                    .rotateX(-leftL)
-                    .translate(-forwardL * mmPerM - torsoOffset, 0, -(walkHipHeight - theRobotDimensions.footHeight - foothL * mmPerM) / std::cos(leftL))
-                    .rotateX(leftL).rotateZ(turnRL).translate(0, 0, -theRobotDimensions.footHeight);
-  Pose3f rightFoot = Pose3f(0, -theRobotDimensions.yHipOffset, 0)
-                     .rotateX(-leftR)
-                     .translate(-forwardR * mmPerM - torsoOffset, 0, -(walkHipHeight - theRobotDimensions.footHeight - foothR * mmPerM) / std::cos(leftR))
-                     .rotateX(leftR).rotateZ(-turnRL).translate(0, 0, -theRobotDimensions.footHeight);
+  // This is the closed form of rotating the leg sideways by "left", stretching it to keep the hip height
+  // and rotating the foot back to be parallel to the ground, which saves the trigonometry of the rotations.
+  const float legLengthL = walkHipHeight - theRobotDimensions.footHeight - foothL * mmPerM;
+  const float legLengthR = walkHipHeight - theRobotDimensions.footHeight - foothR * mmPerM;
+  Pose3f leftFoot(RotationMatrix::aroundZ(turnRL),
+                  Vector3f(-forwardL * mmPerM - torsoOffset, theRobotDimensions.yHipOffset - tanLeftL * legLengthL,
+                           -legLengthL - theRobotDimensions.footHeight));
+  Pose3f rightFoot(RotationMatrix::aroundZ(-turnRL),
+                   Vector3f(-forwardR * mmPerM - torsoOffset, -theRobotDimensions.yHipOffset - tanLeftR * legLengthR,
+                            -legLengthR - theRobotDimensions.footHeight));
 
   // 9.2 Walk kicks
   if(getKickFootOffset)
@@ -417,17 +421,17 @@ void Walk2014Generator::calcFootOffsets(WalkGenerator& generator,
   footHeightSupport = maxFootHeight0 * parabolicReturn((switchPhase + generator.t) / generator.stepDuration); // return support foot to 0 if it was still lifted
 }
 
-Pose2f Walk2014Generator::calcOdometryOffset(bool isLeftSwingFoot)
+Pose2f Walk2014Generator::calcOdometryOffset(bool isLeftSwingFoot, float tanLeftL, float tanLeftR)
 {
   // Work out incremental forward, left, and turn values for next time step
   Pose2f offset((turnRL - prevTurn) * (isLeftSwingFoot ? 1.f : -1.f) * odometryScale.rotation,
                 (isLeftSwingFoot ? forwardR - prevForwardR : forwardL - prevForwardL) * mmPerM * odometryScale.translation.x(),
-                (walkHipHeight - theRobotDimensions.footHeight) * (isLeftSwingFoot ? std::tan(leftR) - std::tan(prevLeftR) : std::tan(leftL) - std::tan(prevLeftL)) * odometryScale.translation.y());
+                (walkHipHeight - theRobotDimensions.footHeight) * (isLeftSwingFoot ? tanLeftR - prevTanLeftR : tanLeftL - prevTanLeftL) * odometryScale.translation.y());
 
   // backup values for next computation
   prevTurn = turnRL;
-  prevLeftL = leftL;
-  prevLeftR = leftR;
+  prevTanLeftL = tanLeftL;
+  prevTanLeftR = tanLeftR;
   prevForwardL = forwardL;
   prevForwardR = forwardR;
 
@@ -517,11 +521,13 @@ void Walk2014Generator::compensateArmPosition(const Pose3f& leftFoot, const Pose
   for(int joint = 0; joint < Joints::firstArmJoint; ++joint)
     temp.angles[joint] = theJointRequest.angles[joint] != JointRequest::off
                          ? theJointRequest.angles[joint] : theJointAngles.angles[joint];
-  RobotModel withWalkGeneratorArms(temp, theRobotDimensions, theMassCalibration);
+  const RobotModel withWalkGeneratorArms(temp, theRobotDimensions, theMassCalibration);
+  const JointRequest withWalkGeneratorArmsAngles = temp;
   for(int joint = Joints::firstArmJoint; joint < Joints::firstLegJoint; ++joint)
     temp.angles[joint] = theJointRequest.angles[joint] != JointRequest::off
                          ? theJointRequest.angles[joint] : theJointAngles.angles[joint];
-  RobotModel balanced(temp, theRobotDimensions, theMassCalibration);
+  RobotModel balanced = withWalkGeneratorArms;
+  balanced.updateJointData(temp, withWalkGeneratorArmsAngles, theRobotDimensions, theMassCalibration); // only the arms changed
 
   float torsoTilt = 0.f;
   for(int i = 0; i < numOfComIterations; ++i)
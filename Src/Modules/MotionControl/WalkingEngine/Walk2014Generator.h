@@ -164,8 +164,8 @@ class Walk2014Generator : public Walk2014GeneratorBase
   Angle filteredGyroY; /**< Lowpass-filtered gyro measurements around y axis (in radians/s). */
   float prevForwardL; /**< The value of "forwardL" in the previous cycle. For odometry calculation. */
   float prevForwardR; /**< The value of "forwardR" in the previous cycle. For odometry calculation. */
-  Angle prevLeftL; /**< The value of "leftL" in the previous cycle. For odometry calculation. */
-  Angle prevLeftR; /**< The value of "leftR" in the previous cycle. For odometry calculation. */
+  float prevTanLeftL; /**< The tangent of "leftL" in the previous cycle. For odometry calculation. */
+  float prevTanLeftR; /**< The tangent of "leftR" in the previous cycle. For odometry calculation. */
   Angle prevTurn; /**< The value of "turn" in the previous cycle. For odometry calculation. */
   int weightShiftMisses; /**< How often was the weight not shifted in a row? */
   int slowWeightShifts; /**< How often took the weight shift significantly longer in a row? */
@@ -191,9 +191,11 @@ class Walk2014Generator : public Walk2014GeneratorBase
   /**
    * Determines the motion of the robot since the previous frame.
    * @param isLeftSwingFoot Is the left foot the current swing foot?
+   * @param tanLeftL The tangent of the current sideways angle of the left foot.
+   * @param tanLeftR The tangent of the current sideways angle of the right foot.
    * @return The offset in mm and radians.
    */
-  Pose2f calcOdometryOffset(bool isLeftSwingFoot);
+  Pose2f calcOdometryOffset(bool isLeftSwingFoot, float tanLeftL, float tanLeftR);
 
   /**
    * Return a measure for how "big" the requested motion is, i.e. the "walk volume".
@@ -17,6 +17,7 @@ WalkingEngine::WalkingEngine() : walkKickEngine(theWalkKicks)
 
 void WalkingEngine::update(WalkingEngineOutput& walkingEngineOutput)
 {
+  walkKickEngine.precompute();
   beginFrame(theFrameInfo.time);
   execute(OptionInfos::getOption("Root"));
   endFrame();
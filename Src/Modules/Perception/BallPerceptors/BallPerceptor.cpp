@@ -16,6 +16,9 @@
 #include "Tools/Math/Transformation.h"
 #include "Tools/Settings.h"
 #include "Tools/Streams/InStreams.h"
+#include <algorithm>
+#include <cstring>
+#include <unordered_set>
 
 MAKE_MODULE(BallPerceptor, perception)
 
@@ -82,6 +85,9 @@ void BallPerceptor::update(BallPercept& ballPercept)
         objects.clear();
     }
 
+    // Collect the candidates of all regions first and refine them as one batch.
+    // Overlapping regions often yield the same ball, which is only refined once.
+    ObjectCNSStereoDetector::IsometryWithResponses candidates;
     for(const Boundaryi& region : theBallRegions.regions)
     {
       spec.blockX = region.x.getSize();
@@ -89,25 +95,24 @@ void BallPerceptor::update(BallPercept& ballPercept)
       detector.setSearchSpecification(spec);
       ObjectCNSStereoDetector::IsometryWithResponses newObjects;
       detector.searchBlockAllPoses(newObjects, theCNSImage, region.x.min, region.y.min);
+      candidates.insert(candidates.end(), newObjects.begin(), newObjects.end());
+    }
+
+    for(const IsometryWithResponse& object : candidates)
+      if(object.response >= minResponse)
+        objects.emplace_back(object);
 
-      for(const IsometryWithResponse& object : newObjects)
+    if(spec.nRefineIterations > 0)
+    {
+      detector.refineAll(theCNSImage, candidates);
+      for(const IsometryWithResponse& object : candidates)
         if(object.response >= minResponse)
           objects.emplace_back(object);
-
-      if(spec.nRefineIterations > 0)
-      {
-        for(IsometryWithResponse& object : newObjects)
-          detector.refine(theCNSImage, object, spec.nRefineIterations);
-
-        for(const IsometryWithResponse& object : newObjects)
-          if(object.response >= minResponse)
-            objects.emplace_back(object);
-      }
     }
 
     sort(objects.begin(), objects.end(), MoreOnResponse());
 
-    std::vector<IsometryWithResponse> guesses;
+    FrameVector<IsometryWithResponse> guesses;
     while(!objects.empty())
     {
       ballPercept.status = checkBall(objects.front());
@@ -177,6 +182,7 @@ void BallPerceptor::updateSearchSpace()
                                     theBallSpecification.radius + 1.f);
   spec.nRefineIterations = refineIterations;
   spec.stepInPixelDuringRefinement = refineStepSize;
+  spec.minDistanceBetweenObjects = theBallSpecification.radius;
   spec.object2WorldOrientation.clear();
   Vector3f up = theCameraMatrix.rotation.inverse() * Vector3f::UnitZ();
   spec.object2WorldOrientation.push_back(fromTo(Vector3d::UnitZ(), Vector3d(-up.y(), -up.z(), up.x())));
@@ -258,7 +264,7 @@ BallPercept::Status BallPerceptor::checkBall(const IsometryWithResponse& object)
   int greenCount;
   int nonWhiteCount;
   const float response = static_cast<float>(object.response);
-  std::vector<unsigned char> brightnesses;
+  FrameVector<unsigned char> brightnesses;
   brightnesses.reserve(samplePoints.size());
   int threshold;
   BallPattern pattern = 0;
@@ -340,6 +346,7 @@ void BallPerceptor::countAtRadius(const Vector2i& center, float radius, int& gre
       return x >= 0 && x < theECImage.colored.width &&
              y >= 0 && y < theECImage.colored.height;
     };
+  theECImage.prepare(center.y() - static_cast<int>(radius) - 1, center.y() + static_cast<int>(radius) + 2);
   const float epsilon = pi2 / static_cast<float>(numberOfGreenChecks);
   float dx = -radius;
   float dy = 0.f;
@@ -386,13 +393,13 @@ bool BallPerceptor::print(bool result, const char* label) const
   return result;
 }
 
-bool BallPerceptor::checkSamplePoints(const IsometryWithResponse& object, bool accepted, std::vector<unsigned char>& brightnesses, int& threshold, BallPattern& pattern) const
+bool BallPerceptor::checkSamplePoints(const IsometryWithResponse& object, bool accepted, FrameVector<unsigned char>& brightnesses, int& threshold, BallPattern& pattern) const
 {
   const double aroundX = std::atan2(object.translation().y(), object.translation().z());
   const double aroundY = std::atan2(object.translation().x(), object.translation().z());
   const Quaterniond rotation = Quaterniond(Eigen::AngleAxisd(-aroundX, Vector3d::UnitX())) *
                                Quaterniond(Eigen::AngleAxisd(aroundY, Vector3d::UnitY()));
-  std::vector<Vector2i> points;
+  FrameVector<Vector2i> points;
   points.reserve(samplePoints.size());
   brightnesses.clear();
   threshold = 0;
@@ -409,6 +416,7 @@ bool BallPerceptor::checkSamplePoints(const IsometryWithResponse& object, bool a
     if(point.x() >= theCameraInfo.width || point.y() >= theCameraInfo.height)
       return false;
     points.push_back(point);
+    theECImage.prepare(point.y(), point.y() + 1);
     const float z = static_cast<float>((ballInWorld * visiblePoint).z());
     const float factor = 1.f + (1.f - z / theBallSpecification.radius) * brightnessBonus;
     const int brightness = std::min(255, static_cast<int>(theECImage.grayscaled[point.y()][point.x()] * factor));
@@ -429,10 +437,11 @@ bool BallPerceptor::checkSamplePoints(const IsometryWithResponse& object, bool a
     pattern = pattern << 1 | (dark ? 0 : 1);
   }
 
-  return ballPatterns.find(pattern) != ballPatterns.end();
+  const BallPattern* begin = reinterpret_cast<const BallPattern*>(ballPatterns.getData());
+  return std::binary_search(begin, begin + ballPatterns.getSize() / sizeof(BallPattern), pattern);
 }
 
-int BallPerceptor::calcThreshold(const std::vector<unsigned char>& brightnesses)
+int BallPerceptor::calcThreshold(const FrameVector<unsigned char>& brightnesses)
 {
   // Build histogram
   std::array<unsigned char, 256> histogram;
@@ -485,7 +494,7 @@ int BallPerceptor::calcThreshold(const std::vector<unsigned char>& brightnesses)
   return bestThreshold;
 }
 
-bool BallPerceptor::checkContrast(const std::vector<unsigned char>& brightnesses, int threshold) const
+bool BallPerceptor::checkContrast(const FrameVector<unsigned char>& brightnesses, int threshold) const
 {
   unsigned sumBlack = 0;
   unsigned sumWhite = 0;
@@ -511,43 +520,33 @@ bool BallPerceptor::checkContrast(const std::vector<unsigned char>& brightnesses
 
 void BallPerceptor::createOrLoadPatternTable()
 {
-  const size_t bytesPerPattern = (samplePoints.size() + 7) / 8;
-  ASSERT(sizeof(BallPattern) >= bytesPerPattern);
+  ASSERT(sizeof(BallPattern) * 8 >= samplePoints.size());
 
-  InBinaryFile in("ballPatterns.dat");
-  if(in.exists())
-  {
-    unsigned size;
-    BallPattern ballPattern = 0;
-    in >> size;
-    ballPatterns.clear();
-    ballPatterns.reserve(size);
-    while(size-- > 0)
-    {
-      in.read(&ballPattern, bytesPerPattern);
-      ballPatterns.insert(ballPattern);
-    }
-    return;
-  }
-
-  unsigned char ballTexture[ballTextureHeight][ballTextureWidth];
+  unsigned char ballTexture[ballTextureHeight][ballTextureWidth] = {{0}};
   InBinaryFile stream("ballTexture.dat");
   if(stream.exists())
     stream.read(ballTexture, sizeof(ballTexture));
 
-  ballPatterns.clear();
+  PrecomputedTable::Hash hash;
+  hash << samplePoints << sampleRange << sampleStep << ballTexture;
+  if(ballPatterns.load("ballPatterns.dat", ballPatternsVersion, hash))
+    return;
+
+  std::unordered_set<BallPattern> patterns;
   for(float x = -sampleRange; x < sampleRange; x += sampleStep)
   {
     printf("%f\n", x);
     for(float y = -sampleRange; y < sampleRange; y += sampleStep)
       for(float z = -sampleRange; z < sampleRange; z += sampleStep)
-        ballPatterns.insert(getPattern(ballTexture, x, y, z));
+        patterns.insert(getPattern(ballTexture, x, y, z));
   }
 
-  OutBinaryFile out("ballPatterns.dat");
-  out << static_cast<unsigned>(ballPatterns.size());
-  for(BallPattern ballPattern : ballPatterns)
-    out.write(&ballPattern, bytesPerPattern);
+  std::vector<BallPattern> sortedPatterns(patterns.begin(), patterns.end());
+  std::sort(sortedPatterns.begin(), sortedPatterns.end());
+  std::vector<char> table(sortedPatterns.size() * sizeof(BallPattern));
+  if(!table.empty())
+    std::memcpy(table.data(), sortedPatterns.data(), table.size());
+  ballPatterns.set(std::move(table), "ballPatterns.dat", ballPatternsVersion, hash);
 }
 
 BallPerceptor::BallPattern BallPerceptor::getPattern(unsigned char ballTexture[ballTextureHeight][ballTextureWidth], float x, float y, float z) const
@@ -26,10 +26,11 @@
 #include "Representations/Perception/ImagePreprocessing/ImageCoordinateSystem.h"
 #include "Representations/Perception/ImagePreprocessing/ImageRegions.h"
 #include "Tools/ImageProcessing/CNS/ObjectCNSStereoDetector.h"
+#include "Tools/FrameArena.h"
 #include "Tools/Math/Eigen.h"
 #include "Tools/Module/Module.h"
+#include "Tools/PrecomputedTable.h"
 #include "Tools/Streams/OutStreams.h"
-#include <unordered_set>
 
 MODULE(BallPerceptor,
 {,
@@ -97,7 +98,8 @@ private:
   static const int ballTextureHeight = 150; /**< Height of the texture the ball patterns are generated from (in pixels). */
 
   using BallPattern = unsigned; /**< The type of a ball pattern. */
-  std::unordered_set<BallPattern> ballPatterns; /**< Is the bit pattern a valid ball pattern? */
+  static const unsigned ballPatternsVersion = 1; /**< The version of the layout of the file storing the ball patterns. */
+  PrecomputedTable ballPatterns; /**< The sorted valid ball patterns (memory-mapped if loaded). */
 
   /**
    * The main method of this module.
@@ -155,7 +157,7 @@ private:
    * @param pattern The pattern determined is returned here.
    * @return Could it be the ball?
    */
-  bool checkSamplePoints(const IsometryWithResponse& object, bool accepted, std::vector<unsigned char>& brightnesses, int& threshold, BallPattern& pattern) const;
+  bool checkSamplePoints(const IsometryWithResponse& object, bool accepted, FrameVector<unsigned char>& brightnesses, int& threshold, BallPattern& pattern) const;
 
   /**
    * Determine the threshold separating the brightnesses into two classes
@@ -164,7 +166,7 @@ private:
    * @param brigtnesses The brightnesses measured.
    * @return The best threshold to split them into two classes.
    */
-  static int calcThreshold(const std::vector<unsigned char>& brightnesses);
+  static int calcThreshold(const FrameVector<unsigned char>& brightnesses);
 
   /**
    * Checks whether there is enough contrast between the dark samples and the
@@ -173,7 +175,7 @@ private:
    * @param threshold the threshold between dark and bright.
    * @return Is there enough contrast?
    */
-  bool checkContrast(const std::vector<unsigned char>& brightnesses, int threshold) const;
+  bool checkContrast(const FrameVector<unsigned char>& brightnesses, int threshold) const;
 
   /**
    * Determines whether the first parameter is less or equal to the
@@ -202,7 +204,8 @@ private:
   void fillBallPercept(BallPercept& ballPercept) const;
 
   /**
-   * Create or load the ball pattern table from the ball texture.
+   * Create or load the ball pattern table from the ball texture. A stored table
+   * is only used if it was generated from the same texture and parameters.
    */
   void createOrLoadPatternTable();
 
@@ -91,6 +91,7 @@ bool BallSpotsProvider::correctWithScanLeftAndRight(Vector2i& initialPoint, cons
   int leftMaximum(0), rightMaximum(theECImage.colored.width);
   theBodyContour.clipLeft(leftMaximum, initialPoint.y());
   theBodyContour.clipRight(rightMaximum, initialPoint.y());
+  theECImage.prepare(initialPoint.y(), initialPoint.y() + 1);
 
   const int maxLeftScanLength = std::min(maxScanLength, initialPoint.x() - leftMaximum);
   const int maxRightScanLength = std::min(maxScanLength, rightMaximum - initialPoint.x());
@@ -189,6 +190,7 @@ bool BallSpotsProvider::checkGreenAround(const Vector2i& spot, const float radiu
      spot.x() + 1 + useRadius >= theECImage.colored.width ||
      spot.y() + 1 + useRadius >= theECImage.colored.height)
     return false;
+  theECImage.prepare(spot.y() - useRadius - 1, spot.y() + useRadius + 2);
 
   int count(0);
   const int lastX = spot.x() + useRadius - 1;
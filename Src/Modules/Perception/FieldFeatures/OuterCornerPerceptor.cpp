@@ -9,6 +9,12 @@ void OuterCornerPerceptor::update(OuterCorner& outerCorner)
 {
   outerCorner.clear();
 
+  if(!hasCornerSignature())
+  {
+    outerCorner.isValid = false;
+    return;
+  }
+
   if(searchForLAndPA(outerCorner)
      || searchForBigLAndT(outerCorner)
      || searchForBigLAndTL(outerCorner)
@@ -18,6 +24,15 @@ void OuterCornerPerceptor::update(OuterCorner& outerCorner)
     outerCorner.isValid = false;
 }
 
+bool OuterCornerPerceptor::hasCornerSignature() const
+{
+  for(const FieldLineIntersections::Intersection& intersection : theFieldLineIntersections.intersections)
+    if(intersection.type == FieldLineIntersections::Intersection::L &&
+       (intersection.additionalType == FieldLineIntersections::Intersection::big || thePenaltyArea.isValid))
+      return true;
+  return false;
+}
+
 bool OuterCornerPerceptor::searchForBigLAndT(OuterCorner& outerCorner) const
 {
   std::vector<const FieldLineIntersections::Intersection*> useBigLIntersections;
@@ -43,6 +43,12 @@ class OuterCornerPerceptor : public OuterCornerPerceptorBase
 {
   void update(OuterCorner& outerCorner);
 private:
+  /**
+   * Cheap check whether the intersections can contain an outer corner at all,
+   * i.e. there is a big L or there is any L and a valid penalty area.
+   */
+  bool hasCornerSignature() const;
+
   bool searchForLAndPA(OuterCorner& outerCorner) const;
   bool searchForBigLAndT(OuterCorner& outerCorner) const;
   bool searchForBigLAndTL(OuterCorner& outerCorner) const;
@@ -27,6 +27,7 @@ void LinePerceptor::update(LinesPercept& linesPercept)
 
   linesPercept.lines.clear();
   circleCandidates.clear();
+  prepareECImage();
 
   if(doAdvancedWidthChecks)
   {
@@ -51,6 +52,7 @@ void LinePerceptor::update(CirclePercept& circlePercept)
   DECLARE_DEBUG_DRAWING("module:LinePerceptor:circleCheckPointField", "drawingOnField");
 
   circlePercept.wasSeen = false;
+  prepareECImage();
 
   // Find a valid center circle in the circle candidates
   for(CircleCandidate& candidate : circleCandidates)
@@ -84,6 +86,8 @@ void LinePerceptor::update(CirclePercept& circlePercept)
   clusters.clear();
   for(const LinesPercept::Line& line : theLinesPercept.lines)
   {
+    if(line.spotsInField.size() < 3)
+      continue;
     for(auto it = line.spotsInField.cbegin(); it < line.spotsInField.cend() - 2; it++)
     {
       const Vector2f& a = *it;
@@ -124,6 +128,18 @@ void LinePerceptor::update(CirclePercept& circlePercept)
   }
 }
 
+void LinePerceptor::prepareECImage() const
+{
+  int top = 0;
+  if(theFieldBoundary.isValid && !theFieldBoundary.boundaryInImage.empty())
+  {
+    top = theECImage.colored.height;
+    for(const Vector2i& point : theFieldBoundary.boundaryInImage)
+      top = std::min(top, point.y());
+  }
+  theECImage.prepare(top, theECImage.colored.height);
+}
+
 void LinePerceptor::clusterCircleCenter(const Vector2f& center)
 {
   for(CircleCluster& cluster : clusters)
@@ -131,12 +147,7 @@ void LinePerceptor::clusterCircleCenter(const Vector2f& center)
     if((cluster.center - center).squaredNorm() <= sqrCircleClusterRadius)
     {
       cluster.centers.emplace_back(center);
-      Vector2f newCenter(0, 0);
-      for(const Vector2f& c : cluster.centers)
-      {
-        newCenter += c;
-      }
-      cluster.center = newCenter / static_cast<float>(cluster.centers.size());
+      cluster.center += (center - cluster.center) / static_cast<float>(cluster.centers.size()); // running mean
       return;
     }
   }
@@ -189,7 +200,8 @@ template<bool advancedWidthChecks> void LinePerceptor::scanHorizontalScanlines(L
               if(candidate.getDistance(thisSpot.field) <= maxCircleFittingError)
               {
                 candidate.fieldSpots.emplace_back(thisSpot.field);
-                leastSquaresCircleFit(candidate.fieldSpots, candidate.center, candidate.radius);
+                CYCLE_STOPWATCH("LinePerceptor:circleFit")
+                  leastSquaresCircleFit(candidate.fieldSpots, candidate.center, candidate.radius);
                 circleFitted = true;
                 break;
               }
@@ -216,7 +228,7 @@ template<bool advancedWidthChecks> void LinePerceptor::scanHorizontalScanlines(L
                 if(!lineFitted && (!advancedWidthChecks || thisSpot.field.x() > maxWidthCheckDistance || getAbsoluteDeviation(theFieldDimensions.fieldLinesWidth, getLineWidthAtSpot(thisSpot, candidate.n0)) <= maxLineWidthDeviation))
                 {
                   thisSpot.candidate = candidate.spots.front()->candidate;
-                  candidate.spots.emplace_back(&thisSpot);
+                  candidate.addSpot(&thisSpot);
                   candidate.fitLine();
                   if(circleFitted)
                     goto hEndAdjacentSearch;
@@ -236,7 +248,7 @@ template<bool advancedWidthChecks> void LinePerceptor::scanHorizontalScanlines(L
                 if(!advancedWidthChecks || (thisSpot.field.x() > maxWidthCheckDistance && spot.field.x() > maxWidthCheckDistance))
                 {
                   thisSpot.candidate = candidate.spots.front()->candidate;
-                  candidate.spots.emplace_back(&thisSpot);
+                  candidate.addSpot(&thisSpot);
                   candidate.fitLine();
                   goto hEndAdjacentSearch;
                 }
@@ -248,7 +260,7 @@ template<bool advancedWidthChecks> void LinePerceptor::scanHorizontalScanlines(L
                   if(std::max(thisSpot.field.x() > maxWidthCheckDistance ? 0 : getAbsoluteDeviation(theFieldDimensions.fieldLinesWidth, getLineWidthAtSpot(thisSpot, n0)), spot.field.x() > maxWidthCheckDistance ? 0 : getAbsoluteDeviation(theFieldDimensions.fieldLinesWidth, getLineWidthAtSpot(spot, n0))) <= maxLineWidthDeviation)
                   {
                     thisSpot.candidate = candidate.spots.front()->candidate;
-                    candidate.spots.emplace_back(&thisSpot);
+                    candidate.addSpot(&thisSpot);
                     candidate.fitLine();
                     goto hEndAdjacentSearch;
                   }
@@ -377,7 +389,8 @@ template<bool advancedWidthChecks> void LinePerceptor::scanVerticalScanlines(Lin
               if(candidate.getDistance(thisSpot.field) <= maxCircleFittingError)
               {
                 candidate.fieldSpots.emplace_back(thisSpot.field);
-                leastSquaresCircleFit(candidate.fieldSpots, candidate.center, candidate.radius);
+                CYCLE_STOPWATCH("LinePerceptor:circleFit")
+                  leastSquaresCircleFit(candidate.fieldSpots, candidate.center, candidate.radius);
                 circleFitted = true;
                 break;
               }
@@ -404,7 +417,7 @@ template<bool advancedWidthChecks> void LinePerceptor::scanVerticalScanlines(Lin
                 if(!lineFitted && (!advancedWidthChecks || thisSpot.field.x() > maxWidthCheckDistance || getAbsoluteDeviation(theFieldDimensions.fieldLinesWidth, getLineWidthAtSpot(thisSpot, candidate.n0)) <= maxLineWidthDeviation))
                 {
                   thisSpot.candidate = candidate.spots.front()->candidate;
-                  candidate.spots.emplace_back(&thisSpot);
+                  candidate.addSpot(&thisSpot);
                   candidate.fitLine();
                   if(circleFitted)
                     goto vEndAdjacentSearch;
@@ -424,7 +437,7 @@ template<bool advancedWidthChecks> void LinePerceptor::scanVerticalScanlines(Lin
                 if(!advancedWidthChecks || (thisSpot.field.x() > maxWidthCheckDistance && spot.field.x() > maxWidthCheckDistance))
                 {
                   thisSpot.candidate = candidate.spots.front()->candidate;
-                  candidate.spots.emplace_back(&thisSpot);
+                  candidate.addSpot(&thisSpot);
                   candidate.fitLine();
                   goto vEndAdjacentSearch;
                 }
@@ -436,7 +449,7 @@ template<bool advancedWidthChecks> void LinePerceptor::scanVerticalScanlines(Lin
                   if(std::max(thisSpot.field.x() > maxWidthCheckDistance ? 0 : getAbsoluteDeviation(theFieldDimensions.fieldLinesWidth, getLineWidthAtSpot(thisSpot, n0)), spot.field.x() > maxWidthCheckDistance ? 0 : getAbsoluteDeviation(theFieldDimensions.fieldLinesWidth, getLineWidthAtSpot(spot, n0))) <= maxLineWidthDeviation)
                   {
                     thisSpot.candidate = candidate.spots.front()->candidate;
-                    candidate.spots.emplace_back(&thisSpot);
+                    candidate.addSpot(&thisSpot);
                     candidate.fitLine();
                     goto vEndAdjacentSearch;
                   }
@@ -780,20 +793,12 @@ void LinePerceptor::Candidate::fitLine()
   ASSERT(spots.size() > 0);
 
   // https://de.wikipedia.org/wiki/Lineare_Regression#Berechnung_der_Regressionsgeraden
-  Vector2f avg(0, 0);
-  for(const Spot* spot : spots)
-  {
-    avg += spot->field;
-  }
-  avg /= static_cast<float>(spots.size());
-
-  float SSxx = 0, SSxy = 0;
-  for(const Spot* spot : spots)
-  {
-    const float xDiff = spot->field.x() - avg.x();
-    SSxx += sqr(xDiff);
-    SSxy += xDiff * (spot->field.y() - avg.y());
-  }
+  const double n = static_cast<double>(spots.size());
+  const double avgX = sumX / n;
+  const double avgY = sumY / n;
+  const Vector2f avg = spots.front()->field + Vector2f(static_cast<float>(avgX), static_cast<float>(avgY));
+  const float SSxx = static_cast<float>(sumXX - n * avgX * avgX);
+  const float SSxy = static_cast<float>(sumXY - n * avgX * avgY);
 
   if(Approx::isZero(SSxx))
   {
@@ -94,6 +94,22 @@ private:
       spots.emplace_back(anchor);
     }
 
+    /**
+     * Adds a spot and updates the sums from which the line is fitted.
+     *
+     * @param spot the spot to add
+     */
+    inline void addSpot(const Spot* spot)
+    {
+      spots.emplace_back(spot);
+      const double x = spot->field.x() - spots.front()->field.x();
+      const double y = spot->field.y() - spots.front()->field.y();
+      sumX += x;
+      sumY += y;
+      sumXX += x * x;
+      sumXY += x * y;
+    }
+
     /**
      * Calculates the distance of the given point to this line candidate.
      *
@@ -108,6 +124,13 @@ private:
      * Recalculates n0 and d.
      */
     void fitLine();
+
+  private:
+    /** Sums over the offsets of all spots to the first spot, so fitting does not iterate over the spots. */
+    double sumX = 0.;
+    double sumY = 0.;
+    double sumXX = 0.;
+    double sumXY = 0.;
   };
 
   /**
@@ -180,6 +203,12 @@ private:
    */
   void update(CirclePercept& circlePercept);
 
+  /**
+   * Makes sure that the ECImage is computed in the area that can contain
+   * field lines, i.e. below the highest point of the field boundary.
+   */
+  void prepareECImage() const;
+
   /**
    * Scans the ColorScanlineRegionsHorizontal for line candidates.
    *
@@ -12,7 +12,7 @@
 #include "Tools/ImageProcessing/InImageSizeCalculations.h"
 #include "Tools/Math/Transformation.h"
 
-MAKE_MODULE(PenaltyMarkPerceptor, perception)
+MAKE_OPTIONAL_MODULE(PenaltyMarkPerceptor, perception)
 
 PenaltyMarkPerceptor::PenaltyMarkPerceptor()
 {
@@ -142,6 +142,7 @@ void PenaltyMarkPerceptor::update(PenaltyMarkPercept& thePenaltyMarkPercept)
       for(const Vector3d& samplePoint : samplePoints)
       {
         detector.camera.camera2Image(object * samplePoint, x, y);
+        theECImage.prepare(static_cast<int>(y), static_cast<int>(y) + 1);
         if(theECImage.colored[static_cast<int>(y)][static_cast<int>(x)] != FieldColors::white
            && ++nonWhitePoints > maxNonWhiteRatio * samplePoints.size())
           goto nextObject;
@@ -220,6 +221,7 @@ int PenaltyMarkPerceptor::countGreenAtRadius(const Vector2i& center, float radiu
     return x >= 0 && x < theECImage.colored.width &&
            y >= 0 && y < theECImage.colored.height;
   };
+  theECImage.prepare(center.y() - static_cast<int>(radius * yRatio) - 1, center.y() + static_cast<int>(radius * yRatio) + 2);
   const float epsilon = pi2 / static_cast<float>(numberOfGreenChecks);
   float dx = -radius;
   float dy = 0.f;
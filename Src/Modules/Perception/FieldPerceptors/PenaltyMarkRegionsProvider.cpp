@@ -11,6 +11,7 @@
 
 #include "PenaltyMarkRegionsProvider.h"
 #include "Tools/ImageProcessing/InImageSizeCalculations.h"
+#include "Tools/Math/BHMath.h"
 
 MAKE_MODULE(PenaltyMarkRegionsProvider, perception)
 
@@ -22,9 +23,29 @@ void PenaltyMarkRegionsProvider::update(PenaltyMarkRegions& thePenaltyMarkRegion
   thePenaltyMarkRegions.regions.clear();
   cnsRegions.clear();
 
+  if(thePenaltyMarkPercept.wasSeen)
+  {
+    predictedPositionOnField = thePenaltyMarkPercept.positionOnField;
+    timeWhenLastSeen = theFrameInfo.time;
+  }
+  predictedPositionOnField = theOdometer.odometryOffset.inverse() * predictedPositionOnField;
+
+  // While a penalty mark is tracked, only candidates near its predicted position are searched.
+  // The whole image is only searched from time to time.
+  tracking = theFrameInfo.getTimeSince(timeWhenLastSeen) < trackingTimeout
+             && theFrameInfo.getTimeSince(timeOfLastFullSearch) < fullSearchInterval;
+  if(!tracking)
+    timeOfLastFullSearch = theFrameInfo.time;
+
   if(theScanGrid.y.empty())
     return;
 
+  if(tracking
+     && (!Transformation::robotToImage(predictedPositionOnField, theCameraMatrix, theCameraInfo, predictedPositionInImage)
+         || predictedPositionInImage.x() < 0 || predictedPositionInImage.x() >= theCameraInfo.width
+         || predictedPositionInImage.y() < 0 || predictedPositionInImage.y() >= theCameraInfo.height))
+    return;
+
   Vector2f pointInImage;
   if(Transformation::robotWithCameraRotationToImage(Vector2f(maxDistanceOnField, 0), theCameraMatrix, theCameraInfo, pointInImage)
      && theColorScanlineRegionsVerticalClipped.scanlines.size() > theColorScanlineRegionsVerticalClipped.lowResStart
@@ -162,7 +183,8 @@ void PenaltyMarkRegionsProvider::analyseRegions(unsigned short upperBound, int x
            && measuredHeight >= expectedHeight * (1.f - sizeToleranceRatio)
            && region->left > theScanGrid.lines[theScanGrid.lowResStart].x
            && region->right < theScanGrid.lines[theScanGrid.lines.size() - 1 - theScanGrid.lowResStart].x
-           && region->pixels * minWhiteRatio < region->whitePixels)
+           && region->pixels * minWhiteRatio < region->whitePixels
+           && (!tracking || (center - predictedPositionInImage).squaredNorm() <= sqr(expectedWidth * trackingRadiusRatio)))
         {
           candidate.center = center.cast<int>();
           candidate.region = Boundaryi(Rangei((candidate.center.x() - xStep + 1) / blockSizeX * blockSizeX,
@@ -13,6 +13,9 @@
 
 #include "Representations/Configuration/FieldDimensions.h"
 #include "Representations/Infrastructure/CameraInfo.h"
+#include "Representations/Infrastructure/FrameInfo.h"
+#include "Representations/Modeling/Odometer.h"
+#include "Representations/Perception/FieldPercepts/PenaltyMarkPercept.h"
 #include "Representations/Perception/ImagePreprocessing/ImageRegions.h"
 #include "Representations/Perception/ImagePreprocessing/CameraMatrix.h"
 #include "Representations/Perception/ImagePreprocessing/ColorScanlineRegions.h"
@@ -22,10 +25,13 @@
 
 MODULE(PenaltyMarkRegionsProvider,
 {,
+  USES(PenaltyMarkPercept),
   REQUIRES(CameraInfo),
   REQUIRES(CameraMatrix),
   REQUIRES(ColorScanlineRegionsVerticalClipped),
   REQUIRES(FieldDimensions),
+  REQUIRES(FrameInfo),
+  REQUIRES(Odometer),
   REQUIRES(ScanGrid),
   REQUIRES(PenaltyMarkRegions),
   PROVIDES(PenaltyMarkRegions),
@@ -39,6 +45,9 @@ MODULE(PenaltyMarkRegionsProvider,
     (int)(16) blockSizeX, /**< Must be the same value as in the CNSRegionProvider. */
     (int)(16) blockSizeY, /**< Must be the same value as in the CNSRegionProvider. */
     (unsigned)(3) maxNumberOfRegions, /**< The maximum number of regions created. */
+    (int)(2000) trackingTimeout, /**< How long after the last detection only the predicted position is searched (in ms). */
+    (int)(1000) fullSearchInterval, /**< The time after which a full search is done even while tracking (in ms). */
+    (float)(2.f) trackingRadiusRatio, /**< While tracking, candidates must be closer to the prediction than this ratio times the expected width. */
   }),
 });
 
@@ -90,6 +99,11 @@ class PenaltyMarkRegionsProvider : public PenaltyMarkRegionsProviderBase
   std::vector<Region> regions; /**< The regions of non-green pixels (left to right, bottom to bottom). */
   std::vector<unsigned short> extendedLower; /**< A table that maps y coordinates to y coordinates with region extension. */
   std::vector<Boundaryi> cnsRegions; /**< The CNS regions that will be provided. */
+  Vector2f predictedPositionOnField = Vector2f::Zero(); /**< The position of the last penalty mark seen, moved by odometry. */
+  Vector2f predictedPositionInImage = Vector2f::Zero(); /**< The predicted position projected into the current image. */
+  unsigned timeWhenLastSeen = 0; /**< The time when the penalty mark was seen the last time. */
+  unsigned timeOfLastFullSearch = 0; /**< The time when the whole image was searched the last time. */
+  bool tracking = false; /**< Are candidates only accepted near the predicted position? */
 
   void update(PenaltyMarkRegions& thePenaltyMarkRegions);
   void update(CNSPenaltyMarkRegions& theCNSPenaltyMarkRegions) {theCNSPenaltyMarkRegions.regions = cnsRegions;}
@@ -32,6 +32,7 @@ void BodyContourProvider::update(BodyContour& bodyContour)
   add(theRobotModel.limbs[Limbs::thighRight], upperLeg2, -1, bodyContour);
   add(theRobotModel.limbs[Limbs::footLeft], foot, 1, bodyContour);
   add(theRobotModel.limbs[Limbs::footRight], foot, -1, bodyContour);
+  bodyContour.updateLowerBounds();
 }
 
 void BodyContourProvider::add(const Pose3f& origin, const std::vector<Vector3f >& c, float sign,
@@ -312,12 +312,18 @@ void CNSImageProvider::update(CNSImage& cnsImage)
   cnsImage.setResolution(theECImage.grayscaled.width, theECImage.grayscaled.height);
 
   if(fullImage)
+  {
+    theECImage.prepareAll();
     cnsResponse(theECImage.grayscaled[0], theECImage.grayscaled.width,
                 theECImage.grayscaled.height, theECImage.grayscaled.width,
                 reinterpret_cast<short*>(cnsImage[0]), sqr(minContrast));
+  }
   else
     for(const Boundaryi& region : theCNSRegions.regions)
+    {
+      theECImage.prepare(region.y.min, region.y.max);
       cnsResponse(&theECImage.grayscaled[region.y.min][region.x.min], region.x.getSize(),
                   region.y.getSize(), theECImage.grayscaled.width,
                   reinterpret_cast<short*>(&cnsImage[region.y.min][region.x.min]), sqr(minContrast));
+    }
 }
@@ -49,7 +49,7 @@ class CNSRegionsProvider : public CNSRegionsProviderBase
    * There is a one block border around the actual image, i.e. the upper left corner is at (1, 1).
    */
   char searchGrid[32][42];
-  std::vector<Vector2i> stack; /**< The stack used by the flood fill algorithm to group blocks. */
+  std::vector<Vector2i> stack; /**< The stack used by the flood fill algorithm to group blocks. Never exceeds the number of blocks. */
 
   void update(BallRegions& ballRegions);
   void update(CNSRegions& cnsRegions);
@@ -59,6 +59,9 @@ class CNSRegionsProvider : public CNSRegionsProviderBase
 
   /**
    * Determines the size of connected region in the search grid.
+   * Every block is cleared when it is pushed, so it is visited at most once.
+   * Therefore, the runtime is linear in the number of blocks and the stack
+   * never grows beyond its initial reservation.
    * @param x The x coordinate of a point in the regions.
    * @param y The y coordinate of a point in the regions.
    * @param xRange The horizontal extent of the regions is reported here. The coordinates are
@@ -15,34 +15,81 @@ MAKE_MODULE(ECImageProvider, perception)
 
 void ECImageProvider::update(ECImage& ecImage)
 {
-  COMPLEX_IMAGE("HuedImage")
-    update<true>(ecImage);
-  else if(hueIsNeeded)
-    update<true>(ecImage);
-  else
-    update<false>(ecImage);
-}
+  saveHue = hueIsNeeded;
+  COMPLEX_IMAGE("HuedImage") saveHue = true;
+  saveSaturation = false;
+  COMPLEX_IMAGE("SaturatedImage") saveSaturation = true;
 
-template<bool saveHue>
-void ECImageProvider::update(ECImage& ecImage)
-{
+  ecImage.computeRows = nullptr;
   ecImage.grayscaled.setResolution(theCameraInfo.width, theCameraInfo.height);
   ecImage.colored.setResolution(theCameraInfo.width, theCameraInfo.height);
   if(theImage.timeStamp > 10 && theImage.width == theCameraInfo.width / 2)
   {
     ecImage.ued.setResolution(theCameraInfo.width / 2, theCameraInfo.height);
     ecImage.ved.setResolution(theCameraInfo.width / 2, theCameraInfo.height);
-    COMPLEX_IMAGE("SaturatedImage") ecImage.saturated.setResolution(theCameraInfo.width, theCameraInfo.height);
+    if(saveSaturation) ecImage.saturated.setResolution(theCameraInfo.width, theCameraInfo.height);
     if(saveHue) ecImage.hued.setResolution(theCameraInfo.width, theCameraInfo.height);
 
     ASSERT((theCameraInfo.width * theCameraInfo.height) % 32 == 0);
     ASSERT(theImage.width != theCameraInfo.width);
 
-    COMPLEX_IMAGE("SaturatedImage")
-      YHS2s::updateSSE<false /* calc all colors */, true /* save grayscaled */, true /* save colorchanneled */, true, saveHue>(reinterpret_cast<const PixelTypes::YUYVPixel* const>(theImage[0]), theImage.width, theImage.height * 2, theFieldColors, ecImage.grayscaled, ecImage.ued, ecImage.ved, ecImage.colored, ecImage.hued, ecImage.saturated);
+    // Debug images are sent completely, so they require all rows.
+    bool computeAll = !lazy;
+    COMPLEX_IMAGE("ColoredImage") computeAll = true;
+    COMPLEX_IMAGE("GrayscaledImage") computeAll = true;
+    COMPLEX_IMAGE("Ued") computeAll = true;
+    COMPLEX_IMAGE("Ved") computeAll = true;
+    COMPLEX_IMAGE("SaturatedImage") computeAll = true;
+    COMPLEX_IMAGE("HuedImage") computeAll = true;
+
+    computedBlocks.assign((theCameraInfo.height + rowsPerBlock - 1) / rowsPerBlock, false);
+    if(computeAll)
+      computeRows(ecImage, 0, theCameraInfo.height);
     else
-      YHS2s::updateSSE<false /* calc all colors */, true/* save grayscaled */, true /* save colorchanneled */, false, saveHue>(reinterpret_cast<const PixelTypes::YUYVPixel* const>(theImage[0]), theImage.width, theImage.height * 2, theFieldColors, ecImage.grayscaled, ecImage.ued, ecImage.ved, ecImage.colored, ecImage.hued, ecImage.saturated);
+      ecImage.computeRows = [this, &ecImage](int yFrom, int yTo) {computeRows(ecImage, yFrom, yTo);};
 
     ecImage.timeStamp = theImage.timeStamp;
   }
 }
+
+void ECImageProvider::computeRows(ECImage& ecImage, int yFrom, int yTo)
+{
+  const int height = ecImage.colored.height;
+  const size_t blockFrom = std::max(0, yFrom) / rowsPerBlock;
+  const size_t blockTo = (std::min(height, yTo) + rowsPerBlock - 1) / rowsPerBlock;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  for(size_t block = blockFrom; block < blockTo;)
+    if(computedBlocks[block])
+      ++block;
+    else
+    {
+      // Convert all consecutive blocks that are missing at once.
+      const size_t first = block;
+      while(block < blockTo && !computedBlocks[block])
+        computedBlocks[block++] = true;
+      const int firstRow = static_cast<int>(first) * rowsPerBlock;
+      const int numOfRows = std::min(height, static_cast<int>(block) * rowsPerBlock) - firstRow;
+      if(saveSaturation)
+      {
+        if(saveHue)
+          convert<true, true>(ecImage, firstRow, numOfRows);
+        else
+          convert<true, false>(ecImage, firstRow, numOfRows);
+      }
+      else if(saveHue)
+        convert<false, true>(ecImage, firstRow, numOfRows);
+      else
+        convert<false, false>(ecImage, firstRow, numOfRows);
+    }
+}
+
+template<bool saveSaturation, bool saveHue>
+void ECImageProvider::convert(ECImage& ecImage, int firstRow, int numOfRows)
+{
+  const PixelTypes::YUYVPixel* const src = reinterpret_cast<const PixelTypes::YUYVPixel*>(theImage[0]);
+  if(useScalarReference || !simdSupported())
+    YHS2s::updateScalar<false /* calc all colors */, true /* save grayscaled */, true /* save colorchanneled */, saveSaturation, saveHue>(src, theImage.width, numOfRows, theFieldColors, ecImage.grayscaled, ecImage.ued, ecImage.ved, ecImage.colored, ecImage.hued, ecImage.saturated, firstRow);
+  else
+    YHS2s::updateSSE<false /* calc all colors */, true /* save grayscaled */, true /* save colorchanneled */, saveSaturation, saveHue>(src, theImage.width, numOfRows, theFieldColors, ecImage.grayscaled, ecImage.ued, ecImage.ved, ecImage.colored, ecImage.hued, ecImage.saturated, firstRow);
+}
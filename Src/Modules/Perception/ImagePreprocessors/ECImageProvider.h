@@ -10,6 +10,8 @@
 #include "Representations/Infrastructure/Image.h"
 #include "Representations/Perception/ImagePreprocessing/ECImage.h"
 #include "Representations/Configuration/FieldColors.h"
+#include <mutex>
+#include <vector>
 
 MODULE(ECImageProvider,
 {,
@@ -20,6 +22,8 @@ MODULE(ECImageProvider,
   DEFINES_PARAMETERS(
   {,
     (bool)(true) hueIsNeeded,
+    (bool)(false) useScalarReference, /**< Use the scalar implementation even if the CPU supports the SIMD one. */
+    (bool)(false) lazy, /**< Only compute the rows that are prepared by the users of the ECImage. Logged ECImages will be incomplete. */
   }),
 });
 
@@ -29,6 +33,28 @@ MODULE(ECImageProvider,
 class ECImageProvider : public ECImageProviderBase
 {
 private:
+  static constexpr int rowsPerBlock = 16; /**< The number of rows that are computed together in lazy mode. */
+
+  std::vector<bool> computedBlocks; /**< Which blocks of rows are already computed in the current image? */
+  std::mutex mutex; /**< Protects the computation if users of the ECImage run in parallel. */
+  bool saveSaturation = false; /**< Is the saturated image computed in the current frame? */
+  bool saveHue = false; /**< Is the hued image computed in the current frame? */
+
   void update(ECImage& ecImage);
-  template<bool saveHue> void update(ECImage& ecImage);
+
+  /**
+   * Computes all rows in the given range that were not computed yet.
+   * @param ecImage The representation that is filled.
+   * @param yFrom The first row to compute.
+   * @param yTo The row after the last one to compute.
+   */
+  void computeRows(ECImage& ecImage, int yFrom, int yTo);
+
+  /**
+   * Converts rows of the current image using either the SIMD or the scalar implementation.
+   * @param ecImage The representation that is filled.
+   * @param firstRow The first row to convert.
+   * @param numOfRows The number of rows to convert.
+   */
+  template<bool saveSaturation, bool saveHue> void convert(ECImage& ecImage, int firstRow, int numOfRows);
 };
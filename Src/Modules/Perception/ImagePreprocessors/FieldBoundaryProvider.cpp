@@ -13,6 +13,11 @@ using std::vector;
 
 MAKE_MODULE(FieldBoundaryProvider, perception)
 
+FieldBoundaryProvider::FieldBoundaryProvider()
+{
+  trackedImages.fill(0);
+}
+
 void FieldBoundaryProvider::update(FieldBoundary& fieldBoundary)
 {
   DECLARE_DEBUG_DRAWING("module:FieldBoundaryProvider:lowerCamSpots", "drawingOnImage");
@@ -27,6 +32,11 @@ void FieldBoundaryProvider::update(FieldBoundary& fieldBoundary)
   lowerCamSpotsInImage.clear();
   lowerCamSpotsInterpol.clear();
 
+  // Keep the boundaries of both cameras relative to the current robot pose.
+  for(InField& boundary : trackedBoundaries)
+    for(Vector2f& point : boundary)
+      point = theOdometer.odometryOffset.inverse() * point;
+
   if(theCameraMatrix.isValid)
   {
     if(theCameraInfo.camera == CameraInfo::Camera::upper)
@@ -44,6 +54,7 @@ void FieldBoundaryProvider::update(FieldBoundary& fieldBoundary)
     findBoundarySpots(fieldBoundary);
     if(!cleanupBoundarySpots(fieldBoundary.boundarySpots))
     {
+      trackedBoundaries[theCameraInfo.camera].clear();
       if(theCameraInfo.camera == CameraInfo::Camera::lower)
         validLowerCamSpots = false;
       else
@@ -56,8 +67,15 @@ void FieldBoundaryProvider::update(FieldBoundary& fieldBoundary)
     }
     else
     {
-      calcBoundaryCandidates(fieldBoundary.boundarySpots);
-      findBestBoundary(convexBoundaryCandidates, fieldBoundary.boundarySpots, fieldBoundary.convexBoundary);
+      if(trackBoundary(fieldBoundary.boundarySpots, fieldBoundary.convexBoundary))
+        ++trackedImages[theCameraInfo.camera];
+      else
+      {
+        calcBoundaryCandidates(fieldBoundary.boundarySpots);
+        findBestBoundary(convexBoundaryCandidates, fieldBoundary.boundarySpots, fieldBoundary.convexBoundary);
+        trackedImages[theCameraInfo.camera] = 0;
+      }
+      rememberBoundary(fieldBoundary.convexBoundary);
     }
   }
   else
@@ -279,6 +297,7 @@ void FieldBoundaryProvider::findBoundarySpots(FieldBoundary& fieldBoundary)
     if(theCameraInfo.camera == CameraInfo::Camera::lower)
     {
       int yEnd = spot.yMax + static_cast<int>(minGreenCount * 1.5);
+      theECImage.prepare(spot.yMax, yEnd);
       const PixelTypes::ColoredPixel* pImg = &theECImage.colored[spot.yMax][scanline.x];
       if(*pImg == FieldColors::field)
       {
@@ -381,29 +400,12 @@ void FieldBoundaryProvider::calcBoundaryCandidates(InImage boundarySpots)
 void FieldBoundaryProvider::findBestBoundary(const vector<InImage>& boundaryCandidates,
     const InImage& boundarySpots, InImage& boundary) const
 {
-  int spotsOnLine;
-  int spotsNearLine;
-  int score;
-  int y;
   int maxScore = 0;
   const InImage* tmpBoundary = &boundaryCandidates.front();
 
   for(const InImage& boundarycandidate : boundaryCandidates)
   {
-    spotsOnLine = 0;
-    spotsNearLine = 0;
-    for(const Vector2i& point : boundarySpots)
-    {
-      y = clipToBoundary(boundarycandidate, point.x());
-      if(point.y() > y && point.y() - y < lowerBound)
-        ++spotsNearLine;
-      else if(point.y() < y && y - point.y() < upperBound)
-        ++spotsNearLine;
-
-      if(point.y() == y)
-        ++spotsOnLine;
-    }
-    score = spotsOnLine + spotsNearLine;
+    const int score = scoreBoundary(boundarycandidate, boundarySpots, upperBound, lowerBound);
     if(maxScore < score)
     {
       maxScore = score;
@@ -414,6 +416,77 @@ void FieldBoundaryProvider::findBestBoundary(const vector<InImage>& boundaryCand
   boundary = *tmpBoundary;
 }
 
+int FieldBoundaryProvider::scoreBoundary(const InImage& boundary, const InImage& boundarySpots, int maxAbove, int maxBelow) const
+{
+  int spotsOnLine = 0;
+  int spotsNearLine = 0;
+  for(const Vector2i& point : boundarySpots)
+  {
+    const int y = clipToBoundary(boundary, point.x());
+    if(point.y() > y && point.y() - y < maxBelow)
+      ++spotsNearLine;
+    else if(point.y() < y && y - point.y() < maxAbove)
+      ++spotsNearLine;
+
+    if(point.y() == y)
+      ++spotsOnLine;
+  }
+  return spotsOnLine + spotsNearLine;
+}
+
+bool FieldBoundaryProvider::trackBoundary(const InImage& boundarySpots, InImage& boundary) const
+{
+  const InField& tracked = trackedBoundaries[theCameraInfo.camera];
+  if(!useTracking || tracked.size() < 2 || trackedImages[theCameraInfo.camera] >= maxTrackedImages)
+    return false;
+
+  InImage projectedPoints;
+  projectedPoints.reserve(tracked.size());
+  for(const Vector2f& point : tracked)
+  {
+    Vector2f pImg;
+    if(!Transformation::robotToImage(point, theCameraMatrix, theCameraInfo, pImg))
+      return false;
+    projectedPoints.emplace_back(static_cast<int>(pImg.x() + 0.5f), static_cast<int>(pImg.y() + 0.5f));
+  }
+
+  std::sort(projectedPoints.begin(), projectedPoints.end(), [](const Vector2i& a, const Vector2i& b)
+  {
+    return a.x() < b.x() || (a.x() == b.x() && a.y() < b.y());
+  });
+  projectedPoints.erase(std::unique(projectedPoints.begin(), projectedPoints.end(), [](const Vector2i& a, const Vector2i& b)
+  {
+    return a.x() == b.x();
+  }), projectedPoints.end());
+  if(projectedPoints.size() < 2)
+    return false;
+
+  InImage predicted;
+  getUpperConvexHull(projectedPoints, predicted);
+  if(predicted.size() < 2
+     || scoreBoundary(predicted, boundarySpots, maxTrackingDeviation, maxTrackingDeviation) < minTrackingSupport * boundarySpots.size())
+    return false;
+
+  boundary = predicted;
+  return true;
+}
+
+void FieldBoundaryProvider::rememberBoundary(const InImage& boundary)
+{
+  InField& tracked = trackedBoundaries[theCameraInfo.camera];
+  tracked.clear();
+  for(const Vector2i& p : boundary)
+  {
+    Vector2f pField;
+    if(!Transformation::imageToRobot(p.x(), p.y(), theCameraMatrix, theCameraInfo, pField))
+    {
+      tracked.clear();
+      return;
+    }
+    tracked.push_back(pField);
+  }
+}
+
 inline bool FieldBoundaryProvider::isLeftOf(const Vector2i& a, const Vector2i& b, const Vector2i& c) const
 {
   return ((b.x() - a.x()) * (-c.y() + a.y()) - (c.x() - a.x()) * (-b.y() + a.y()) > 0);
@@ -14,6 +14,7 @@
 #include "Representations/Perception/ImagePreprocessing/FieldBoundary.h"
 #include "Representations/Perception/ImagePreprocessing/ImageCoordinateSystem.h"
 #include "Representations/Perception/ImagePreprocessing/ColorScanlineRegions.h"
+#include <array>
 
 MODULE(FieldBoundaryProvider,
 {,
@@ -33,6 +34,10 @@ MODULE(FieldBoundaryProvider,
     (int)(2) nonGreenPenaltyGreater,
     (int)(3500) nonGreenPenaltyDistance,
     (int)(5) minGreenCount,
+    (bool)(true) useTracking, ///< Reuse the boundary of the previous image of the same camera if it still fits the spots.
+    (int)(6) maxTrackingDeviation, ///< Maximum vertical distance in pixels of a spot to the predicted boundary to support it.
+    (float)(0.8f) minTrackingSupport, ///< Ratio of boundary spots that must support the predicted boundary.
+    (unsigned)(10) maxTrackedImages, ///< Number of images of the same camera after which a full search is enforced.
   }),
 });
 
@@ -56,7 +61,13 @@ private:
   InImage lowerCamSpotsInterpol;
   std::vector<InImage> convexBoundaryCandidates; ///< Possible boundary candidates.
   CameraInfo::Camera lastCamera = CameraInfo::Camera::numOfCameras;
+  std::array<InField, CameraInfo::numOfCameras> trackedBoundaries; ///< The last boundary of each camera relative to the current robot pose.
+  std::array<unsigned, CameraInfo::numOfCameras> trackedImages; ///< For how many images was the boundary of each camera tracked without a full search?
 
+public:
+  FieldBoundaryProvider();
+
+private:
   void update(FieldBoundary& fieldBoundary);
 
   void handleLowerCamSpots();
@@ -67,6 +78,32 @@ private:
   void findBestBoundary(const std::vector<InImage>& boundaryCandidates,
                         const InImage& boundarySpots, InImage& boundary) const;
 
+  /**
+   * Counts the spots that are on or near a boundary.
+   * @param boundary The boundary.
+   * @param boundarySpots The spots.
+   * @param maxAbove The spots must be less than this number of pixels above the boundary.
+   * @param maxBelow The spots must be less than this number of pixels below the boundary.
+   * @return The number of spots near the boundary plus the number of spots exactly on it.
+   */
+  int scoreBoundary(const InImage& boundary, const InImage& boundarySpots, int maxAbove, int maxBelow) const;
+
+  /**
+   * Projects the boundary found in the previous image of the current camera
+   * into the current image and checks whether the boundary spots support it.
+   * @param boundarySpots The spots found in the current image.
+   * @param boundary The predicted boundary is returned here if it is supported.
+   * @return Was the prediction supported by the spots?
+   */
+  bool trackBoundary(const InImage& boundarySpots, InImage& boundary) const;
+
+  /**
+   * Stores the boundary of the current image on the field to predict it
+   * in the next image of the same camera.
+   * @param boundary The boundary in the current image.
+   */
+  void rememberBoundary(const InImage& boundary);
+
   bool isLeftOf(const Vector2i& a, const Vector2i& b, const Vector2i& c) const;
   void getUpperConvexHull(const InImage& boundary, InImage& hull) const;
 
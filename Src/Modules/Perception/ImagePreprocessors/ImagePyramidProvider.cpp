@@ -0,0 +1,31 @@
+/**
+ * @file ImagePyramidProvider.cpp
+ * This file implements a module that computes downscaled versions of the
+ * ECImage once per frame.
+ */
+
+#include "ImagePyramidProvider.h"
+#include "Tools/ImageProcessing/Resize.h"
+
+MAKE_MODULE(ImagePyramidProvider, perception)
+
+void ImagePyramidProvider::update(ImagePyramid& imagePyramid)
+{
+  theECImage.prepareAll();
+  imagePyramid.timeStamp = theECImage.timeStamp;
+
+  // Every level is shrunk from the full image, so the results are the same as
+  // when a module shrinks the image itself.
+  imagePyramid.grayscaled.resize(numOfLevels);
+  imagePyramid.ued.resize(colorChannels ? numOfLevels : 0);
+  imagePyramid.ved.resize(colorChannels ? numOfLevels : 0);
+  for(unsigned level = 1; level <= numOfLevels; ++level)
+  {
+    Resize::shrinkGrayscaleNxN(theECImage.grayscaled, imagePyramid.grayscaled[level - 1], level);
+    if(colorChannels)
+    {
+      Resize::shrinkColorChannelNxN(theECImage.ued, imagePyramid.ued[level - 1], level);
+      Resize::shrinkColorChannelNxN(theECImage.ved, imagePyramid.ved[level - 1], level);
+    }
+  }
+}
@@ -0,0 +1,27 @@
+/**
+ * @file ImagePyramidProvider.h
+ * This file declares a module that computes downscaled versions of the
+ * ECImage once per frame.
+ */
+
+#pragma once
+
+#include "Tools/Module/Module.h"
+#include "Representations/Perception/ImagePreprocessing/ECImage.h"
+#include "Representations/Perception/ImagePreprocessing/ImagePyramid.h"
+
+MODULE(ImagePyramidProvider,
+{,
+  REQUIRES(ECImage),
+  PROVIDES_WITHOUT_MODIFY(ImagePyramid),
+  DEFINES_PARAMETERS(
+  {,
+    (unsigned)(3) numOfLevels, /**< The number of downscaled levels, i.e. down to 1/2^numOfLevels. */
+    (bool)(true) colorChannels, /**< Also downscale the U and V channels? */
+  }),
+});
+
+class ImagePyramidProvider : public ImagePyramidProviderBase
+{
+  void update(ImagePyramid& imagePyramid);
+};
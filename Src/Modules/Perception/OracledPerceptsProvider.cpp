@@ -758,33 +758,42 @@ void OracledPerceptsProvider::applyNoise(float standardDeviation, float& angle)
   angle += error;
 }
 
-bool OracledPerceptsProvider::isPointBehindObstacle(const Vector2f& pointGlo) const
+void OracledPerceptsProvider::updateOccluders()
 {
-  const Pose2f robotPoseInv = theGroundTruthWorldState.ownPose.inverse();
-  const float sqrDistTopoint = (pointGlo - theGroundTruthWorldState.ownPose.translation).squaredNorm();
-  const Angle pointAngle = (robotPoseInv * pointGlo).angle();
+  if(timeOfOccluders == theFrameInfo.time && timeOfOccluders != 0)
+    return;
+  timeOfOccluders = theFrameInfo.time;
+  inverseOwnPose = theGroundTruthWorldState.ownPose.inverse();
+  occluders.clear();
 
-  auto isBehind = [&](const Vector2f& obstacle)
+  auto addOccluder = [&](const Vector2f& obstacle)
   {
     const float sqrDistToObstacle = (obstacle - theGroundTruthWorldState.ownPose.translation).squaredNorm();
-    if(sqrDistToObstacle < 10 || sqrDistTopoint <= sqrDistToObstacle)
-      return false;
+    if(sqrDistToObstacle < 10)
+      return;
 
-    const Vector2f obstacleRel = robotPoseInv * obstacle;
+    const Vector2f obstacleRel = inverseOwnPose * obstacle;
     const Vector2f obstacleThickness = obstacleRel.normalized(obstacleCoverageThickness).rotate(pi_2);
-
-    const Angle leftPointAngle = (obstacleRel + obstacleThickness).angle();
-    const Angle rightPointAngle = (obstacleRel - obstacleThickness).angle();
-
-    return pointAngle < leftPointAngle && pointAngle > rightPointAngle; //would not work on behind the robot, but we can not see anything there too
+    occluders.push_back({sqrDistToObstacle, (obstacleRel + obstacleThickness).angle(), (obstacleRel - obstacleThickness).angle()});
   };
 
   for(const GroundTruthWorldState::GroundTruthPlayer& player : theGroundTruthWorldState.secondTeamPlayers)
-    if(player.upright && isBehind(player.pose.translation))
-      return true;
-
+    if(player.upright)
+      addOccluder(player.pose.translation);
   for(const GroundTruthWorldState::GroundTruthPlayer& player : theGroundTruthWorldState.firstTeamPlayers)
-    if(player.upright && isBehind(player.pose.translation))
+    if(player.upright)
+      addOccluder(player.pose.translation);
+}
+
+bool OracledPerceptsProvider::isPointBehindObstacle(const Vector2f& pointGlo)
+{
+  updateOccluders();
+  const float sqrDistTopoint = (pointGlo - theGroundTruthWorldState.ownPose.translation).squaredNorm();
+  const Angle pointAngle = (inverseOwnPose * pointGlo).angle();
+
+  for(const Occluder& occluder : occluders)
+    if(sqrDistTopoint > occluder.sqrDistance &&
+       pointAngle < occluder.leftAngle && pointAngle > occluder.rightAngle) //would not work on behind the robot, but we can not see anything there too
       return true;
 
   return false;
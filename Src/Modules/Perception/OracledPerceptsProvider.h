@@ -98,6 +98,18 @@ private:
   std::vector<std::pair<Vector2f, Vector2f>> fieldBoundaryLines; /*< The boundary of the field */
   Vector2f viewPolygon[4];                                       /*< A polygon that describes the currently visible area */
 
+  /** The sector of the view that is covered by an upright player, relative to the robot */
+  struct Occluder
+  {
+    float sqrDistance; /*< The squared distance to the player */
+    Angle leftAngle;   /*< The angle of the left edge of the covered sector */
+    Angle rightAngle;  /*< The angle of the right edge of the covered sector */
+  };
+
+  std::vector<Occluder> occluders;                               /*< All players that might hide other objects in the current frame */
+  Pose2f inverseOwnPose;                                         /*< The inverse of the ground truth pose of the robot in the current frame */
+  unsigned timeOfOccluders = 0;                                  /*< The frame time for which occluders and inverseOwnPose were computed */
+
   /** One main function, might be called every cycle
    * @param ballPercept The data struct to be filled
    */
@@ -190,5 +202,12 @@ private:
    */
   bool partOfLineIsVisible(const std::pair<Vector2f, Vector2f>& line, Vector2f& start, Vector2f& end) const;
 
-  bool isPointBehindObstacle(const Vector2f& point) const;
+  /** Computes the occluders and the inverse robot pose once per frame, as they are shared by all percepts */
+  void updateOccluders();
+
+  /** Checks whether a point on the field is hidden behind another player
+   * @param point The point in global field coordinates
+   * @return true, if an upright player is between the robot and the point
+   */
+  bool isPointBehindObstacle(const Vector2f& point);
 };
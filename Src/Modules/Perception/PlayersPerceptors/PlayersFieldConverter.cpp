@@ -88,6 +88,8 @@ void PlayersFieldConverter::detectJersey(const PlayersImagePercept::PlayerInImag
     if(boxX1 == boxX2 || boxY1 == boxY2)
       return;
 
+    theECImage.prepare(boxY1, boxY2 + 1);
+
     int ownPixels = 0;
     int opponentPixels = 0;
     int totalPixels = 0;
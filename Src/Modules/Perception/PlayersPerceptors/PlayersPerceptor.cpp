@@ -24,6 +24,19 @@ void PlayersPerceptor::update(PlayersImagePercept& playersPercept)
     return;
 
   ASSERT(theCameraInfo.width == theECImage.grayscaled.width);
+
+  // Convert the rows covered by all scan lines at once instead of one scan line at a time
+  int yFrom = theCameraInfo.height;
+  int yTo = 0;
+  for(int x = 0, xEnd = theCameraInfo.width - xStep; x < xEnd; x += xStep)
+  {
+    int yEnd = theCameraInfo.height - 1;
+    theBodyContour.clipBottom(x, yEnd, yEnd);
+    yFrom = std::min(yFrom, theFieldBoundary.getBoundaryY(x) + yOffset);
+    yTo = std::max(yTo, yEnd + 1);
+  }
+  theECImage.prepare(std::max(yFrom, 0), yTo);
+
   for(int i = 0, x = 0, xEnd = theCameraInfo.width - xStep; x < xEnd; i++, x += xStep)
   {
     scanVerticalLine(i, x);
@@ -300,6 +313,7 @@ bool PlayersPerceptor::combineVerticalLines(PlayersImagePercept& playersPercept)
   gap = 0;
   int yEnd = theCameraInfo.height;
   theBodyContour.clipBottom(maxYIndex * xStep, yEnd, yEnd);
+  theECImage.prepare(y, yEnd);
   for(int x = maxYIndex * xStep; y < yEnd; y++)
   {
     //RECTANGLE("module:PlayersPerceptor", x, y, x, y, 0, Drawings::solidPen, ColorRGBA::yellow);
@@ -505,4 +519,4 @@ Vector2f PlayersPerceptor::computeVanishingPointZ() const
   return vanishingPoint;
 }
 
-MAKE_MODULE(PlayersPerceptor, perception)
+MAKE_OPTIONAL_MODULE(PlayersPerceptor, perception)
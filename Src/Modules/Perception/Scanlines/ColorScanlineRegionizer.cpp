@@ -3,9 +3,32 @@
  */
 
 #include "ColorScanlineRegionizer.h"
+#include "Tools/ImageProcessing/SIMD.h"
 
 MAKE_MODULE(ColorScanlineRegionizer, perception)
 
+int ColorScanlineRegionizer::findOtherColor(const FieldColors::Color* row, int from, int to, FieldColors::Color color)
+{
+  const __m128i reference = _mm_set1_epi8(static_cast<char>(color));
+  for(; from + 16 <= to; from += 16)
+  {
+    const int equal = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(row + from)), reference));
+    if(equal != 0xffff)
+    {
+#ifdef _MSC_VER
+      unsigned long index;
+      _BitScanForward(&index, ~equal);
+      return from + static_cast<int>(index);
+#else
+      return from + __builtin_ctz(~equal);
+#endif
+    }
+  }
+  while(from < to && row[from] == color)
+    ++from;
+  return from;
+}
+
 void ColorScanlineRegionizer::update(ColorScanlineRegionsVertical& colorScanlineRegionsVertical)
 {
   colorScanlineRegionsVertical.scanlines.clear();
@@ -16,6 +39,7 @@ void ColorScanlineRegionizer::update(ColorScanlineRegionsVertical& colorScanline
   if(theScanGrid.lines.empty())
     return;
 
+  theECImage.prepare(theScanGrid.fieldLimit, theECImage.colored.height);
   for(size_t i = theScanGrid.lowResStart; i < theScanGrid.lines.size(); i += theScanGrid.lowResStep)
   {
     colorScanlineRegionsVertical.scanlines.emplace_back(static_cast<unsigned short>(theScanGrid.lines[i].x));
@@ -30,6 +54,7 @@ void ColorScanlineRegionizer::update(ColorScanlineRegionsHorizontal& colorScanli
   if(theScanGrid.lines.empty())
     return;
 
+  theECImage.prepare(theScanGrid.fieldLimit, theECImage.colored.height);
   int prevY = theECImage.colored.height + minHorizontalScanlineDistance * theECImage.colored.height / 320;
   for(const int y : theScanGrid.y)
   {
@@ -59,28 +84,29 @@ void ColorScanlineRegionizer::update(ColorScanlineRegionsHorizontal& colorScanli
         }
         else
         {
+          const FieldColors::Color* row = theECImage.colored[y];
           while(x < line.x)
           {
-            x++;
-            const FieldColors::Color color = theECImage.colored[y][x];
-            if(color != curColor)
+            // Skip the pixels of the current color in blocks of 16
+            const int next = findOtherColor(row, x + 1, line.x + 1, curColor);
+            count += static_cast<unsigned short>(next - x - 1);
+            if(next > line.x)
+            {
+              x = line.x;
+              break;
+            }
+            x = next;
+            if(count >= minHorizontalRegionSize)
             {
-              if(count >= minHorizontalRegionSize)
-              {
-                scanline.regions.emplace_back(x - count, x, curColor);
-                count = 1;
-              }
-              else if(!scanline.regions.empty())
-              {
-                count /= 2;
-                scanline.regions.back().range.right += count;
-              }
-              curColor = color;
+              scanline.regions.emplace_back(x - count, x, curColor);
+              count = 1;
             }
-            else
+            else if(!scanline.regions.empty())
             {
-              count++;
+              count /= 2;
+              scanline.regions.back().range.right += count;
             }
+            curColor = row[x];
           }
         }
       }
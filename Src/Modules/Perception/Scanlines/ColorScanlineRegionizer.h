@@ -33,4 +33,15 @@ private:
   void update(ColorScanlineRegionsHorizontal& rolorScanlineRegionsHorizontal);
 
   void scanVertical(const ScanGrid::Line& line, const int top, std::vector<ScanlineRegion>& regions) const;
+
+  /**
+   * Finds the first pixel in a row that does not have a certain color.
+   * 16 pixels are compared at once.
+   * @param row The row of the color classified image.
+   * @param from The first x coordinate checked.
+   * @param to The x coordinate after the last one checked.
+   * @param color The color that is skipped.
+   * @return The x coordinate of the first pixel of another color or \c to if there is none.
+   */
+  static int findOtherColor(const FieldColors::Color* row, int from, int to, FieldColors::Color color);
 };
@@ -16,6 +16,8 @@ void HiResColorScanlineRegionizer::update(ColorScanlineRegionsVerticalClipped& r
   if(theScanGrid.lines.empty() || !theFieldBoundary.isValid)
     return;
 
+  theECImage.prepare(theScanGrid.fieldLimit, theECImage.colored.height);
+
   auto loRes = theColorScanlineRegionsVertical.scanlines.cbegin();
   for(const ScanGrid::Line& line : theScanGrid.lines)
   {
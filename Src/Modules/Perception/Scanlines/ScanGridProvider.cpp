@@ -5,6 +5,7 @@
  */
 
 #include "ScanGridProvider.h"
+#include "Tools/Math/BHMath.h"
 #include "Tools/Math/Transformation.h"
 #include <algorithm>
 
@@ -20,9 +21,20 @@ void ScanGridProvider::update(ScanGrid& scanGrid)
     return; // Cannot compute grid without camera matrix
 
   // Compute the furthest point away that could be part of the field given an unknown own position.
+  // If the own position is known well enough, the farthest field corner is the limit.
+  // The scanlines are densest near that limit.
   Vector2f pointInImage;
-  const float fieldDiagional = Vector2f(theFieldDimensions.boundary.x.getSize(), theFieldDimensions.boundary.y.getSize()).norm();
-  if(!Transformation::robotWithCameraRotationToImage(Vector2f(fieldDiagional, 0), theCameraMatrix, theCameraInfo, pointInImage))
+  float maxDistance = Vector2f(theFieldDimensions.boundary.x.getSize(), theFieldDimensions.boundary.y.getSize()).norm();
+  if(theRobotPose.validity >= minPoseValidity)
+  {
+    const Rangef& x = theFieldDimensions.boundary.x;
+    const Rangef& y = theFieldDimensions.boundary.y;
+    const Vector2f& position = theRobotPose.translation;
+    const float farthestCorner = std::sqrt(std::max(sqr(position.x() - x.min), sqr(position.x() - x.max))
+                                           + std::max(sqr(position.y() - y.min), sqr(position.y() - y.max)));
+    maxDistance = std::min(maxDistance, farthestCorner + poseDistanceMargin);
+  }
+  if(!Transformation::robotWithCameraRotationToImage(Vector2f(maxDistance, 0), theCameraMatrix, theCameraInfo, pointInImage))
     return; // Cannot project furthest possible point to image -> no grid in image
 
   scanGrid.fieldLimit = std::max(static_cast<int>(pointInImage.y()), -1);
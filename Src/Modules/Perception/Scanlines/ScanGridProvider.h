@@ -10,12 +10,14 @@
 #include "Representations/Configuration/BallSpecification.h"
 #include "Representations/Configuration/FieldDimensions.h"
 #include "Representations/Infrastructure/CameraInfo.h"
+#include "Representations/Modeling/RobotPose.h"
 #include "Representations/Perception/ImagePreprocessing/BodyContour.h"
 #include "Representations/Perception/ImagePreprocessing/CameraMatrix.h"
 #include "Representations/Perception/ImagePreprocessing/ScanGrid.h"
 
 MODULE(ScanGridProvider,
 {,
+  USES(RobotPose),
   REQUIRES(BallSpecification),
   REQUIRES(BodyContour),
   REQUIRES(CameraInfo),
@@ -28,6 +30,8 @@ MODULE(ScanGridProvider,
     (int)(25) minNumOfLowResScanlines, /**< The minimum number of scanlines for low resolution. */
     (float)(0.9f) lineWidthRatio, /**< The ratio of field line width that is sampled when scanning the image. */
     (float)(0.8f) ballWidthRatio, /**< The ratio of ball width that is sampled when scanning the image. */
+    (float)(0.5f) minPoseValidity, /**< The validity of the robot pose required to limit the grid to the farthest field corner. */
+    (float)(1000.f) poseDistanceMargin, /**< Distance added to the farthest field corner to account for localization errors. */
   }),
 });
 
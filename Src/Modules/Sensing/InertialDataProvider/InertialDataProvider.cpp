@@ -39,10 +39,16 @@ void InertialDataProvider::update(InertialData& inertialData)
   }
 
   const Quaternionf rotation(theIMUCalibration.rotation);
+  const Vector3f& chosenAccDeviation = theMotionInfo.motion == MotionRequest::Motion::walk ? accDeviationWhileWalking : accDeviation;
+
+  // Integrate the samples of the DCM cycles in which Motion did not run, so no rotation is lost.
+  for(unsigned i = 0; i < theInertialSensorData.numOfPreviousSamples; ++i)
+    estimate((rotation * theInertialSensorData.previousGyros[i].cast<float>()).cast<Angle>(),
+             rotation * theInertialSensorData.previousAccs[i], Constants::motionCycleTime, gyroDeviation, chosenAccDeviation);
+
   inertialData.acc = rotation * theInertialSensorData.acc;
   inertialData.gyro = (rotation * theInertialSensorData.gyro.cast<float>()).cast<Angle>();
 
-  const Vector3f& chosenAccDeviation = theMotionInfo.motion == MotionRequest::Motion::walk ? accDeviationWhileWalking : accDeviation;
   estimate(inertialData.gyro, inertialData.acc, Constants::motionCycleTime, gyroDeviation, chosenAccDeviation);
 
   inertialData.orientation2D = Rotation::removeZRotation(ukf.mean.orientation);
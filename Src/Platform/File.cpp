@@ -11,6 +11,24 @@
 #endif
 
 #include <cstdarg>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+
+/**
+ * Remember where files were found on the robot, because probing all configuration
+ * directories is slow on its flash memory. On the PC, new files may be added while
+ * the software is running, so they are always searched.
+ */
+#ifdef TARGET_ROBOT
+static const bool cacheResolvedNames = true;
+#else
+static const bool cacheResolvedNames = false;
+#endif
+
+/** The paths under which files opened for reading were found, indexed by all their alternatives. */
+static std::unordered_map<std::string, std::string> resolvedNames;
+static std::mutex resolvedNamesMutex; /**< Protects resolvedNames, because all threads open files. */
 
 File::File(const std::string& name, const char* mode, bool tryAlternatives)
 {
@@ -18,12 +36,47 @@ File::File(const std::string& name, const char* mode, bool tryAlternatives)
   std::list<std::string> names = getFullNames(name);
   if(tryAlternatives)
   {
+    // Files are only looked up in the cache if they are read. Writing might create a file
+    // that hides another one in a directory searched later, so the cache is cleared then.
+    std::string key;
+    if(strpbrk(mode, "wa+"))
+    {
+      std::lock_guard<std::mutex> lock(resolvedNamesMutex);
+      resolvedNames.clear();
+    }
+    else if(cacheResolvedNames && names.size() > 1)
+    {
+      for(const std::string& path : names)
+        key += path + '\n';
+      std::string path;
+      {
+        std::lock_guard<std::mutex> lock(resolvedNamesMutex);
+        auto i = resolvedNames.find(key);
+        if(i != resolvedNames.end())
+          path = i->second;
+      }
+      if(!path.empty())
+      {
+        stream = fopen(path.c_str(), mode);
+        if(stream)
+        {
+          fullName = path;
+          return;
+        }
+      }
+    }
+
     for(auto& path : names)
     {
       stream = fopen(path.c_str(), mode);
       if(stream)
       {
         fullName = path;
+        if(!key.empty())
+        {
+          std::lock_guard<std::mutex> lock(resolvedNamesMutex);
+          resolvedNames[key] = path;
+        }
         break;
       }
     }
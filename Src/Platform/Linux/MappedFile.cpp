@@ -0,0 +1,40 @@
+/**
+ * @file Platform/Linux/MappedFile.cpp
+ */
+
+#include "Platform/MappedFile.h"
+#include "Platform/File.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+MappedFile::MappedFile(const std::string& name)
+{
+  for(const std::string& fullName : File::getFullNames(name))
+  {
+    const int fd = open(fullName.c_str(), O_RDONLY);
+    if(fd == -1)
+      continue;
+
+    struct stat fileStatus;
+    if(fstat(fd, &fileStatus) == 0 && fileStatus.st_size > 0)
+    {
+      void* mapping = mmap(nullptr, static_cast<size_t>(fileStatus.st_size), PROT_READ, MAP_SHARED, fd, 0);
+      if(mapping != MAP_FAILED)
+      {
+        data = mapping;
+        size = static_cast<size_t>(fileStatus.st_size);
+      }
+    }
+    close(fd); // The mapping stays valid.
+    break;
+  }
+}
+
+MappedFile::~MappedFile()
+{
+  if(data)
+    munmap(const_cast<void*>(data), size);
+}
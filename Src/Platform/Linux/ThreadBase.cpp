@@ -2,6 +2,10 @@
 #include "Platform/BHAssert.h"
 
 #include <pthread.h>
+#ifdef TARGET_ROBOT
+#include <sched.h>
+#include <unistd.h>
+#endif
 
 static DECLARE_SYNC;
 
@@ -58,3 +62,21 @@ void Thread::changePriority()
     }
   }
 }
+
+void Thread::changeCPU()
+{
+#ifdef TARGET_ROBOT
+  SYNC;
+  if(thread && running)
+  {
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    if(cpu < 0)
+      for(int i = 0, numOfCPUs = static_cast<int>(sysconf(_SC_NPROCESSORS_ONLN)); i < numOfCPUs; ++i)
+        CPU_SET(i, &cpuSet);
+    else
+      CPU_SET(cpu, &cpuSet);
+    VERIFY(!pthread_setaffinity_np(thread->native_handle(), sizeof(cpuSet), &cpuSet));
+  }
+#endif
+}
@@ -0,0 +1,53 @@
+/**
+ * @file Platform/MappedFile.h
+ * Declaration of a class that maps a file read-only into memory.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+/**
+ * The class maps a whole file read-only into the address space of the
+ * process. The pages are shared with the page cache, i.e. all processes
+ * mapping the same file share the same physical memory.
+ */
+class MappedFile
+{
+private:
+  const void* data = nullptr; /**< The start of the mapping or nullptr if the file could not be mapped. */
+  size_t size = 0; /**< The size of the mapping in bytes. */
+
+public:
+  /**
+   * Maps a file. Like with the class File, relative paths are searched in
+   * the configuration directories.
+   * @param name File name or path.
+   */
+  MappedFile(const std::string& name);
+
+  /** Unmaps the file. */
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  /**
+   * Was the file found and mapped?
+   * @return Is the mapping valid?
+   */
+  bool exists() const {return data != nullptr;}
+
+  /**
+   * The start of the file's contents.
+   * @return The address the file is mapped to.
+   */
+  const char* getData() const {return static_cast<const char*>(data);}
+
+  /**
+   * The size of the file.
+   * @return The size of the mapping in bytes.
+   */
+  size_t getSize() const {return size;}
+};
@@ -8,8 +8,10 @@
 
 #include "DebugHandler.h"
 #include "Platform/BHAssert.h"
+#include "Platform/Time.h"
 #include "Tools/Streams/OutStreams.h"
 #include "Tools/Streams/InStreams.h"
+#include <algorithm>
 
 DebugHandler::DebugHandler(MessageQueue& in, MessageQueue& out, int maxPackageSendSize, int maxPackageReceiveSize) :
   TcpConnection(0, 0xA1BD, TcpConnection::receiver, maxPackageSendSize, maxPackageReceiveSize),
@@ -17,10 +19,41 @@ DebugHandler::DebugHandler(MessageQueue& in, MessageQueue& out, int maxPackageSe
   out(out)
 {}
 
-void DebugHandler::communicate(bool send)
+/** The time in ms a package should need at most to be transmitted. */
+static const int maxTransferTime = 500;
+
+/** The size of the packages that are always allowed, independent of the bandwidth estimated. */
+static const unsigned minBudget = 100000;
+
+void DebugHandler::reduceToBandwidth()
 {
-  if(send && !sendData && !out.isEmpty())
+  if(bandwidth == 0.f)
+    return;
+
+  const unsigned budget = std::max(minBudget, static_cast<unsigned>(bandwidth * maxTransferTime / 1000.f));
+  if(out.getStreamedSize() > budget)
+    out.removeRepetitions();
+  if(out.getStreamedSize() > budget)
+    out.removeMessages({idImage, idJPEGImage, idLowFrameRateImage, idThumbnail, idDebugImage, idDebugJPEGImage});
+  if(out.getStreamedSize() > budget)
+    out.removeMessages({idDebugDrawing, idDebugDrawing3D});
+}
+
+void DebugHandler::communicate(bool send, bool reduce)
+{
+  // When the previous package was acknowledged, its transfer time is known.
+  if(packageStart && !sendData && canSend())
+  {
+    const float sample = static_cast<float>(packageSize) * 1000.f / static_cast<float>(std::max(1, Time::getRealTimeSince(packageStart)));
+    bandwidth = bandwidth == 0.f ? sample : 0.8f * bandwidth + 0.2f * sample;
+    packageStart = 0;
+  }
+
+  // The package is only created when it can be sent, so it contains the newest data.
+  if(send && !sendData && !out.isEmpty() && canSend())
   {
+    if(reduce)
+      reduceToBandwidth();
     OutBinarySize size;
     size << out;
     sendSize = (int) size.getSize();
@@ -29,12 +62,14 @@ void DebugHandler::communicate(bool send)
     OutBinaryMemory memory(sendData);
     memory << out;
     out.clear();
+    packageStart = Time::getRealSystemTime();
+    packageSize = sendSize;
   }
 
   unsigned char* receivedData;
   int receivedSize = 0;
 
-  if(sendAndReceive(sendData, sendSize, receivedData, receivedSize) && sendSize)
+  if(sendAndReceiveNonBlocking(sendData, sendSize, receivedData, receivedSize) && sendSize)
   {
     delete [] sendData;
     sendData = nullptr;
@@ -19,6 +19,16 @@ private:
 
   unsigned char* sendData = nullptr; /**< The data to send next. */
   int sendSize = 0; /**< The size of the data to send next. */
+  unsigned packageStart = 0; /**< When the transfer of the current package started. 0 if no package is on the way. */
+  int packageSize = 0; /**< The size of the package that is on the way. */
+  float bandwidth = 0.f; /**< The estimated bandwidth of the connection in bytes per second. 0 if unknown. */
+
+  /**
+   * Removes the messages with the lowest priority from the outgoing queue
+   * until it can be transmitted in time with the estimated bandwidth.
+   * Older frames are removed first, then images, and then drawings.
+   */
+  void reduceToBandwidth();
 
 public:
   /**
@@ -37,9 +47,11 @@ public:
   ~DebugHandler() {if(sendData) delete [] sendData;}
 
   /**
-   * The method performs the communication.
+   * The method performs the communication. It never waits for the network.
+   * Instead, it continues transmitting a package in the next call.
    * It has to be called at the end of each frame.
    * @param send Send outgoing queue?
+   * @param reduce Is it allowed to drop messages if the bandwidth is too low?
    */
-  void communicate(bool send);
+  void communicate(bool send, bool reduce = false);
 };
@@ -4,10 +4,12 @@
  * @author Colin Graf
  */
 
+#include <cerrno>
 #include <csignal>
 #include <cstdio>
 #include <cstring>
 #include <sys/file.h> // flock
+#include <sys/mman.h> // mlockall
 #include <fcntl.h>
 #include <sys/wait.h>
 #include <unistd.h>
@@ -216,6 +218,10 @@ int main(int argc, char* argv[])
     signal(SIGTERM, sighandlerShutdown);
     signal(SIGINT, sighandlerShutdown);
 
+    // avoid page faults in the real-time threads, e.g. Motion
+    if(mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+      fprintf(stderr, "B-Human: Locking memory failed: %s\n", strerror(errno));
+
     //
     bhumanStart();
   }
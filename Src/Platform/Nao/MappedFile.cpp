@@ -0,0 +1,2 @@
+// Same functionality as on Linux, hence the include
+#include "Platform/Linux/MappedFile.cpp"
\ No newline at end of file
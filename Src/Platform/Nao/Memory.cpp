@@ -1,2 +1,73 @@
-// Same functionality as on Linux, hence the include
-#include "Platform/Linux/Memory.cpp"
\ No newline at end of file
+/**
+ * @file Platform/Nao/Memory.cpp
+ * On the robot, all heap allocations of the C++ code are attributed to the
+ * modules that request them. Therefore, the global operators new and delete
+ * are replaced here.
+ */
+
+#include "Platform/Memory.h"
+#include "Tools/Debugging/AllocationTracker.h"
+#include <new>
+
+void* Memory::alignedMalloc(size_t size, size_t alignment)
+{
+  return AllocationTracker::allocate(size, alignment);
+}
+
+void Memory::alignedFree(void* ptr)
+{
+  AllocationTracker::free(ptr);
+}
+
+void* operator new(std::size_t size)
+{
+  void* ptr = AllocationTracker::allocate(size);
+  if(!ptr)
+    throw std::bad_alloc();
+  return ptr;
+}
+
+void* operator new[](std::size_t size)
+{
+  return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+  return AllocationTracker::allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+  return AllocationTracker::allocate(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+  AllocationTracker::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+  AllocationTracker::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+  AllocationTracker::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+  AllocationTracker::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+  AllocationTracker::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+  AllocationTracker::free(ptr);
+}
@@ -9,8 +9,12 @@
 #include <fcntl.h>
 #include <semaphore.h>
 #include <unistd.h>
+#include <algorithm>
+#include <atomic>
 #include <cerrno>
 #include <cstdio>
+#include <cstring>
+#include <ctime>
 
 #include "NaoBody.h"
 #include "Platform/BHAssert.h"
@@ -18,6 +22,19 @@
 
 #include "libbhuman/bhuman.h"
 
+static_assert(NaoBody::numOfInertialValues == lbhNumOfInertialSensors, "Wrong number of inertial values");
+
+/**
+ * Returns the current time of the monotonic clock, which is shared with libbhuman.
+ * @return The time in microseconds. It wraps around after about 71 minutes.
+ */
+static unsigned getMicroseconds()
+{
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<unsigned>(ts.tv_sec * 1000000ull + ts.tv_nsec / 1000);
+}
+
 class NaoBodyAccess
 {
 public:
@@ -80,7 +97,11 @@ NaoBody::~NaoBody()
 
 bool NaoBody::init()
 {
-  return naoBodyAccess.init();
+  if(!naoBodyAccess.init())
+    return false;
+  currentInertialSample = naoBodyAccess.lbhData->inertialSampleCount - 1;
+  firstInertialSample = currentInertialSample + 1;
+  return true;
 }
 
 void NaoBody::cleanup()
@@ -98,6 +119,7 @@ bool NaoBody::wait()
 {
   ASSERT(naoBodyAccess.lbhData != (LBHData*)MAP_FAILED);
   ASSERT(naoBodyAccess.sem != SEM_FAILED);
+  const unsigned waitStartTime = getMicroseconds();
   do
   {
     if(sem_wait(naoBodyAccess.sem) == -1)
@@ -125,6 +147,11 @@ bool NaoBody::wait()
   }
   while(naoBodyAccess.lbhData->readingSensors == naoBodyAccess.lbhData->newestSensors);
   naoBodyAccess.lbhData->readingSensors = naoBodyAccess.lbhData->newestSensors;
+  waitEndTime = getMicroseconds();
+  waitTime = waitEndTime - waitStartTime;
+  sensorAge = waitEndTime - naoBodyAccess.lbhData->sensorsTime[naoBodyAccess.lbhData->readingSensors];
+  firstInertialSample = currentInertialSample + 1;
+  currentInertialSample = naoBodyAccess.lbhData->sensorsInertialSample[naoBodyAccess.lbhData->readingSensors];
 
   static bool shout = true;
   if(shout)
@@ -178,10 +205,39 @@ float* NaoBody::getSensors()
   return naoBodyAccess.lbhData->sensors[naoBodyAccess.lbhData->readingSensors];
 }
 
-const RoboCup::RoboCupGameControlData& NaoBody::getGameControlData() const
+unsigned NaoBody::getPreviousInertialSamples(float* samples, unsigned maxNumOfSamples) const
+{
+  ASSERT(naoBodyAccess.lbhData != (LBHData*)MAP_FAILED);
+  unsigned first = currentInertialSample - std::min(currentInertialSample - firstInertialSample, maxNumOfSamples);
+  for(unsigned i = first; i != currentInertialSample; ++i)
+    std::memcpy(samples + (i - first) * lbhNumOfInertialSensors, naoBodyAccess.lbhData->inertialSamples[i % lbhNumOfInertialSamples],
+                sizeof(naoBodyAccess.lbhData->inertialSamples[0]));
+  std::atomic_thread_fence(std::memory_order_acquire);
+
+  // Drop the samples libbhuman might have overwritten while they were copied.
+  const unsigned writing = naoBodyAccess.lbhData->inertialSampleCount;
+  if(writing - first >= static_cast<unsigned>(lbhNumOfInertialSamples))
+  {
+    const unsigned overwritten = std::min(writing - first - lbhNumOfInertialSamples + 1, currentInertialSample - first);
+    std::memmove(samples, samples + overwritten * lbhNumOfInertialSensors,
+                 (currentInertialSample - first - overwritten) * sizeof(naoBodyAccess.lbhData->inertialSamples[0]));
+    first += overwritten;
+  }
+  return currentInertialSample - first;
+}
+
+void NaoBody::getGameControlData(RoboCup::RoboCupGameControlData& gameControlData) const
 {
   ASSERT(naoBodyAccess.lbhData != (LBHData*)MAP_FAILED);
-  return naoBodyAccess.lbhData->gameControlData[naoBodyAccess.lbhData->readingSensors];
+  unsigned version;
+  do
+  {
+    version = naoBodyAccess.lbhData->gameControlDataVersion;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    memcpy(&gameControlData, &naoBodyAccess.lbhData->gameControlData, sizeof(gameControlData));
+    std::atomic_thread_fence(std::memory_order_acquire);
+  }
+  while(version & 1 || version != naoBodyAccess.lbhData->gameControlDataVersion);
 }
 
 float NaoBody::getCPUTemperature()
@@ -227,8 +283,19 @@ void NaoBody::closeActuators()
 {
   ASSERT(naoBodyAccess.lbhData != (LBHData*)MAP_FAILED);
   ASSERT(writingActuators >= 0);
+  naoBodyAccess.lbhData->actuatorsSensorsTime[writingActuators] = naoBodyAccess.lbhData->sensorsTime[naoBodyAccess.lbhData->readingSensors];
   naoBodyAccess.lbhData->newestActuators = writingActuators;
   writingActuators = -1;
+  computeTime = getMicroseconds() - waitEndTime;
+}
+
+const volatile unsigned* NaoBody::getDCMTiming(unsigned& dcmCycles, unsigned& missedActuatorCycles, unsigned& droppedSensorCycles) const
+{
+  ASSERT(naoBodyAccess.lbhData != (LBHData*)MAP_FAILED);
+  dcmCycles = naoBodyAccess.lbhData->dcmCycles;
+  missedActuatorCycles = naoBodyAccess.lbhData->missedActuatorCycles;
+  droppedSensorCycles = naoBodyAccess.lbhData->droppedSensorCycles;
+  return naoBodyAccess.lbhData->latencyHistogram;
 }
 
 void NaoBody::setTeamInfo(int teamNumber, int teamColor, int playerNumber)
@@ -16,8 +16,17 @@
  */
 class NaoBody
 {
+public:
+  static const int numOfInertialValues = 6; /**< Gyro x, y, z and acc x, y, z. */
+
 private:
   int writingActuators = -1; /**< The index of the opened exclusive actuator writing buffer. */
+  unsigned waitEndTime = 0; /**< When the last call to wait() returned (in µs). */
+  unsigned waitTime = 0; /**< How long the last call to wait() waited (in µs). */
+  unsigned sensorAge = 0; /**< How old the sensor data was when wait() returned (in µs). */
+  unsigned computeTime = 0; /**< The time between the last return from wait() and committing the actuators (in µs). */
+  unsigned firstInertialSample = 0; /**< The number of the first IMU sample that was not yet processed by bhuman. */
+  unsigned currentInertialSample = 0; /**< The number of the IMU sample that belongs to the current sensor data. */
 
   FILE* fdCpuTemp = nullptr;
 
@@ -65,8 +74,23 @@ public:
    */
   float* getSensors();
 
-  /** Accesses the lastst data from the GameController. */
-  const RoboCup::RoboCupGameControlData& getGameControlData() const;
+  /**
+   * Copies the IMU samples the DCM provided between the previous and the current sensor data,
+   * i.e. those of the cycles in which bhuman did not take the sensor data.
+   * @param samples The samples are copied to this buffer, oldest first. Each sample consist of
+   *                \c numOfInertialValues values ordered as the inertial sensors in \c bhuman.h.
+   * @param maxNumOfSamples The maximum number of samples the buffer can hold. If more samples
+   *                        are available, only the newest ones are copied.
+   * @return The number of samples copied.
+   */
+  unsigned getPreviousInertialSamples(float* samples, unsigned maxNumOfSamples) const;
+
+  /**
+   * Copies the latest data from the GameController. libbhuman is never blocked by this,
+   * instead the data is copied again if libbhuman updated it in the meantime.
+   * @param gameControlData The data is copied to this object.
+   */
+  void getGameControlData(RoboCup::RoboCupGameControlData& gameControlData) const;
 
   /** Accesses CPU temperature sensor */
   float getCPUTemperature();
@@ -84,6 +108,25 @@ public:
   /** Commits the actuator value buffer. */
   void closeActuators();
 
+  /** Returns how long the last call to wait() waited for new sensor data in µs. */
+  unsigned getWaitTime() const {return waitTime;}
+
+  /** Returns how old the current sensor data was when wait() returned in µs. */
+  unsigned getSensorAge() const {return sensorAge;}
+
+  /** Returns the time between receiving the previous sensor data and committing the actuators computed from them in µs. */
+  unsigned getComputeTime() const {return computeTime;}
+
+  /**
+   * Accesses the timing statistics collected by libbhuman.
+   * @param dcmCycles The number of DCM cycles since libbhuman was started.
+   * @param missedActuatorCycles The number of DCM cycles without new actuator data.
+   * @param droppedSensorCycles The number of DCM cycles in which the previous sensor data was not taken.
+   * @return The histogram of the latencies between sensor data and the actuator data computed from them.
+   *         It has \c lbhNumOfTimingBins entries.
+   */
+  const volatile unsigned* getDCMTiming(unsigned& dcmCycles, unsigned& missedActuatorCycles, unsigned& droppedSensorCycles) const;
+
   /** Sets the current team info that will be used by libgamectrl. */
   void setTeamInfo(int teamNumber, int teamColor, int playerNumber);
 };
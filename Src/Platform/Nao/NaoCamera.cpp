@@ -287,7 +287,9 @@ void NaoCamera::writeCameraSettings()
     else
     {
       appliedSetting.value = currentSetting.value;
+#ifndef NDEBUG
       assertCameraSetting(settingName);
+#endif
     }
   }
 
@@ -305,7 +307,9 @@ void NaoCamera::writeCameraSettings()
     else
     {
       appliedTableEntry.value = currentTableEntry.value;
+#ifndef NDEBUG
       assertAutoExposureWeightTableEntry(i);
+#endif
     }
   }
 }
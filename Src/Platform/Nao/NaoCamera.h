@@ -91,6 +91,8 @@ public:
 
   /**
    * Unconditional write of the camera settings
+   * Only settings that differ from the applied ones are written. In Develop and
+   * Debug builds, each written setting is read back to verify it.
    */
   void writeCameraSettings();
 
@@ -147,7 +149,13 @@ private:
   CameraSettingsCollection appliedSettings; /**< The camera settings that are known to be applied. */
   CameraSettingsSpecial specialSettings; /**< Special settings that are only set */
 
-  static const constexpr unsigned frameBufferCount = 3; /**< Amount of available frame buffers. */
+  /**
+   * Amount of available frame buffers. One of them is held by the Cognition
+   * process while the image is processed, because the Image only references it.
+   * The remaining ones allow the driver to fill the next frame while the last
+   * complete one is waiting to be dequeued.
+   */
+  static const constexpr unsigned frameBufferCount = 4;
 
   unsigned WIDTH; /**< The width of the yuv 422 image */
   unsigned HEIGHT; /**< The height of the yuv 422 image */
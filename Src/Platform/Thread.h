@@ -14,6 +14,7 @@ private:
   std::thread::id id;
   bool running = false;
   int priority = 0;
+  int cpu = -1;
   Semaphore terminated;
 
 public:
@@ -53,6 +54,13 @@ public:
    */
   void setPriority(int prio) { priority = prio; changePriority(); }
 
+  /**
+   * The function restricts the thread to a single core. This avoids that
+   * the thread is migrated between cores. Only supported on the robot.
+   * @param cpu The number of the core. -1 allows all cores.
+   */
+  void setCPU(int cpu) { this->cpu = cpu; changeCPU(); }
+
   /**
    * The function determines whether the thread should still be running.
    * @return Should it continue?
@@ -90,6 +98,8 @@ private:
   void threadStart(std::function<void()> lambda);
 
   void changePriority();
+
+  void changeCPU();
 };
 
 template<class C>
@@ -102,6 +112,7 @@ void Thread::start(C* o, void (C::*f)())
   thread = new std::thread(&Thread::threadStart, this, [o, f]() { (o->*f)(); });
   id = thread->get_id();
   changePriority();
+  changeCPU();
 }
 
 /**
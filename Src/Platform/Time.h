@@ -1,5 +1,15 @@
 #pragma once
 
+#if defined(__i386__) || defined(__x86_64__)
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#else
+#include <chrono>
+#endif
+
 class Time
 {
 private:
@@ -22,6 +32,14 @@ public:
    */
   static unsigned long long getCurrentThreadTime();
 
+  /**
+   * The function returns the value of a fast counter that is incremented with a
+   * constant frequency, i.e. the time stamp counter on x86 processors. The
+   * frequency is not known, so differences must be calibrated by the caller.
+   * @return The current value of the counter.
+   */
+  static unsigned long long getCycleCounter();
+
   /** returns the time since aTime*/
   static int getTimeSince(unsigned aTime);
 
@@ -36,6 +54,15 @@ inline unsigned Time::getSystemTimeBase()
   return base;
 }
 
+inline unsigned long long Time::getCycleCounter()
+{
+#if defined(__i386__) || defined(__x86_64__)
+  return __rdtsc();
+#else
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
 inline int Time::getTimeSince(unsigned aTime)
 {
   return static_cast<int>(getCurrentSystemTime() - aTime);
@@ -0,0 +1,40 @@
+/**
+ * @file Platform/Windows/MappedFile.cpp
+ */
+
+#include "Platform/MappedFile.h"
+#include "Platform/File.h"
+
+#include <Windows.h>
+
+MappedFile::MappedFile(const std::string& name)
+{
+  for(const std::string& fullName : File::getFullNames(name))
+  {
+    HANDLE file = CreateFileA(fullName.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if(file == INVALID_HANDLE_VALUE)
+      continue;
+
+    LARGE_INTEGER fileSize;
+    if(GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0)
+    {
+      HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+      if(mapping)
+      {
+        data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if(data)
+          size = static_cast<size_t>(fileSize.QuadPart);
+        CloseHandle(mapping); // The view keeps the mapping alive.
+      }
+    }
+    CloseHandle(file);
+    break;
+  }
+}
+
+MappedFile::~MappedFile()
+{
+  if(data)
+    UnmapViewOfFile(data);
+}
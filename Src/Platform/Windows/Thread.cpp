@@ -40,6 +40,8 @@ void Thread::changePriority()
     SetThreadPriority(thread->native_handle(), THREAD_PRIORITY_NORMAL + priority);
 }
 
+void Thread::changeCPU() {}
+
 void Thread::nameThread(const std::string& name)
 {
   THREADNAME_INFO info;
@@ -10,9 +10,14 @@
 #include "Modules/Infrastructure/LogDataProvider/CognitionLogDataProvider.h"
 #include "Platform/BHAssert.h"
 #include "Platform/Time.h"
+#include "Tools/Debugging/DebugDrawings.h"
+#include "Tools/Module/Blackboard.h"
 
 #include "Representations/Communication/TeamData.h"
 #include "Representations/Communication/BHumanMessage.h"
+#include "Representations/Infrastructure/CameraInfo.h"
+#include "Representations/Infrastructure/FrameInfo.h"
+#include "Representations/Infrastructure/Image.h"
 
 Cognition::Cognition() :
   Process(theDebugReceiver, theDebugSender),
@@ -23,7 +28,11 @@ Cognition::Cognition() :
   theSPLMessageHandler(inTeamMessages, outTeamMessage),
   moduleManager({ModuleBase::cognitionInfrastructure, ModuleBase::communication,
                  ModuleBase::perception, ModuleBase::modeling, ModuleBase::behaviorControl}),
-  logger(Logger::LoggedProcess::cognition)
+  logger(Logger::LoggedProcess::cognition),
+  theTeamData("TeamData"),
+  theBHumanMessageOutputGenerator("BHumanMessageOutputGenerator"),
+  theCameraInfo("CameraInfo"),
+  theImage("Image")
 {
   theDebugSender.setSize(5200000, 100000);
   theDebugReceiver.setSize(2800000);
@@ -54,7 +63,7 @@ void Cognition::terminate()
 
 bool Cognition::main()
 {
-  // read from team comm udp socket
+  // take team messages received by the network thread
   static_cast<void>(theSPLMessageHandler.receive());
 
   if(CognitionLogDataProvider::isFrameDataComplete() && CameraProvider::isFrameDataComplete())
@@ -62,17 +71,25 @@ bool Cognition::main()
     timingManager.signalProcessStart();
     annotationManager.signalProcessStart();
 
+    // Drop drawings and similar output of this frame if the previous frames were not taken yet
+    Global::getDebugRequestTable().suspendFrameOutput(numberOfMessages > 0 && !theDebugSender.requestedNew());
+
     BH_TRACE_MSG("before TeamData");
     // push teammate data in our system
-    if(Blackboard::getInstance().exists("TeamData") &&
-       static_cast<const TeamData&>(Blackboard::getInstance()["TeamData"]).generate.operator bool())
+    if(theTeamData.exists() && theTeamData->generate.operator bool())
       while(!inTeamMessages.empty())
-        static_cast<const TeamData&>(Blackboard::getInstance()["TeamData"]).generate(inTeamMessages.takeBack());
+      {
+        const RoboCup::SPLStandardMessage* const message = inTeamMessages.takeBack();
+        theTeamData->generate(message, inTeamMessages.getReceiveTimestamp(message));
+      }
 
     // Reset coordinate system for debug field drawing
     DECLARE_DEBUG_DRAWING("origin:Reset", "drawingOnField"); // Set the origin to the (0,0,0)
     ORIGIN("origin:Reset", 0.0f, 0.0f, 0.0f);
 
+    DECLARE_PLOT("process:Cognition:handoverLatency");
+    PLOT("process:Cognition:handoverLatency", theMotionReceiver.getHandoverLatency() * 0.001f);
+
     STOPWATCH_WITH_PLOT("Cognition") moduleManager.execute();
 
     DEBUG_RESPONSE_ONCE("automated requests:DrawingManager") OUTPUT(idDrawingManager, bin, Global::getDrawingManager());
@@ -80,14 +97,23 @@ bool Cognition::main()
     DEBUG_RESPONSE_ONCE("automated requests:StreamSpecification") OUTPUT(idStreamSpecification, bin, Global::getStreamHandler());
 
     theMotionSender.timeStamp = Time::getCurrentSystemTime();
+
+    // Age of the image the data for Motion is based on. Adding Motion's handover latency gives the delay until actuation.
+    DECLARE_PLOT("process:Cognition:imageAge");
+    if(Blackboard::getInstance().exists("FrameInfo"))
+    {
+      const FrameInfo& frameInfo = static_cast<const FrameInfo&>(Blackboard::getInstance()["FrameInfo"]);
+      PLOT("process:Cognition:imageAge", static_cast<int>(theMotionSender.timeStamp - frameInfo.time));
+    }
+
     BH_TRACE_MSG("before theMotionSender.send()");
     theMotionSender.send();
 
-    if(Blackboard::getInstance().exists("BHumanMessageOutputGenerator")
-       && static_cast<const BHumanMessageOutputGenerator&>(Blackboard::getInstance()["BHumanMessageOutputGenerator"]).generate.operator bool()
-       && static_cast<const BHumanMessageOutputGenerator&>(Blackboard::getInstance()["BHumanMessageOutputGenerator"]).sendThisFrame)
+    if(theBHumanMessageOutputGenerator.exists()
+       && theBHumanMessageOutputGenerator->generate.operator bool()
+       && theBHumanMessageOutputGenerator->sendThisFrame)
     {
-      static_cast<const BHumanMessageOutputGenerator&>(Blackboard::getInstance()["BHumanMessageOutputGenerator"]).generate(&outTeamMessage);
+      theBHumanMessageOutputGenerator->generate(&outTeamMessage);
 
       BH_TRACE_MSG("before theTeamHandler.send()");
       theSPLMessageHandler.send();
@@ -97,6 +123,9 @@ bool Cognition::main()
     logger.execute();
 
     DEBUG_RESPONSE("timing") timingManager.getData().copyAllMessages(theDebugSender);
+    DEBUG_RESPONSE_ONCE("timing:saveTrace")
+      if(!timingManager.saveTrace("traceCognition.json"))
+        OUTPUT_WARNING("Could not save traceCognition.json");
 
     DEBUG_RESPONSE("annotation") annotationManager.getOut().copyAllMessages(theDebugSender);
     annotationManager.clear();
@@ -104,21 +133,24 @@ bool Cognition::main()
     if(theDebugSender.getNumberOfMessages() > numberOfMessages + 1)
     {
       // Send process finished message
-      if(Blackboard::getInstance().exists("CameraInfo") &&
-         static_cast<const CameraInfo&>(Blackboard::getInstance()["CameraInfo"]).camera == CameraInfo::lower)
+      // A frame whose drawings were dropped is not finished, so the receiver keeps the previous drawings.
+      const bool finished = !Global::getDebugRequestTable().isFrameOutputSuspended();
+      if(theCameraInfo.exists() && theCameraInfo->camera == CameraInfo::lower)
       {
         // lower camera -> process called 'd'
         // Send completion notification
         theDebugSender.patchMessage(numberOfMessages, 0, 'd');
-        OUTPUT(idProcessFinished, bin, 'd');
+        if(finished)
+          OUTPUT(idProcessFinished, bin, 'd');
       }
-      else
+      else if(finished)
       {
         OUTPUT(idProcessFinished, bin, 'c');
       }
     }
     else
       theDebugSender.removeLastMessage();
+    Global::getDebugRequestTable().suspendFrameOutput(false);
 
     BH_TRACE_MSG("theDebugSender.send()");
     theDebugSender.send();
@@ -131,7 +163,7 @@ bool Cognition::main()
           --Global::getDebugRequestTable().pollCounter == 0)
     OUTPUT(idDebugResponse, text, "pollingFinished");
 
-  if(Blackboard::getInstance().exists("Image"))
+  if(theImage.exists())
   {
     if(SystemCall::getMode() == SystemCall::physicalRobot)
       setPriority(10);
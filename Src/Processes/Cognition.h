@@ -11,6 +11,11 @@
 #include "Tools/Module/ModulePackage.h"
 #include "Tools/ProcessFramework/Process.h"
 
+struct BHumanMessageOutputGenerator;
+struct CameraInfo;
+struct Image;
+struct TeamData;
+
 /**
  * @class Cognition
  * A class that represents a process that receives data from the robot at about 30 Hz.
@@ -31,6 +36,11 @@ private:
   ModuleManager moduleManager; /**< The solution manager handles the execution of modules. */
   Logger logger; /**< The logger logs representations in the background. */
 
+  BlackboardSlot<const TeamData> theTeamData; /**< Accesses TeamData without looking it up by name each frame. */
+  BlackboardSlot<const BHumanMessageOutputGenerator> theBHumanMessageOutputGenerator; /**< Accesses BHumanMessageOutputGenerator. */
+  BlackboardSlot<const CameraInfo> theCameraInfo; /**< Accesses CameraInfo. */
+  BlackboardSlot<const Image> theImage; /**< Is only used to check whether the Image exists. */
+
 public:
   Cognition();
 
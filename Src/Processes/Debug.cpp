@@ -148,7 +148,7 @@ bool Debug::main()
 #else
   theCognitionSender.send(false);
   theMotionSender.send(false);
-  debugHandler.communicate(sendToGUI);
+  debugHandler.communicate(sendToGUI, outQueueMode.filter == QueueFillRequest::latestOnly);
 #endif
 
   return true;
@@ -9,6 +9,10 @@
 #include "Modules/MotionControl/MotionSelector/MotionSelector.h"
 #include "Modules/MotionControl/SpecialActions/SpecialActions.h"
 #include "Platform/Time.h"
+#include "Tools/Debugging/DebugDrawings.h"
+#include "Tools/Math/Constants.h"
+
+#include <thread>
 
 Motion::Motion() :
   Process(theDebugReceiver, theDebugSender),
@@ -25,7 +29,10 @@ Motion::Motion() :
   theCognitionSender.moduleManager = theCognitionReceiver.moduleManager = &moduleManager;
 
   if(SystemCall::getMode() == SystemCall::physicalRobot)
+  {
     setPriority(20);
+    setCPU(static_cast<int>(std::thread::hardware_concurrency()) - 1); // avoid migrations between cores
+  }
 }
 
 void Motion::init()
@@ -41,7 +48,10 @@ void Motion::init()
 void Motion::terminate()
 {
   if(SystemCall::getMode() == SystemCall::physicalRobot)
+  {
     setPriority(0);
+    setCPU(-1);
+  }
   moduleManager.destroy();
   Process::terminate();
 }
@@ -59,7 +69,20 @@ bool Motion::main()
     timingManager.signalProcessStart();
     annotationManager.signalProcessStart();
 
+    // Drop drawings and similar output of this frame if the previous frames were not taken yet
+    Global::getDebugRequestTable().suspendFrameOutput(numberOfMessages > 0 && !theDebugSender.requestedNew());
+
+    DECLARE_PLOT("process:Motion:handoverLatency");
+    PLOT("process:Motion:handoverLatency", theCognitionReceiver.getHandoverLatency() * 0.001f);
+
+    const unsigned executionStart = Time::getRealSystemTime();
     STOPWATCH_WITH_PLOT("Motion") moduleManager.execute();
+#ifdef TARGET_ROBOT
+    // The joint requests of a frame that took longer than a motion cycle miss the next sensor update.
+    const int duration = Time::getRealTimeSince(executionStart);
+    if(executionStart > 20000 && duration > static_cast<int>(Constants::motionCycleTime * 1000.f))
+      TRACE("TIMING: Motion frame took %d ms at %d s after start", duration, executionStart / 1000 - 10);
+#endif
     NaoProvider::finishFrame();
 
     DEBUG_RESPONSE_ONCE("automated requests:DrawingManager") OUTPUT(idDrawingManager, bin, Global::getDrawingManager());
@@ -73,6 +96,9 @@ bool Motion::main()
     logger.execute();
 
     DEBUG_RESPONSE("timing") timingManager.getData().copyAllMessages(theDebugSender);
+    DEBUG_RESPONSE_ONCE("timing:saveTrace")
+      if(!timingManager.saveTrace("traceMotion.json"))
+        OUTPUT_WARNING("Could not save traceMotion.json");
 
     DEBUG_RESPONSE("annotation") annotationManager.getOut().copyAllMessages(theDebugSender);
     annotationManager.clear();
@@ -80,10 +106,13 @@ bool Motion::main()
     if(theDebugSender.getNumberOfMessages() > numberOfMessages + 1)
     {
       // messages were sent in this frame -> send process finished
-      OUTPUT(idProcessFinished, bin, 'm');
+      // A frame whose drawings were dropped is not finished, so the receiver keeps the previous drawings.
+      if(!Global::getDebugRequestTable().isFrameOutputSuspended())
+        OUTPUT(idProcessFinished, bin, 'm');
     }
     else
       theDebugSender.removeLastMessage();
+    Global::getDebugRequestTable().suspendFrameOutput(false);
 
     theDebugSender.send();
 
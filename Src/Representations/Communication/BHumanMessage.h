@@ -19,7 +19,8 @@
  */
 STREAMABLE(BHumanMessage,
 {
-  virtual unsigned toLocalTimestamp(unsigned remoteTimestamp) const { return 0u; },
+  virtual unsigned toLocalTimestamp(unsigned remoteTimestamp) const { return 0u; }
+  unsigned receiveTimestamp = 0; /**< The local time when the message arrived at the network interface. Only set for received messages. */,
 
   (BSPLStandardMessage) theBSPLStandardMessage,
   (BHULKsStandardMessage) theBHULKsStandardMessage,
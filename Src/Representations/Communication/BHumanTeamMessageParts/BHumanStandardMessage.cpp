@@ -6,29 +6,96 @@
 
 #include "BHumanStandardMessage.h"
 #include "Platform/BHAssert.h"
+#include "Tools/Communication/BitPacking.h"
 #include "Tools/Global.h"
+#include "Tools/Math/Constants.h"
+#include "Tools/Math/Eigen.h"
 #include "Tools/Settings.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+  const unsigned perceptBits = 15; /**< Ball percepts are sent in mm in the range [-16384 .. 16383]. */
+  const unsigned deviationBits = 17; /**< The robot pose deviation is sent in mm in the range [0 .. 131071]. */
+  const unsigned sigmaBits = 14; /**< Standard deviations of positions are sent in the range [0 .. maxSigma]. */
+  const unsigned rotationSigmaBits = 10; /**< Standard deviations of rotations are sent in the range [0 .. pi]. */
+  const unsigned correlationBits = 8; /**< Correlation coefficients are sent in the range [-1 .. 1]. */
+  const float maxSigma = 16383.f; /**< The largest standard deviation of a position in mm. */
+
+  /** The number of bits of all fields after the magic number. */
+  const unsigned payloadBits = 32 // ballTimeWhenDisappearedSeenPercentage
+                               + 2 * perceptBits // ballLastPerceptX/Y
+                               + 2 * sigmaBits + correlationBits // ballCovariance
+                               + deviationBits // robotPoseDeviation
+                               + 2 * sigmaBits + rotationSigmaBits + 3 * correlationBits // robotPoseCovariance
+                               + 8 // robotPoseValidity
+                               + 1; // firstRobotArrived
+
+  /**
+   * Writes the correlation coefficient of two variables.
+   * @param writer The writer.
+   * @param covariance The covariance of both variables.
+   * @param variance1 The variance of the first variable.
+   * @param variance2 The variance of the second variable.
+   */
+  void writeCorrelation(BitWriter& writer, float covariance, float variance1, float variance2)
+  {
+    const float denominator = std::sqrt(variance1 * variance2);
+    writer.writeQuantized(denominator > 0.f ? covariance / denominator : 0.f, -1.f, 1.f, correlationBits);
+  }
+
+  /**
+   * Reads a correlation coefficient.
+   * @param reader The reader.
+   * @return The correlation coefficient in the range [-1 .. 1].
+   */
+  float readCorrelation(BitReader& reader)
+  {
+    return reader.readQuantized(-1.f, 1.f, correlationBits);
+  }
+
+  /**
+   * A single quantized correlation coefficient is in [-1 .. 1], so a 2x2
+   * covariance matrix built from it is positive semi-definite. Three
+   * correlation coefficients that were quantized independently do not
+   * necessarily form a positive semi-definite 3x3 correlation matrix.
+   * Therefore, they are scaled towards zero, i.e. the matrix towards the
+   * identity, just as much as necessary to make its smallest eigenvalue
+   * non-negative.
+   * @param rho The correlation coefficients of the variable pairs (1, 0), (2, 0) and (2, 1).
+   */
+  void makePositiveSemiDefinite(std::array<float, 3>& rho)
+  {
+    Matrix3f offDiagonal;
+    offDiagonal << 0.f, rho[0], rho[1],
+                   rho[0], 0.f, rho[2],
+                   rho[1], rho[2], 0.f;
+    Eigen::SelfAdjointEigenSolver<Matrix3f> solver;
+    solver.computeDirect(offDiagonal, Eigen::EigenvaluesOnly);
+    const float smallestEigenvalue = solver.eigenvalues()[0]; // eigenvalue - 1 of the correlation matrix
+    if(smallestEigenvalue < -1.f)
+      for(float& r : rho)
+        r *= -1.f / smallestEigenvalue;
+  }
+
+  /** Standard deviation of a variance that is never negative. */
+  float sigma(float variance) {return std::sqrt(std::max(0.f, variance));}
+}
 
 int BHumanStandardMessage::sizeOfBHumanMessage() const
 {
-  static_assert(BHUMAN_STANDARD_MESSAGE_STRUCT_VERSION == 3, "This method is not adjusted for the current message version");
+  static_assert(BHUMAN_STANDARD_MESSAGE_STRUCT_VERSION == 4, "This method is not adjusted for the current message version");
 
   return sizeof(header)
          + sizeof(version)
          + sizeof(magicNumber)
-         + sizeof(ballTimeWhenDisappearedSeenPercentage)
-         + sizeof(ballLastPerceptX)
-         + sizeof(ballLastPerceptY)
-         + sizeof(ballCovariance)
-         + sizeof(robotPoseDeviation)
-         + sizeof(robotPoseCovariance)
-         + sizeof(robotPoseValidity)
-          +sizeof(firstRobotArrived);
+         + (payloadBits + 7) / 8;
 }
 
 void BHumanStandardMessage::write(void* data) const
 {
-  static_assert(BHUMAN_STANDARD_MESSAGE_STRUCT_VERSION == 3, "This method is not adjusted for the current message version");
+  static_assert(BHUMAN_STANDARD_MESSAGE_STRUCT_VERSION == 4, "This method is not adjusted for the current message version");
 
 #ifndef NDEBUG
   const void* const begin = data; //just for length check
@@ -40,24 +107,35 @@ void BHumanStandardMessage::write(void* data) const
   *reinterpret_cast<uint8_t*&>(data)++ = version;
   *reinterpret_cast<int8_t*&>(data)++ = magicNumber;
 
-  *reinterpret_cast<uint32_t*&>(data)++ = ballTimeWhenDisappearedSeenPercentage;
+  BitWriter writer(data);
+  writer.write(ballTimeWhenDisappearedSeenPercentage, 32);
+
+  writer.write(static_cast<uint32_t>(std::max(-16384, std::min(16383, static_cast<int>(ballLastPerceptX))) + 16384), perceptBits);
+  writer.write(static_cast<uint32_t>(std::max(-16384, std::min(16383, static_cast<int>(ballLastPerceptY))) + 16384), perceptBits);
 
-  *reinterpret_cast<int16_t*&>(data)++ = ballLastPerceptX;
-  *reinterpret_cast<int16_t*&>(data)++ = ballLastPerceptY;
+  writer.writeQuantized(sigma(ballCovariance[0]), 0.f, maxSigma, sigmaBits);
+  writer.writeQuantized(sigma(ballCovariance[1]), 0.f, maxSigma, sigmaBits);
+  writeCorrelation(writer, ballCovariance[2], ballCovariance[0], ballCovariance[1]);
 
-  *reinterpret_cast<std::array<float, 3>*&>(data)++ = ballCovariance;
-  *reinterpret_cast<float*&>(data)++ = robotPoseDeviation;
+  writer.write(static_cast<uint32_t>(std::max(0.f, std::min(static_cast<float>((1u << deviationBits) - 1), robotPoseDeviation)) + 0.5f), deviationBits);
 
-  *reinterpret_cast<std::array<float, 6>*&>(data)++ = robotPoseCovariance;
-  *reinterpret_cast<uint8_t*&>(data)++ = robotPoseValidity;
-  *reinterpret_cast<uint8_t*&>(data)++ = firstRobotArrived;
+  writer.writeQuantized(sigma(robotPoseCovariance[0]), 0.f, maxSigma, sigmaBits);
+  writer.writeQuantized(sigma(robotPoseCovariance[1]), 0.f, maxSigma, sigmaBits);
+  writer.writeQuantized(sigma(robotPoseCovariance[2]), 0.f, pi, rotationSigmaBits);
+  writeCorrelation(writer, robotPoseCovariance[3], robotPoseCovariance[1], robotPoseCovariance[0]);
+  writeCorrelation(writer, robotPoseCovariance[4], robotPoseCovariance[2], robotPoseCovariance[0]);
+  writeCorrelation(writer, robotPoseCovariance[5], robotPoseCovariance[2], robotPoseCovariance[1]);
+
+  writer.write(robotPoseValidity, 8);
+  writer.write(firstRobotArrived ? 1 : 0, 1);
+  data = reinterpret_cast<char*>(data) + writer.getSize();
 
   ASSERT((reinterpret_cast<char*>(data) - reinterpret_cast<const char* const>(begin)) == sizeOfBHumanMessage());
 }
 
 bool BHumanStandardMessage::read(const void* data)
 {
-  static_assert(BHUMAN_STANDARD_MESSAGE_STRUCT_VERSION == 3, "This method is not adjusted for the current message version");
+  static_assert(BHUMAN_STANDARD_MESSAGE_STRUCT_VERSION == 4, "This method is not adjusted for the current message version");
 
   for(size_t i = 0; i < sizeof(header); ++i)
     if(header[i] != *reinterpret_cast<const char*&>(data)++)
@@ -71,17 +149,34 @@ bool BHumanStandardMessage::read(const void* data)
   if(!(Global::settingsExist() && Global::getSettings().magicNumber))
     return false;
 
-  ballTimeWhenDisappearedSeenPercentage = *reinterpret_cast<const uint32_t*&>(data)++;
-
-  ballLastPerceptX = *reinterpret_cast<const int16_t*&>(data)++;
-  ballLastPerceptY = *reinterpret_cast<const int16_t*&>(data)++;
-
-  ballCovariance = *reinterpret_cast<const std::array<float, 3>*&>(data)++;
-  robotPoseDeviation = *reinterpret_cast<const float*&>(data)++;
-
-  robotPoseCovariance = *reinterpret_cast<const std::array<float, 6>*&>(data)++;
-  robotPoseValidity = *reinterpret_cast<const uint8_t*&>(data)++;
-  firstRobotArrived=*reinterpret_cast<const uint8_t*&>(data)++;
+  BitReader reader(data);
+  ballTimeWhenDisappearedSeenPercentage = reader.read(32);
+
+  ballLastPerceptX = static_cast<int16_t>(static_cast<int>(reader.read(perceptBits)) - 16384);
+  ballLastPerceptY = static_cast<int16_t>(static_cast<int>(reader.read(perceptBits)) - 16384);
+
+  const float ballSigmaX = reader.readQuantized(0.f, maxSigma, sigmaBits);
+  const float ballSigmaY = reader.readQuantized(0.f, maxSigma, sigmaBits);
+  ballCovariance[0] = ballSigmaX * ballSigmaX;
+  ballCovariance[1] = ballSigmaY * ballSigmaY;
+  ballCovariance[2] = readCorrelation(reader) * ballSigmaX * ballSigmaY;
+
+  robotPoseDeviation = static_cast<float>(reader.read(deviationBits));
+
+  const float poseSigmaX = reader.readQuantized(0.f, maxSigma, sigmaBits);
+  const float poseSigmaY = reader.readQuantized(0.f, maxSigma, sigmaBits);
+  const float poseSigmaRotation = reader.readQuantized(0.f, pi, rotationSigmaBits);
+  robotPoseCovariance[0] = poseSigmaX * poseSigmaX;
+  robotPoseCovariance[1] = poseSigmaY * poseSigmaY;
+  robotPoseCovariance[2] = poseSigmaRotation * poseSigmaRotation;
+  std::array<float, 3> poseCorrelations = {readCorrelation(reader), readCorrelation(reader), readCorrelation(reader)};
+  makePositiveSemiDefinite(poseCorrelations);
+  robotPoseCovariance[3] = poseCorrelations[0] * poseSigmaY * poseSigmaX;
+  robotPoseCovariance[4] = poseCorrelations[1] * poseSigmaRotation * poseSigmaX;
+  robotPoseCovariance[5] = poseCorrelations[2] * poseSigmaRotation * poseSigmaY;
+
+  robotPoseValidity = static_cast<uint8_t>(reader.read(8));
+  firstRobotArrived = static_cast<uint8_t>(reader.read(1));
 
   return true;
 }
@@ -2,6 +2,9 @@
  * @file BHumanStandardMessage.h
  *
  * The file declares the B-Human standard message.
+ * Except for the header, the version and the magic number, all fields are
+ * bit-packed when the message is written. Covariances are sent as standard
+ * deviations and correlation coefficients quantized to declared ranges.
  *
  * @author <A href="mailto:jesse@tzi.de">Jesse Richter-Klug</A>
  */
@@ -11,7 +14,7 @@
 #include <stdint.h>
 
 #define BHUMAN_STANDARD_MESSAGE_STRUCT_HEADER  "BHUM"
-#define BHUMAN_STANDARD_MESSAGE_STRUCT_VERSION 3 // this should be incremented with each change
+#define BHUMAN_STANDARD_MESSAGE_STRUCT_VERSION 4 // this should be incremented with each change
 
 STREAMABLE(BHumanStandardMessage,
 {
@@ -88,7 +88,7 @@ STREAMABLE(Teammate, COMMA public MessageHandler
 STREAMABLE(TeamData,
 {
   void draw() const;
-  FUNCTION(void(const RoboCup::SPLStandardMessage* const)) generate,
+  FUNCTION(void(const RoboCup::SPLStandardMessage* const, unsigned receiveTimestamp)) generate,
 
   (std::vector<Teammate>) teammates, //< An unordered(!) list of all teammates that are currently communicating with me */
   (int)(0) numberOfActiveTeammates,   //< The number of teammates (in the list) that are at not INACTIVE */
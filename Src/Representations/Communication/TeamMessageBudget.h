@@ -0,0 +1,18 @@
+/**
+ * @file TeamMessageBudget.h
+ *
+ * The file declares a representation of the number of team messages this
+ * robot may still send in the current game.
+ */
+
+#pragma once
+
+#include "Tools/Streams/AutoStreamable.h"
+
+STREAMABLE(TeamMessageBudget,
+{,
+  (bool)(false) limited, /**< Is the number of messages limited? Otherwise, messages are sent at a fixed rate. */
+  (int)(0) sent, /**< The number of messages this robot sent in the current game. */
+  (int)(0) remaining, /**< The number of messages this robot may still send in the current game. */
+  (int)(0) interval, /**< The time in ms between two messages that are sent without a special reason. 0 if there are none. */
+});
@@ -247,6 +247,30 @@ void FieldDimensions::LinesTable::push(const Vector2f& from, const Vector2f& to,
   line.to = to;
   line.isPartOfCircle = isPartOfCircle;
   lines.push_back(line);
+  hasBounds = false;
+}
+
+void FieldDimensions::LinesTable::updateBounds()
+{
+  hasBounds = !lines.empty();
+  if(!hasBounds)
+    return;
+
+  bounds = Boundaryf(-std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+  for(const Line& line : lines)
+  {
+    bounds.add(line.from);
+    bounds.add(line.to);
+  }
+
+  isRectangle = true;
+  for(const Line& line : lines)
+    if(!((line.from.x() == line.to.x() && (line.from.x() == bounds.x.min || line.from.x() == bounds.x.max))
+         || (line.from.y() == line.to.y() && (line.from.y() == bounds.y.min || line.from.y() == bounds.y.max))))
+    {
+      isRectangle = false;
+      break;
+    }
 }
 
 bool FieldDimensions::LinesTable::getClosestIntersection(const Geometry::Line& l, Vector2f& outIntersection) const
@@ -379,6 +403,14 @@ bool FieldDimensions::LinesTable::isInside(const Vector2f& v) const
   //This function assumes that the point (0,0) is inside and
   //that for any point inside the area the line to (0,0) belongs to the area too.
 
+  if(hasBounds)
+  {
+    if(!bounds.isInside(v))
+      return false;
+    else if(isRectangle) // points on the border count as outside, as in the general test below
+      return v.x() > bounds.x.min && v.x() < bounds.x.max && v.y() > bounds.y.min && v.y() < bounds.y.max;
+  }
+
   Geometry::Line testLine(v, -v);
   for(vector<Line>::const_iterator i = lines.begin(); i != lines.end(); ++i)
   {
@@ -521,5 +553,9 @@ void FieldDimensions::serialize(In* in, Out* out)
       fieldLinesWithGoalFrame.lines.push_back(line);
     for(LinesTable::Line& line : goalFrameLines)
       fieldLinesWithGoalFrame.lines.push_back(line);
+
+    // isInsideCarpet, isInsideField and their clip counterparts are queried often
+    this->carpetBorder.updateBounds();
+    this->fieldBorder.updateBounds();
   }
 }
@@ -85,11 +85,21 @@ struct FieldDimensions : public SimpleFieldDimensions
     });
 
     std::vector<Line> lines;
+    Boundaryf bounds; /**< The bounding box of all lines. Only valid if hasBounds is set. */
+    bool hasBounds = false; /**< Were the bounds computed from the current lines? */
+    bool isRectangle = false; /**< Do all lines lie on the edges of the bounding box, i.e. is the polygon an axis-aligned rectangle? */
 
     void push(const Pose2f& p, float l, bool isPartOfCircle = false);
     void push(const Vector2f& s, const Vector2f& e, bool isPartOfCircle = false);
     void pushCircle(const Vector2f& center, float radius, int numOfSegments);
 
+    /**
+     * Computes the bounding box of the lines and whether they form an axis-aligned
+     * rectangle. This allows isInside and clip to answer most queries without
+     * iterating over all lines. Must be called again after the lines were changed.
+     */
+    void updateBounds();
+
     /**
      * Get the closest point to p on a field line
      */
@@ -23,4 +23,5 @@ STREAMABLE(AudioData,
   (unsigned)(2) channels,
   (unsigned)(48000) sampleRate,
   (std::vector<short>) samples, /**< Samples are interleaved. */
+  (unsigned)(0) timestamp, /**< The time when the last sample was captured (approximately, within one period of the device). */
 });
@@ -0,0 +1,58 @@
+/**
+ * @file MotionCycleTiming.h
+ * The file declares a struct that contains timing information about the
+ * exchange of sensor and actuator data between the DCM and process Motion.
+ */
+
+#pragma once
+
+#include "Tools/Debugging/DebugDrawings.h"
+#include "Tools/Streams/AutoStreamable.h"
+#include <algorithm>
+#include <array>
+
+/**
+ * @struct MotionCycleTiming
+ * Durations are measured in microseconds. The histograms have bins of 1 ms.
+ * The last bin also counts all longer durations. The counters and the
+ * histograms accumulate since the respective process was started.
+ */
+STREAMABLE(MotionCycleTiming,
+{
+  static const int numOfBins = 16;
+
+  MotionCycleTiming()
+  {
+    waitTimes.fill(0);
+    computeTimes.fill(0);
+    latencies.fill(0);
+  }
+
+  /**
+   * Adds a duration to a histogram.
+   * @param histogram The histogram.
+   * @param duration The duration in microseconds.
+   */
+  static void add(std::array<unsigned, numOfBins>& histogram, unsigned duration)
+  {
+    ++histogram[std::min(duration / 1000, static_cast<unsigned>(numOfBins - 1))];
+  }
+
+  void draw() const
+  {
+    PLOT("representation:MotionCycleTiming:waitTime", waitTime / 1000.f);
+    PLOT("representation:MotionCycleTiming:computeTime", computeTime / 1000.f);
+    PLOT("representation:MotionCycleTiming:sensorAge", sensorAge / 1000.f);
+    PLOT("representation:MotionCycleTiming:missedActuatorCycles", missedActuatorCycles);
+  },
+
+  (unsigned)(0) waitTime, /**< How long Motion waited for the current sensor data. */
+  (unsigned)(0) sensorAge, /**< How old the sensor data was when Motion started to process it. */
+  (unsigned)(0) computeTime, /**< How long Motion needed from receiving sensor data to sending the actuator data in the previous frame. */
+  (unsigned)(0) dcmCycles, /**< The number of DCM cycles since libbhuman was started. */
+  (unsigned)(0) missedActuatorCycles, /**< The number of DCM cycles in which no new actuator data was available, i.e. Motion missed the deadline. */
+  (unsigned)(0) droppedSensorCycles, /**< The number of DCM cycles in which Motion did not take the previous sensor data. */
+  (std::array<unsigned, numOfBins>) waitTimes, /**< Histogram of the wait times. */
+  (std::array<unsigned, numOfBins>) computeTimes, /**< Histogram of the compute times. */
+  (std::array<unsigned, numOfBins>) latencies, /**< Histogram of the times between the DCM writing sensor data and reading the actuator data computed from them (measured by libbhuman). */
+});
@@ -24,6 +24,9 @@ struct WarningSuppressor
     idcpuTemperature,
     idload,
     idmemoryUsage,
+    idcpuFrequency,
+    idpageFaults,
+    idcontextSwitches,
     idwlan,
     idrobotName,
     idconfiguration,
@@ -55,6 +58,9 @@ void RobotHealth::operator >> (BHumanMessage& m) const
       SEND_CASE(cpuTemperature);
       SEND_CASE_ARRAY(load);
       SEND_CASE(memoryUsage);
+      SEND_CASE(cpuFrequency);
+      SEND_CASE(pageFaults);
+      SEND_CASE(contextSwitches);
       SEND_CASE(wlan);
       SEND_CASE(robotName);
       SEND_CASE(configuration);
@@ -89,6 +95,9 @@ bool RobotHealth::handleArbitraryMessage(InMessage& m, const std::function<unsig
       RECEIVE_CASE(cpuTemperature);
       RECEIVE_CASE_ARRAY(load);
       RECEIVE_CASE(memoryUsage);
+      RECEIVE_CASE(cpuFrequency);
+      RECEIVE_CASE(pageFaults);
+      RECEIVE_CASE(contextSwitches);
       RECEIVE_CASE(wlan);
       RECEIVE_CASE(robotName);
       RECEIVE_CASE(configuration);
@@ -22,6 +22,8 @@ STREAMABLE(MotionRobotHealth,
   (float)(0) avgMotionTime, /**< average execution time */
   (float)(0) maxMotionTime, /**< Maximum execution time */
   (float)(0) minMotionTime, /**< Minimum execution time */
+  (unsigned)(0) missedActuatorCycles, /**< Number of DCM cycles in which Motion missed the deadline for sending actuator data */
+  (unsigned)(0) droppedSensorCycles, /**< Number of DCM cycles in which Motion did not take the sensor data */
 });
 
 /**
@@ -59,6 +61,8 @@ STREAMABLE_WITH_BASE(RobotHealth, MotionRobotHealth, COMMA public PureBHumanArbi
     minMotionTime = motionRobotHealth.minMotionTime;
     maxMotionTime = motionRobotHealth.maxMotionTime;
     avgMotionTime = motionRobotHealth.avgMotionTime;
+    missedActuatorCycles = motionRobotHealth.missedActuatorCycles;
+    droppedSensorCycles = motionRobotHealth.droppedSensorCycles;
   }
 
   void draw() const
@@ -66,6 +70,7 @@ STREAMABLE_WITH_BASE(RobotHealth, MotionRobotHealth, COMMA public PureBHumanArbi
     PLOT("representation:RobotHealth:batteryLevel", batteryLevel);
     PLOT("representation:RobotHealth:maxJointTemperature", maxJointTemperatureStatus);
     PLOT("representation:RobotHealth:totalCurrent", totalCurrent);
+    PLOT("representation:RobotHealth:cpuFrequency", cpuFrequency);
   },
 
   (float)(0.f)                                   cognitionFrameRate,        /**< Frames per second within process "Cognition" */
@@ -76,6 +81,9 @@ STREAMABLE_WITH_BASE(RobotHealth, MotionRobotHealth, COMMA public PureBHumanArbi
   (unsigned char)(0)                             cpuTemperature,            /**< The temperature of the cpu */
   (std::array<unsigned char, 3>)                 load,                      /**< cpu load averages */
   (unsigned char)(0)                             memoryUsage,               /**< Percentage of used memory */
+  (unsigned short)(0)                            cpuFrequency,              /**< Current clock of the first core in MHz. It drops when the cpu is throttled. */
+  (unsigned short)(0)                            pageFaults,                /**< Major page faults per second of the bhuman process */
+  (unsigned short)(0)                            contextSwitches,           /**< Involuntary context switches per second of the bhuman process */
   (bool)(true)                                   wlan,                      /**< Status of the wlan hardware. true: wlan hardware is ok. false: wlan hardware is (probably physically) broken. */
   (std::string)                                  robotName,                 /**< For fancier drawing :-) */
   (Configuration)(Develop)                       configuration,             /**< The configuration that was deployed. */
@@ -3,6 +3,7 @@
 #include "Tools/Math/Angle.h"
 #include "Tools/Math/Eigen.h"
 #include "Tools/Streams/AutoStreamable.h"
+#include <array>
 
 /**
  * Encapsulates the IMU sensor data as it is provided by NAOqi.
@@ -10,9 +11,20 @@
  */
 STREAMABLE(InertialSensorData,
 {
+  static const int maxNumOfPreviousSamples = 4; /**< The maximum number of IMU samples kept from frames that were skipped. */
+
+  InertialSensorData()
+  {
+    previousGyros.fill(Vector3a::Zero());
+    previousAccs.fill(Vector3f::Zero());
+  }
+
   void draw(),
 
   (Vector3a)(Vector3a::Zero()) gyro, /**< The change in orientation around the x-, y-, and z-axis (in radian/s). */
   (Vector3f)(Vector3f::Zero()) acc, /**< The acceleration along the x-, y- and z-axis (in m/s^2). */
   (Vector2a)(Vector2a::Zero()) angle, /**< The orientation of the torso (in rad). */
+  (unsigned char)(0) numOfPreviousSamples, /**< The number of IMU samples the DCM provided since the previous frame in addition to the current one. */
+  (std::array<Vector3a, maxNumOfPreviousSamples>) previousGyros, /**< The gyro measurements of these samples, oldest first (in radian/s). */
+  (std::array<Vector3f, maxNumOfPreviousSamples>) previousAccs, /**< The acceleration measurements of these samples, oldest first (in m/s^2). */
 });
@@ -0,0 +1,35 @@
+/**
+ * @file LatencyCompensatedWorldModel.h
+ *
+ * This file declares a representation that contains the outputs of the modeling
+ * modules predicted to the point of time when the motion that is requested in
+ * this frame will actually be executed.
+ */
+
+#pragma once
+
+#include "Tools/Math/Eigen.h"
+#include "Tools/Math/Pose2f.h"
+#include "Tools/Modeling/Obstacle.h"
+#include "Tools/Streams/AutoStreamable.h"
+#include <vector>
+
+/**
+ * @struct LatencyCompensatedWorldModel
+ * The world model of this frame, predicted by the latency between the image
+ * the models are based on and the execution of the resulting motion request.
+ * All relative coordinates refer to the predicted pose of the robot.
+ */
+STREAMABLE(LatencyCompensatedWorldModel,
+{,
+  (unsigned)(0) time,                              /**< The point of time this prediction was made for (in ms). */
+  (Pose2f) odometryOffset,                         /**< The predicted motion from the current pose to the predicted pose (relative to the current pose). */
+  (Pose2f) robotPose,                              /**< The predicted pose of the robot in field coordinates. */
+  (bool)(false) ballIsValid,                       /**< Was the ball seen recently enough to be predicted? */
+  (Vector2f)(Vector2f::Zero()) ballPosition,       /**< The predicted ball position relative to the predicted robot pose (in mm). */
+  (Vector2f)(Vector2f::Zero()) ballVelocity,       /**< The predicted ball velocity relative to the predicted robot pose (in mm/s). */
+  (bool)(false) teamBallIsValid,                   /**< Is the team ball valid? */
+  (Vector2f)(Vector2f::Zero()) teamBallPosition,   /**< The predicted position of the team ball in field coordinates (in mm). */
+  (Vector2f)(Vector2f::Zero()) teamBallVelocity,   /**< The predicted velocity of the team ball in field coordinates (in mm/s). */
+  (std::vector<Obstacle>) obstacles,               /**< The obstacles relative to the predicted robot pose. */
+});
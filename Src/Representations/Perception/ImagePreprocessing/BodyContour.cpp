@@ -8,6 +8,8 @@
 #include "BodyContour.h"
 #include "Tools/Debugging/DebugDrawings.h"
 #include "Tools/Debugging/DebugDrawings3D.h"
+#include <algorithm>
+#include <limits>
 
 BodyContour::Line::Line(const Vector2i& p1, const Vector2i& p2) :
   p1(p1.x() < p2.x() ? p1 : p2), p2(p1.x() < p2.x() ? p2 : p1)
@@ -15,6 +17,13 @@ BodyContour::Line::Line(const Vector2i& p1, const Vector2i& p2) :
 
 void BodyContour::clipBottom(int x, int& y) const
 {
+  if(x >= 0 && x < static_cast<int>(lowerBounds.size()))
+  {
+    if(lowerBounds[x] < y)
+      y = lowerBounds[x];
+    return;
+  }
+
   int yIntersection;
   for(std::vector<Line>::const_iterator i = lines.begin(); i != lines.end(); ++i)
     if(i->yAt(x, yIntersection) && yIntersection < y)
@@ -32,6 +41,20 @@ void BodyContour::clipBottom(int x, int& y, int imageHeight) const
     y = imageHeight - 1;
 }
 
+void BodyContour::updateLowerBounds()
+{
+  lowerBounds.assign(std::max(0, cameraResolution.x()), std::numeric_limits<int>::max());
+  const int width = static_cast<int>(lowerBounds.size());
+  for(const Line& line : lines)
+    for(int x = std::max(line.p1.x(), 0), xEnd = std::min(line.p2.x(), width); x < xEnd; ++x)
+    {
+      // Same as Line::yAt
+      const int y = line.p1.y() + (line.p2.y() - line.p1.y()) * (x - line.p1.x()) / (line.p2.x() - line.p1.x());
+      if(y < lowerBounds[x])
+        lowerBounds[x] = y;
+    }
+}
+
 void BodyContour::clipLeft(int& x, int y) const
 {
   int xIntersection;
@@ -9,6 +9,7 @@
 
 #include "Tools/Math/Eigen.h"
 #include "Tools/Streams/AutoStreamable.h"
+#include <vector>
 
 /**
  * @struct BodyContour
@@ -127,6 +128,18 @@ STREAMABLE(BodyContour,
    */
   bool isValidPoint(const Vector2i& point) const;
 
+  /**
+   * The method rasterizes the bottom clipping of all image columns, so that
+   * clipBottom does not have to intersect all lines anymore. It must be
+   * called whenever the lines or the camera resolution were changed.
+   */
+  void updateLowerBounds();
+
+  /** Rebuilds the lower bounds, because they are not streamed. */
+  void onRead() {updateLowerBounds();}
+
+  std::vector<int> lowerBounds; /**< The bottom clipping per image column or INT_MAX if there is none. Not streamed. */
+
   /** Creates drawings of the contour. */
   void draw() const,
 
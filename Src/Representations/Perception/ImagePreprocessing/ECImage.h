@@ -15,6 +15,7 @@
 #include "Tools/ImageProcessing/TImage.h"
 #include "Tools/ImageProcessing/PixelTypes.h"
 #include "Tools/Debugging/DebugImages.h"
+#include <functional>
 
 /**
  * A represention containing both a color classified and a grayscale version of
@@ -23,6 +24,24 @@
  */
 STREAMABLE(ECImage,
 {
+  /**
+   * Makes sure that the given rows of all images are computed. This must be
+   * called before accessing pixels, because the provider might only compute
+   * the rows that are actually used.
+   * @param yFrom The first row that is needed. It is clipped to the image.
+   * @param yTo The row after the last one that is needed. It is clipped to the image.
+   */
+  void prepare(int yFrom, int yTo) const
+  {
+    if(computeRows)
+      computeRows(yFrom, yTo);
+  }
+
+  /** Makes sure that all rows of all images are computed. */
+  void prepareAll() const {prepare(0, colored.height);}
+
+  std::function<void(int, int)> computeRows; /**< Computes the given rows if they were not computed yet. Not set if all rows are always computed. */
+
   void draw() const
   {
     SEND_DEBUG_IMAGE("ColoredImage", colored);
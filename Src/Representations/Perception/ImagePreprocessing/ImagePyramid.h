@@ -0,0 +1,83 @@
+/**
+ * @file ImagePyramid.h
+ *
+ * Declares a representation containing downscaled versions of the grayscale
+ * image and the color channels of the ECImage.
+ */
+
+#pragma once
+
+#include "Platform/BHAssert.h"
+#include "Tools/Streams/AutoStreamable.h"
+#include "Tools/ImageProcessing/TImage.h"
+#include "Tools/ImageProcessing/PixelTypes.h"
+#include "Tools/Debugging/DebugImages.h"
+#include <vector>
+
+/**
+ * A representation containing downscaled versions of the grayscale image and
+ * optionally of the color channels of the ECImage. Level n is scaled down by
+ * 2^n in both dimensions. Level 0 is not stored, because it is the ECImage itself.
+ * Modules that need a smaller image should use a level from here instead of
+ * shrinking the image themselves.
+ */
+STREAMABLE(ImagePyramid,
+{
+  using Level = TImage<PixelTypes::GrayscaledPixel>;
+
+  /**
+   * The number of levels available, i.e. the highest level that can be accessed.
+   * @return The number of downscaled levels.
+   */
+  unsigned numOfLevels() const {return static_cast<unsigned>(grayscaled.size());}
+
+  /**
+   * Are the color channels also part of the pyramid?
+   * @return Can getU and getV be called?
+   */
+  bool hasColorChannels() const {return !ued.empty();}
+
+  /**
+   * The grayscale image of a level.
+   * @param level The level. Must be in [1 .. numOfLevels()].
+   * @return The image scaled down by 2^level.
+   */
+  const Level& getGrayscale(unsigned level) const
+  {
+    ASSERT(level >= 1 && level <= grayscaled.size());
+    return grayscaled[level - 1];
+  }
+
+  /**
+   * The U channel of a level.
+   * @param level The level. Must be in [1 .. numOfLevels()].
+   * @return The channel scaled down by 2^level.
+   */
+  const Level& getU(unsigned level) const
+  {
+    ASSERT(level >= 1 && level <= ued.size());
+    return ued[level - 1];
+  }
+
+  /**
+   * The V channel of a level.
+   * @param level The level. Must be in [1 .. numOfLevels()].
+   * @return The channel scaled down by 2^level.
+   */
+  const Level& getV(unsigned level) const
+  {
+    ASSERT(level >= 1 && level <= ved.size());
+    return ved[level - 1];
+  }
+
+  void draw() const
+  {
+    if(!grayscaled.empty())
+      SEND_DEBUG_IMAGE("ImagePyramidGrayscale", grayscaled.back());
+  },
+
+  (unsigned)(0) timeStamp,
+  (std::vector<Level>) grayscaled, /**< grayscaled[i] is level i + 1 of the grayscale image. */
+  (std::vector<Level>) ued, /**< ued[i] is level i + 1 of the U channel. Empty if not computed. */
+  (std::vector<Level>) ved, /**< ved[i] is level i + 1 of the V channel. Empty if not computed. */
+});
@@ -28,6 +28,50 @@ void RobotModel::setJointData(const JointAngles& jointAngles, const RobotDimensi
   updateCenterOfMass(massCalibration);
 }
 
+void RobotModel::updateJointData(const JointAngles& jointAngles, const JointAngles& previousJointAngles,
+                                 const RobotDimensions& robotDimensions, const MassCalibration& massCalibration)
+{
+  auto changed = [&](int first, int end)
+  {
+    for(int i = first; i < end; ++i)
+      if(jointAngles.angles[i] != previousJointAngles.angles[i])
+        return true;
+    return false;
+  };
+
+  bool anyChanged = false;
+  if(changed(Joints::headYaw, Joints::firstArmJoint))
+  {
+    ForwardKinematic::calculateHeadChain(jointAngles, robotDimensions, limbs);
+    anyChanged = true;
+  }
+  if(changed(Joints::firstLeftArmJoint, Joints::firstRightArmJoint))
+  {
+    ForwardKinematic::calculateArmChain(Arms::left, jointAngles, robotDimensions, limbs);
+    anyChanged = true;
+  }
+  if(changed(Joints::firstRightArmJoint, Joints::firstLegJoint))
+  {
+    ForwardKinematic::calculateArmChain(Arms::right, jointAngles, robotDimensions, limbs);
+    anyChanged = true;
+  }
+  if(changed(Joints::firstLeftLegJoint, Joints::firstRightLegJoint))
+  {
+    ForwardKinematic::calculateLegChain(Legs::left, jointAngles, robotDimensions, limbs);
+    soleLeft = limbs[Limbs::footLeft] + Vector3f(0.f, 0.f, -robotDimensions.footHeight);
+    anyChanged = true;
+  }
+  if(changed(Joints::firstRightLegJoint, Joints::numOfJoints))
+  {
+    ForwardKinematic::calculateLegChain(Legs::right, jointAngles, robotDimensions, limbs);
+    soleRight = limbs[Limbs::footRight] + Vector3f(0.f, 0.f, -robotDimensions.footHeight);
+    anyChanged = true;
+  }
+
+  if(anyChanged)
+    updateCenterOfMass(massCalibration);
+}
+
 void RobotModel::updateCenterOfMass(const MassCalibration& massCalibration)
 {
   // calculate center of mass
@@ -41,6 +41,16 @@ STREAMABLE(RobotModel,
    */
   void setJointData(const JointAngles& jointAngles, const RobotDimensions& robotDimensions, const MassCalibration& massCalibration);
 
+  /**
+   * Recalculates only the kinematic chains whose joint angles changed.
+   * @param jointAngles The new joint data.
+   * @param previousJointAngles The joint data this model was calculated from.
+   * @param robotDimensions The dimensions of the robot.
+   * @param massCalibration The mass calibration of the robot.
+   */
+  void updateJointData(const JointAngles& jointAngles, const JointAngles& previousJointAngles,
+                       const RobotDimensions& robotDimensions, const MassCalibration& massCalibration);
+
   /**
    * Re-calculate the center of mass in this model.
    * @param massCalibration The mass calibration of the robot.
@@ -162,10 +162,14 @@ protected:
 
     /**
      * Adds a string description containing the current value of a parameter to the list of parameters.
+     * The parameters are only needed for the activation graph, so nothing is done without one.
      * @param value The current value of the parameter.
      */
     void addParameter(const Streamable& value) const
     {
+      if(!instance->activationGraph)
+        return;
+
       char buf[10000];
       OutMapMemory stream(buf, true);
       stream << value;
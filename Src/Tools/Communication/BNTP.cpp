@@ -28,13 +28,16 @@ void BNTP::operator >> (BHumanMessage& m) const
   }
 
   // Send NTP requests to teammates?
-  if((m.theBHULKsStandardMessage.requestsNTPMessage = theFrameInfo.time - lastNTPRequestSent >= NTP_REQUEST_INTERVAL))
+  if((m.theBHULKsStandardMessage.requestsNTPMessage = theFrameInfo.time - lastNTPRequestSent
+      >= static_cast<unsigned>(allSynchronized() ? NTP_SYNCHRONIZED_REQUEST_INTERVAL : NTP_REQUEST_INTERVAL)))
     const_cast<unsigned&>(lastNTPRequestSent) = theFrameInfo.time;
 }
 
 void BNTP::operator<<(const BHumanMessage& m)
 {
-  const unsigned receiveTimeStamp = Time::getCurrentSystemTime();
+  const unsigned receiveTimeStamp = m.receiveTimestamp ? m.receiveTimestamp : Time::getCurrentSystemTime();
+  if(m.theBSPLStandardMessage.playerNum < MAX_NUM_OF_NTP_CLIENTS)
+    timeLastReceived[m.theBSPLStandardMessage.playerNum] = theFrameInfo.time;
 
   if(m.theBHULKsStandardMessage.requestsNTPMessage)
   {
@@ -53,16 +56,26 @@ void BNTP::operator<<(const BHumanMessage& m)
       SynchronizationMeasurementsBuffer::SynchronizationMeasurement t;
       t.roundTrip = int(receiveTimeStamp - itr->requestOrigination) - int(m.theBHULKsStandardMessage.timestamp - itr->requestReceipt);
       t.offset = int(itr->requestReceipt - itr->requestOrigination + m.theBHULKsStandardMessage.timestamp - receiveTimeStamp) / 2;
+      t.time = receiveTimeStamp;
       timeSyncBuffers[m.theBSPLStandardMessage.playerNum].add(t);
     }
   }
 }
 
+bool BNTP::allSynchronized() const
+{
+  for(unsigned i = 0; i < MAX_NUM_OF_NTP_CLIENTS; ++i)
+    if(i != static_cast<unsigned>(theRobotInfo.number) && timeLastReceived[i]
+       && theFrameInfo.getTimeSince(timeLastReceived[i]) < NTP_TEAMMATE_TIMEOUT && !timeSyncBuffers[i].driftKnown)
+      return false;
+  return true;
+}
+
 void SynchronizationMeasurementsBuffer::add(const SynchronizationMeasurement& s)
 {
   buffer.push_front(s);
 
-  bestOffset = buffer[0].offset;
+  int bestOffset = buffer[0].offset;
   int shortestRoundTrip = buffer[0].roundTrip;
   for(size_t i = 1; i < buffer.size(); ++i)
     if(buffer[i].roundTrip < shortestRoundTrip)
@@ -70,4 +83,48 @@ void SynchronizationMeasurementsBuffer::add(const SynchronizationMeasurement& s)
       shortestRoundTrip = buffer[i].roundTrip;
       bestOffset = buffer[i].offset;
     }
+  uncertainty = (std::max(0, shortestRoundTrip) + 1) / 2;
+  referenceTime = buffer[0].time;
+
+  // Fit a line through the offsets of all measurements that were not delayed by jitter.
+  float sumTime = 0.f;
+  float sumOffset = 0.f;
+  int count = 0;
+  int span = 0;
+  for(const SynchronizationMeasurement& measurement : buffer)
+    if(measurement.roundTrip <= shortestRoundTrip + MAX_JITTER)
+    {
+      const int time = static_cast<int>(measurement.time - referenceTime);
+      sumTime += static_cast<float>(time);
+      sumOffset += static_cast<float>(measurement.offset);
+      span = std::max(span, -time);
+      ++count;
+    }
+
+  driftKnown = false;
+  if(count >= MIN_MEASUREMENTS_FOR_DRIFT && span >= MIN_TIME_SPAN_FOR_DRIFT)
+  {
+    const float meanTime = sumTime / static_cast<float>(count);
+    const float meanOffset = sumOffset / static_cast<float>(count);
+    float covariance = 0.f;
+    float variance = 0.f;
+    for(const SynchronizationMeasurement& measurement : buffer)
+      if(measurement.roundTrip <= shortestRoundTrip + MAX_JITTER)
+      {
+        const float time = static_cast<float>(static_cast<int>(measurement.time - referenceTime)) - meanTime;
+        covariance += time * (static_cast<float>(measurement.offset) - meanOffset);
+        variance += time * time;
+      }
+
+    // Quartz clocks drift by far less than 0.1%, larger values are caused by noise.
+    static const float maxDrift = 0.001f;
+    drift = std::max(-maxDrift, std::min(maxDrift, covariance / variance));
+    offset = meanOffset - drift * meanTime;
+    driftKnown = true;
+  }
+  else
+  {
+    drift = 0.f;
+    offset = static_cast<float>(bestOffset);
+  }
 }
@@ -52,8 +52,11 @@ STREAMABLE(BNTPRequest,
  * @class SynchronizationMeasurementsBuffer
  *
  * A class for buffering the last synchronization measurements.
- * The currently best time offset is the element with the smallest
- * round trip time.
+ * The clock of another robot is modeled by an offset and a drift, which
+ * are fitted to the measurements with the smallest round trip times, i.e.
+ * measurements delayed by network jitter are ignored. As long as the
+ * measurements do not span enough time to estimate the drift, the offset
+ * of the measurement with the smallest round trip time is used.
  */
 class BNTP;
 class SynchronizationMeasurementsBuffer
@@ -69,17 +72,28 @@ public:
   {
     int offset = 0;///< Offset of the time of another robot relative to the own time.
     int roundTrip = 0;///< The time, the two NTP messages have been in the WLAN.
+    unsigned time = 0;///< The local time when the measurement was completed.
   };
 
 private:
-  enum { MAX_NUMBER_OF_MEASUREMENTS = 6 }; ///< Constant for internal buffer size
+  enum
+  {
+    MAX_NUMBER_OF_MEASUREMENTS = 12, ///< Constant for internal buffer size
+    MAX_JITTER = 3, ///< Measurements with a round trip time longer than the shortest one plus this value in ms are ignored.
+    MIN_MEASUREMENTS_FOR_DRIFT = 4, ///< The number of measurements required to estimate the drift.
+    MIN_TIME_SPAN_FOR_DRIFT = 10000 ///< The time in ms the measurements must span to estimate the drift.
+  };
   RingBuffer<SynchronizationMeasurement, MAX_NUMBER_OF_MEASUREMENTS> buffer; ///< A buffer for the last measurements
 
-  int bestOffset = 0; ///< The time offset in this buffer with shortest round trip time
+  float offset = 0.f; ///< The time offset at the reference time.
+  float drift = 0.f; ///< The change of the time offset per ms of own time.
+  unsigned referenceTime = 0; ///< The local time the offset refers to.
+  int uncertainty = -1; ///< The maximum error of the offset in ms, i.e. half the shortest round trip time. -1 if unknown.
+  bool driftKnown = false; ///< Was the drift estimated?
 
   friend BNTP;
   /**
-   * Adds a new measurement to the ring buffer
+   * Adds a new measurement to the ring buffer and updates the model of the clock.
    * @param s The measurement
    */
   void add(const SynchronizationMeasurement& s);
@@ -87,8 +101,16 @@ private:
 public:
   inline unsigned getRemoteTimeInLocalTime(unsigned remoteTime) const
   {
-    return static_cast<unsigned>(std::max(0, static_cast<int>(remoteTime) - bestOffset));
+    const float localTimeSinceReference = static_cast<float>(static_cast<int>(remoteTime - referenceTime)) - offset;
+    const int currentOffset = static_cast<int>(offset + drift * localTimeSinceReference + (offset < 0.f ? -0.5f : 0.5f));
+    return static_cast<unsigned>(std::max(0, static_cast<int>(remoteTime) - currentOffset));
   }
+
+  /**
+   * Returns how exactly remote times are converted.
+   * @return The maximum error in ms or -1 if no measurements were made yet.
+   */
+  int getUncertainty() const { return uncertainty; }
 };
 
 /**
@@ -108,12 +130,23 @@ public:
   }
 
 private:
-  enum { MAX_NUM_OF_NTP_CLIENTS = 12, MAX_NUM_OF_NTP_PACKAGES = 12, NTP_REQUEST_INTERVAL = 2000 }; /**< Some constants for NTP snychronization. */
+  enum
+  {
+    MAX_NUM_OF_NTP_CLIENTS = 12,
+    MAX_NUM_OF_NTP_PACKAGES = 12,
+    NTP_REQUEST_INTERVAL = 2000, ///< The time between two requests as long as the clock of a teammate is not modeled yet.
+    NTP_SYNCHRONIZED_REQUEST_INTERVAL = 8000, ///< The time between two requests if the clocks of all teammates are modeled.
+    NTP_TEAMMATE_TIMEOUT = 4000 ///< Teammates not heard of for this time in ms are not considered.
+  }; /**< Some constants for NTP snychronization. */
 
   unsigned lastNTPRequestSent = 0; /**< The point of time when the last NTP request has been sent to the team. */
   RingBuffer<BNTPRequest, MAX_NUM_OF_NTP_PACKAGES> receivedNTPRequests; /**< The requests received in the current frame. */
 
   SynchronizationMeasurementsBuffer timeSyncBuffers[MAX_NUM_OF_NTP_CLIENTS]; /**< A buffer which contains synchronization data for all other robots. */
+  unsigned timeLastReceived[MAX_NUM_OF_NTP_CLIENTS] = {0}; /**< When was the last message of each robot received? */
+
+  /** Are the clocks of all teammates that are currently communicating modeled including their drift? */
+  bool allSynchronized() const;
 
   const FrameInfo& theFrameInfo;
   const RobotInfo& theRobotInfo;
@@ -0,0 +1,108 @@
+/**
+ * @file BitPacking.h
+ *
+ * The file declares classes that write values with an arbitrary number of
+ * bits to memory and read them back. Values with a declared range are
+ * quantized to the number of bits given, saving space in team messages.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @class BitWriter
+ * Writes values bit by bit to memory, starting with the least significant
+ * bits of each byte.
+ */
+class BitWriter
+{
+private:
+  uint8_t* data; /**< The memory that is written to. */
+  size_t bit = 0; /**< The number of bits written so far. */
+
+public:
+  /** @param data The memory that is written to. It must be large enough. */
+  explicit BitWriter(void* data) : data(static_cast<uint8_t*>(data)) {}
+
+  /**
+   * Writes an unsigned value.
+   * @param value The value. Only the lowest bits are written.
+   * @param bits The number of bits to write (at most 32).
+   */
+  void write(uint32_t value, unsigned bits)
+  {
+    for(unsigned i = 0; i < bits; ++i, ++bit)
+    {
+      if(!(bit & 7))
+        data[bit >> 3] = 0;
+      if(value >> i & 1)
+        data[bit >> 3] |= static_cast<uint8_t>(1 << (bit & 7));
+    }
+  }
+
+  /**
+   * Writes a value that is quantized to a range.
+   * Values outside of the range are clamped to its limits.
+   * @param value The value.
+   * @param min The smallest value that can be represented.
+   * @param max The largest value that can be represented.
+   * @param bits The number of bits to write (at most 24). The range is
+   *             divided into 2^bits - 1 steps.
+   */
+  void writeQuantized(float value, float min, float max, unsigned bits)
+  {
+    const float steps = static_cast<float>((1u << bits) - 1);
+    const float clamped = value < min ? min : value > max ? max : value;
+    write(static_cast<uint32_t>((clamped - min) / (max - min) * steps + 0.5f), bits);
+  }
+
+  /** Returns the number of bytes written, including a partially written last byte. */
+  size_t getSize() const {return (bit + 7) >> 3;}
+};
+
+/**
+ * @class BitReader
+ * Reads values written by a BitWriter.
+ */
+class BitReader
+{
+private:
+  const uint8_t* data; /**< The memory that is read from. */
+  size_t bit = 0; /**< The number of bits read so far. */
+
+public:
+  /** @param data The memory that is read from. */
+  explicit BitReader(const void* data) : data(static_cast<const uint8_t*>(data)) {}
+
+  /**
+   * Reads an unsigned value.
+   * @param bits The number of bits to read (at most 32).
+   * @return The value.
+   */
+  uint32_t read(unsigned bits)
+  {
+    uint32_t value = 0;
+    for(unsigned i = 0; i < bits; ++i, ++bit)
+      if(data[bit >> 3] >> (bit & 7) & 1)
+        value |= 1u << i;
+    return value;
+  }
+
+  /**
+   * Reads a value that was quantized to a range.
+   * @param min The smallest value that can be represented.
+   * @param max The largest value that can be represented.
+   * @param bits The number of bits to read. Must be the same as when writing.
+   * @return The value.
+   */
+  float readQuantized(float min, float max, unsigned bits)
+  {
+    const float steps = static_cast<float>((1u << bits) - 1);
+    return min + static_cast<float>(read(bits)) / steps * (max - min);
+  }
+
+  /** Returns the number of bytes read, including a partially read last byte. */
+  size_t getSize() const {return (bit + 7) >> 3;}
+};
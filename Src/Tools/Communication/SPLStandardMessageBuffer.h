@@ -18,6 +18,7 @@ template<std::size_t capacity = 0> class SPLStandardMessageBuffer
 {
 private:
   RoboCup::SPLStandardMessage* buffer; /**< Stores the elements of the buffer. */
+  unsigned receiveTimestamps[capacity]; /**< The times when the elements were received. */
   std::size_t head = 0; /**< The next entry that will be used for push_front(). */
   std::size_t entries = 0; /**< The number of entries in the buffer. */
 
@@ -35,11 +36,13 @@ public:
    * Sets the head forward and returns the pointer to this element.
    *
    * If the ringbuffer was full, this will indirectly remove the last element.
+   * @param receiveTimestamp The time when the message that is stored in the element was received.
    */
-  RoboCup::SPLStandardMessage* setForward()
+  RoboCup::SPLStandardMessage* setForward(unsigned receiveTimestamp = 0)
   {
     entries = std::min(capacity - 1, ++entries);
     (++head) %= capacity;
+    receiveTimestamps[head] = receiveTimestamp;
     return &buffer[head];
   }
 
@@ -58,4 +61,13 @@ public:
     ASSERT(!empty());
     return &buffer[(capacity + head - --entries) % capacity];
   }
+
+  /**
+   * Returns the time when a message in this buffer was received.
+   * @param message The address of the message, e.g. as returned by takeBack().
+   */
+  unsigned getReceiveTimestamp(const RoboCup::SPLStandardMessage* message) const
+  {
+    return receiveTimestamps[message - buffer];
+  }
 };
@@ -234,3 +234,24 @@ bool TcpComm::send(const unsigned char* buffer, int size)
     return false;
   }
 }
+
+int TcpComm::sendSome(const unsigned char* buffer, int size)
+{
+  if(!checkConnection())
+    return -1;
+
+  RESET_ERRNO;
+  const int sent = (int) ::send(transferSocket, (const char*)buffer, size, MSG_NOSIGNAL);
+  if(sent >= 0)
+  {
+    overallBytesSent += sent;
+    return sent;
+  }
+  else if(ERRNO == EWOULDBLOCK || ERRNO == EINPROGRESS)
+    return 0;
+  else
+  {
+    closeTransferSocket();
+    return -1;
+  }
+}
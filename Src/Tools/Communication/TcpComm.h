@@ -73,6 +73,15 @@ public:
    */
   bool send(const unsigned char* buffer, int size);
 
+  /**
+   * The function sends as many bytes of a block as the send buffer can take
+   * without waiting.
+   * @param buffer The bytes to send.
+   * @param size The number of bytes to send.
+   * @return The number of bytes sent, which can be 0, or -1 if there is no connection.
+   */
+  int sendSome(const unsigned char* buffer, int size);
+
   /**
    * The function receives a block of bytes.
    * @param buffer This buffer will be filled with the bytes to receive.
@@ -19,6 +19,7 @@
 #  include <cstring>
 #  include <net/if.h>
 #  include <ifaddrs.h>
+#  include <poll.h>
 #endif
 
 #include "Platform/BHAssert.h"
@@ -306,6 +307,52 @@ int UdpComm::readLocal(char* data, int len)
   }
 }
 
+int UdpComm::read(char* const data[], int len, int sizes[], unsigned ips[], int count)
+{
+  if(count > maxBatchSize)
+    count = maxBatchSize;
+#ifdef LINUX
+  mmsghdr messages[maxBatchSize];
+  iovec buffers[maxBatchSize];
+  sockaddr_in senderAddrs[maxBatchSize];
+  memset(messages, 0, count * sizeof(mmsghdr));
+  for(int i = 0; i < count; ++i)
+  {
+    buffers[i].iov_base = data[i];
+    buffers[i].iov_len = len;
+    messages[i].msg_hdr.msg_name = &senderAddrs[i];
+    messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+    messages[i].msg_hdr.msg_iov = &buffers[i];
+    messages[i].msg_hdr.msg_iovlen = 1;
+  }
+  const int result = ::recvmmsg(sock, messages, count, MSG_WAITFORONE, nullptr);
+  for(int i = 0; i < result; ++i)
+  {
+    sizes[i] = static_cast<int>(messages[i].msg_len);
+    ips[i] = ntohl(senderAddrs[i].sin_addr.s_addr);
+  }
+  return result;
+#else
+  int received = 0;
+  while(received < count && (sizes[received] = read(data[received], len, ips[received])) > 0)
+    ++received;
+  return received ? received : -1;
+#endif
+}
+
+bool UdpComm::wait(int timeout)
+{
+  pollfd fd;
+  fd.fd = sock;
+  fd.events = POLLIN;
+  fd.revents = 0;
+#ifdef WINDOWS
+  return WSAPoll(&fd, 1, timeout) > 0;
+#else
+  return ::poll(&fd, 1, timeout) > 0;
+#endif
+}
+
 bool UdpComm::write(const char* data, const int len)
 {
   return ::sendto(sock, data, len, 0, target, sizeof(sockaddr_in)) == len;
@@ -31,6 +31,8 @@ private:
   socket_t sock;
 
 public:
+  static const int maxBatchSize = 16; /**< The maximum number of packages read at once. */
+
   UdpComm();
 
   ~UdpComm();
@@ -91,6 +93,25 @@ public:
    */
   int readLocal(char* data, int len);
 
+  /**
+   * The function tries to read several packages from a socket at once.
+   * On Linux, this only requires a single system call.
+   * @param data The buffers the packages are written to.
+   * @param len The size of each buffer.
+   * @param sizes The sizes of the packages received.
+   * @param ips The ip addresses of the senders of the packages received.
+   * @param count The number of buffers. At most maxBatchSize are used.
+   * @return Number of packages received or -1 in case of an error.
+   */
+  int read(char* const data[], int len, int sizes[], unsigned ips[], int count);
+
+  /**
+   * The function waits until a package can be read from the socket.
+   * @param timeout The maximum time to wait in ms.
+   * @return Can a package be read now?
+   */
+  bool wait(int timeout);
+
   /**
    * The function writes a package to a socket.
    * @return True if the package was written.
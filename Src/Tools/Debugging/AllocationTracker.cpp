@@ -0,0 +1,90 @@
+/**
+ * @file AllocationTracker.cpp
+ * Implementation of a class that attributes heap allocations to accounts.
+ * All data are initialized statically, because the global operator new
+ * can be called before any dynamic initialization took place.
+ */
+
+#include "AllocationTracker.h"
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+
+/** The header preceding each tracked block. */
+struct Header
+{
+  size_t size; /**< The size of the block without the header. */
+  unsigned account; /**< The account that allocated the block. */
+  unsigned offset; /**< The distance between the start of the allocated memory and the block. */
+};
+
+/** The space reserved for the header. Preserves the alignment of malloc. */
+static const size_t headerSize = 16;
+static_assert(sizeof(Header) <= headerSize, "Header does not fit");
+
+static const char* names[AllocationTracker::maxNumOfAccounts] = {"other"}; /**< The names of all accounts. */
+static std::atomic<unsigned> numOfAccounts(1); /**< The number of accounts registered. */
+static std::mutex mutex; /**< Protects the registration of accounts. */
+static std::atomic<size_t> liveBytes[AllocationTracker::maxNumOfAccounts]; /**< The bytes allocated per account. */
+static std::atomic<size_t> peakBytes[AllocationTracker::maxNumOfAccounts]; /**< The maximum bytes allocated per account. */
+static std::atomic<unsigned> allocations[AllocationTracker::maxNumOfAccounts]; /**< The allocations per account since the last reset. */
+
+thread_local unsigned AllocationTracker::current = 0;
+
+unsigned AllocationTracker::registerAccount(const char* name)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  const unsigned numOfNames = numOfAccounts;
+  for(unsigned i = 0; i < numOfNames; ++i)
+    if(!strcmp(names[i], name))
+      return i;
+  if(numOfNames == maxNumOfAccounts)
+    return 0; // Too many accounts, charge them all to "other"
+  names[numOfNames] = name;
+  numOfAccounts = numOfNames + 1;
+  return numOfNames;
+}
+
+AllocationTracker::Statistics AllocationTracker::getStatistics(unsigned account)
+{
+  return {liveBytes[account], peakBytes[account], allocations[account]};
+}
+
+void AllocationTracker::resetAllocations(unsigned account)
+{
+  allocations[account] = 0;
+}
+
+void* AllocationTracker::allocate(size_t size, size_t alignment)
+{
+  const size_t extra = alignment ? alignment - 1 : 0;
+  char* memory = static_cast<char*>(malloc(size + headerSize + extra));
+  if(!memory)
+    return nullptr;
+
+  char* ptr = memory + headerSize;
+  if(extra)
+    ptr += (alignment - reinterpret_cast<uintptr_t>(ptr) % alignment) % alignment;
+  Header& header = reinterpret_cast<Header*>(ptr)[-1];
+  header.size = size;
+  header.account = current;
+  header.offset = static_cast<unsigned>(ptr - memory);
+
+  const size_t live = liveBytes[header.account].fetch_add(size, std::memory_order_relaxed) + size;
+  size_t peak = peakBytes[header.account].load(std::memory_order_relaxed);
+  while(live > peak && !peakBytes[header.account].compare_exchange_weak(peak, live, std::memory_order_relaxed));
+  allocations[header.account].fetch_add(1, std::memory_order_relaxed);
+  return ptr;
+}
+
+void AllocationTracker::free(void* ptr)
+{
+  if(ptr)
+  {
+    const Header& header = reinterpret_cast<Header*>(ptr)[-1];
+    liveBytes[header.account].fetch_sub(header.size, std::memory_order_relaxed);
+    ::free(static_cast<char*>(ptr) - header.offset);
+  }
+}
@@ -0,0 +1,87 @@
+/**
+ * @file AllocationTracker.h
+ * Declaration of a class that attributes heap allocations to accounts, e.g.
+ * to the modules that were executing when the memory was allocated.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+/**
+ * @class AllocationTracker
+ * Every tracked block of memory is preceded by a small header that stores its
+ * size and the account that was active in the allocating thread. Therefore,
+ * freeing the block is charged to the same account, no matter which thread
+ * frees it. The accounts are shared by all processes. Account 0 collects all
+ * allocations that happen outside of any scope. Only the robot replaces the
+ * global operators new and delete and Memory::alignedMalloc by the methods of
+ * this class. On other platforms, all statistics remain 0.
+ */
+class AllocationTracker
+{
+public:
+  static const unsigned maxNumOfAccounts = 512; /**< The maximum number of distinct accounts. */
+
+  /** The statistics of an account. */
+  struct Statistics
+  {
+    size_t liveBytes; /**< The number of bytes currently allocated. */
+    size_t peakBytes; /**< The maximum of liveBytes so far. */
+    unsigned allocations; /**< The number of allocations since the last call of resetAllocations(). */
+  };
+
+  /** While an object of this class exists, the allocations of the current thread are charged to an account. */
+  class Scope
+  {
+  private:
+    const unsigned previous; /**< The account that was active before. */
+
+  public:
+    /**
+     * Constructor.
+     * @param account The account returned by registerAccount().
+     */
+    Scope(unsigned account) : previous(current) {current = account;}
+
+    /** Destructor. Reactivates the previous account. */
+    ~Scope() {current = previous;}
+  };
+
+  /**
+   * Registers an account.
+   * @param name The name of the account. It must remain valid.
+   * @return The index of the account. The same name always gets the same index.
+   */
+  static unsigned registerAccount(const char* name);
+
+  /**
+   * Returns the statistics of an account.
+   * @param account The index of the account.
+   * @return The current statistics.
+   */
+  static Statistics getStatistics(unsigned account);
+
+  /**
+   * Restarts counting the allocations of an account.
+   * @param account The index of the account.
+   */
+  static void resetAllocations(unsigned account);
+
+  /**
+   * Allocates a tracked block of memory.
+   * @param size The size of the block in bytes.
+   * @param alignment The alignment of the block. 0 uses the alignment of malloc.
+   * @return The address of the block or nullptr if there is not enough memory.
+   */
+  static void* allocate(size_t size, size_t alignment = 0);
+
+  /**
+   * Frees a block of memory that was allocated by allocate().
+   * @param ptr The address of the block. nullptr is ignored.
+   */
+  static void free(void* ptr);
+
+private:
+  static thread_local unsigned current; /**< The account that is charged for allocations of this thread. */
+};
@@ -23,6 +23,7 @@
 #define ANNOTATION(name, message) \
   do \
   { \
+    SYNC_WITH(Global::getAnnotationManager()); \
     Global::getAnnotationManager().addAnnotation(); \
     Global::getAnnotationManager().getOut().out.text << name << message; \
     Global::getAnnotationManager().getOut().out.finishMessage(idAnnotation); \
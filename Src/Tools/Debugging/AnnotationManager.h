@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include "Platform/Thread.h"
 #include "Tools/MessageQueue/MessageQueue.h"
 
 #include <vector>
@@ -23,6 +24,8 @@ private:
   AnnotationManager(); // private so only Process can access it.
 
 public:
+  DECLARE_SYNC; /**< Annotations can be added by the worker threads of the ModuleScheduler in parallel. */
+
   void signalProcessStart();
   void clear();
 
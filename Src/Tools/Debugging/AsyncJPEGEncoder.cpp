@@ -0,0 +1,61 @@
+/**
+ * @file AsyncJPEGEncoder.cpp
+ * Implementation of a class that JPEG-compresses images for the debug output
+ * in a background thread.
+ */
+
+#include "AsyncJPEGEncoder.h"
+#include "Platform/BHAssert.h"
+#include "Tools/Debugging/Debugging.h"
+
+AsyncJPEGEncoder::AsyncJPEGEncoder(int priority)
+{
+  thread.setPriority(priority);
+}
+
+AsyncJPEGEncoder::~AsyncJPEGEncoder()
+{
+  if(thread.isRunning())
+  {
+    thread.announceStop();
+    imageAvailable.post();
+    thread.stop();
+  }
+}
+
+void AsyncJPEGEncoder::process(const Image& image)
+{
+  if(!thread.isRunning())
+    thread.start(this, &AsyncJPEGEncoder::encode);
+
+  std::lock_guard<std::mutex> lock(mutex);
+  if(compressedAvailable)
+  {
+    OUTPUT(idJPEGImage, bin, compressed);
+    compressedAvailable = false;
+  }
+
+  if(busy)
+    ++droppedFrames;
+  else
+  {
+    uncompressed = image;
+    busy = true;
+    imageAvailable.post();
+  }
+}
+
+void AsyncJPEGEncoder::encode()
+{
+  Thread::nameThread("JPEGEncoder");
+  while(thread.isRunning())
+    if(imageAvailable.wait() && thread.isRunning())
+    {
+      // Neither busy nor compressed are changed by the other thread while busy is set.
+      compressed = uncompressed;
+
+      std::lock_guard<std::mutex> lock(mutex);
+      busy = false;
+      compressedAvailable = true;
+    }
+}
@@ -0,0 +1,60 @@
+/**
+ * @file AsyncJPEGEncoder.h
+ * Declaration of a class that JPEG-compresses images for the debug output
+ * in a background thread.
+ */
+
+#pragma once
+
+#include "Platform/Semaphore.h"
+#include "Platform/Thread.h"
+#include "Representations/Infrastructure/JPEGImage.h"
+#include <mutex>
+
+/**
+ * The class compresses images in a thread of its own and sends them as
+ * idJPEGImage messages through the debug output of the thread that handed
+ * them over. Sending an image is delayed until the next image is handed over.
+ * If the encoder is still busy when a new image arrives, the new image is dropped
+ * instead of waiting for the encoder.
+ */
+class AsyncJPEGEncoder
+{
+private:
+  Thread thread; /**< The thread that compresses the images. */
+  Semaphore imageAvailable; /**< Signals that an image was handed over. */
+  std::mutex mutex; /**< Protects the state shared with the encoder thread. */
+  Image uncompressed; /**< A copy of the image to compress. */
+  JPEGImage compressed; /**< The image compressed last. */
+  bool busy = false; /**< Does the encoder thread currently compress an image? */
+  bool compressedAvailable = false; /**< Was an image compressed that was not sent yet? */
+  unsigned droppedFrames = 0; /**< The number of images dropped, because the encoder was busy. */
+
+  /** The main function of the encoder thread. */
+  void encode();
+
+public:
+  /**
+   * Constructor.
+   * @param priority The priority of the encoder thread.
+   */
+  AsyncJPEGEncoder(int priority = 0);
+
+  /** Destructor. Stops the encoder thread. */
+  ~AsyncJPEGEncoder();
+
+  /**
+   * Sends the image that was compressed last if it was not sent yet and hands
+   * the given image over to the encoder. The image is copied, so it can be
+   * released afterwards. It is dropped if the encoder is still busy.
+   * This method must be called from the thread the images are sent from.
+   * @param image The image to compress.
+   */
+  void process(const Image& image);
+
+  /**
+   * Returns the number of images that were dropped so far.
+   * @return The number of images not compressed, because the encoder was busy.
+   */
+  unsigned getDroppedFrames() const {return droppedFrames;}
+};
@@ -48,6 +48,10 @@ public:
 
 template<class T> void DebugDataTable::updateObject(const char* name, T& t, bool once)
 {
+  // Usually, nothing is modified. Avoid constructing and hashing a string in that case.
+  if(table.empty())
+    return;
+
   // Find entry in debug data table
   std::unordered_map<std::string, char*>::iterator iter = table.find(name);
   if(iter != table.end())
@@ -138,7 +138,7 @@ inline const char* DrawingManager::getTypeName(char id, char processIdentifier)
  * and executes the following block if the drawing is requested.
  */
 #define DEBUG_DRAWING(id, type) \
-  if(Global::getDrawingManager().addDrawingId(id, type), _debugRequestActive("debug drawing:" id))
+  if(Global::getDrawingManager().addDrawingId(id, type), _debugRequestActive(_DEBUG_REQUEST_ID("debug drawing:" id), "debug drawing:" id))
 
 /**
  * A macro that declares
@@ -50,7 +50,7 @@ class DrawingManager3D : public DrawingManager {};
  * and executes the following block if the drawing is requested.
  */
 #define DEBUG_DRAWING3D(id, type) \
-  if(Global::getDrawingManager3D().addDrawingId(id, type), _debugRequestActive("debug drawing 3d:" id))
+  if(Global::getDrawingManager3D().addDrawingId(id, type), _debugRequestActive(_DEBUG_REQUEST_ID("debug drawing 3d:" id), "debug drawing 3d:" id))
 
 /**
  * A macro that declares.
@@ -8,14 +8,20 @@
  * @author Thomas Röfer
  */
 
+#include <algorithm>
 #include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
 
 #include "DebugRequest.h"
 #include "Platform/BHAssert.h"
 
 DebugRequestTable::DebugRequestTable()
 {
+  stateOfStaticId.fill(unbound);
   enabled.reserve(10000);
+  staticIdOfEntry.reserve(10000);
   fastIndex.reserve(10000);
   slowIndex.reserve(10000);
   polled.reserve(10000);
@@ -34,11 +40,15 @@ void DebugRequestTable::addRequest(const DebugRequest& debugRequest)
   {
     std::unordered_map<std::string, size_t>::const_iterator i = slowIndex.find(debugRequest.name);
     if(i != slowIndex.end())
-      enabled[i->second] = debugRequest.enable ? 1 : 0;
+    {
+      setEnabled(i->second, debugRequest.enable);
+      suspended.erase(std::remove(suspended.begin(), suspended.end(), i->second), suspended.end());
+    }
     else
     {
       slowIndex[debugRequest.name] = enabled.size();
       enabled.push_back(debugRequest.enable ? 1 : 0);
+      staticIdOfEntry.push_back(0);
     }
   }
 }
@@ -54,15 +64,53 @@ bool DebugRequestTable::isActiveSlow(const char* name)
     k = enabled.size();
     slowIndex[name] = k;
     enabled.push_back(0);
+    staticIdOfEntry.push_back(0);
   }
   fastIndex[name] = k;
   return enabled[k] != 0;
 }
 
+bool DebugRequestTable::bindStaticId(unsigned staticId, const char* name)
+{
+  const bool active = isActive(name);
+  if(staticId)
+  {
+    const size_t entry = fastIndex[name];
+    staticIdOfEntry[entry] = staticId;
+    stateOfStaticId[staticId] = active ? enabledRequest : disabledRequest;
+  }
+  return active;
+}
+
+void DebugRequestTable::setEnabled(size_t entry, bool enable)
+{
+  enabled[entry] = enable ? 1 : 0;
+  if(staticIdOfEntry[entry])
+    stateOfStaticId[staticIdOfEntry[entry]] = enable ? enabledRequest : disabledRequest;
+}
+
 void DebugRequestTable::disable(const char* name)
 {
   ASSERT(fastIndex.find(name) != fastIndex.end());
-  enabled[fastIndex[name]] = 0;
+  setEnabled(fastIndex[name], false);
+}
+
+unsigned DebugRequestTable::getStaticId(const char* name)
+{
+  static std::mutex mutex;
+  static std::unordered_map<std::string, unsigned> staticIds;
+  std::lock_guard<std::mutex> lock(mutex);
+  auto i = staticIds.find(name);
+  if(i != staticIds.end())
+    return i->second;
+  else if(staticIds.size() + 1 >= maxNumOfStaticIds)
+    return 0;
+  else
+  {
+    const unsigned staticId = static_cast<unsigned>(staticIds.size()) + 1; // 0 is reserved
+    staticIds[name] = staticId;
+    return staticId;
+  }
 }
 
 bool DebugRequestTable::notYetPolled(const char* name)
@@ -76,11 +124,37 @@ bool DebugRequestTable::notYetPolled(const char* name)
     return false;
 }
 
+void DebugRequestTable::suspendFrameOutput(bool suspend)
+{
+  if(suspend && !pollCounter)
+  {
+    static const char* prefixes[] = {"debug drawing:", "debug drawing 3d:", "debug images:", "plot:", "representation:"};
+    for(const auto& entry : slowIndex)
+      if(enabled[entry.second])
+        for(const char* prefix : prefixes)
+          if(!entry.first.compare(0, strlen(prefix), prefix))
+          {
+            setEnabled(entry.second, false);
+            suspended.push_back(entry.second);
+            break;
+          }
+  }
+  else if(!suspend)
+  {
+    for(size_t i : suspended)
+      setEnabled(i, true);
+    suspended.clear();
+  }
+}
+
 void DebugRequestTable::clear()
 {
+  suspended.clear();
   fastIndex.clear();
   slowIndex.clear();
   enabled.clear();
+  staticIdOfEntry.clear();
+  stateOfStaticId.fill(unbound);
 }
 
 void DebugRequestTable::print(const char* message)
@@ -11,6 +11,7 @@
 #pragma once
 
 #include "Tools/Streams/AutoStreamable.h"
+#include <array>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -37,14 +38,31 @@ inline DebugRequest::DebugRequest(const std::string& name, bool enable)
  *
  * A singleton class that maintains the table of currently active debug requests.
  * It provides a fast access based on character pointers and a slower one based
- * on strings.
+ * on strings. The fastest access is based on static ids. They are assigned to
+ * request names once per program run and are the same in all tables. Each
+ * table stores the state of each static id in a single byte.
  */
 class DebugRequestTable
 {
+public:
+  static const unsigned maxNumOfStaticIds = 16384; /**< The maximum number of static ids. */
+
+private:
+  /** The states of a static id in a table. */
+  enum StaticIdState : char
+  {
+    disabledRequest,
+    enabledRequest,
+    unbound /**< The static id was not used with this table yet. */
+  };
+
   std::vector<char> enabled; /**< Are requests enabled or disabled? */
+  std::array<char, maxNumOfStaticIds> stateOfStaticId; /**< The state of each static id in this table. */
+  std::vector<unsigned> staticIdOfEntry; /**< The static id bound to each entry of vector "enabled" or 0 if there is none. */
   std::unordered_map<const char*, size_t> fastIndex; /**< Maps char pointers to entries of vector "enabled". */
   std::unordered_map<std::string, size_t> slowIndex; /**< Maps strings to entries of vector "enabled". */
   std::unordered_set<const char*> polled; /**< Which requests were already published during this polling phase? */
+  std::vector<size_t> suspended; /**< The entries of "enabled" that are temporarily disabled, because the output of the current frame is dropped. */
 
   /**
    * Default constructor.
@@ -60,6 +78,21 @@ class DebugRequestTable
    */
   bool isActiveSlow(const char* name);
 
+  /**
+   * Binds a static id to the entry of its request in this table.
+   * @param staticId The static id.
+   * @param name The name of the debug request.
+   * @return Is it active?
+   */
+  bool bindStaticId(unsigned staticId, const char* name);
+
+  /**
+   * Enables or disables an entry and the static id bound to it.
+   * @param entry The index of the entry in vector "enabled".
+   * @param enable Enable the entry?
+   */
+  void setEnabled(size_t entry, bool enable);
+
 public:
   int pollCounter = 0; /**< How many frames is polling still active? */
 
@@ -79,6 +112,15 @@ public:
    */
   bool isActive(const char* name);
 
+  /**
+   * Is a debug request active? This is the fastest version, because it only
+   * reads a single byte after the static id was used for the first time.
+   * @param staticId The static id of the request returned by getStaticId().
+   * @param name The name of the request.
+   * @return Is it active?
+   */
+  bool isActive(unsigned staticId, const char* name);
+
   /**
    * Disable a debug request.
    * Note: isActive must have been called before for this request.
@@ -86,6 +128,32 @@ public:
    */
   void disable(const char* name);
 
+  /**
+   * Returns the static id of a debug request, which is the same in all tables.
+   * It is meant to be called once per request name and the result is stored,
+   * e.g. in a static variable.
+   * @param name The name of the request.
+   * @return The static id. 0 if there are too many ids. In that case, the
+   *         requests are looked up by their names.
+   */
+  static unsigned getStaticId(const char* name);
+
+  /**
+   * Temporarily disables all active requests that produce output belonging to
+   * a single frame, i.e. drawings, debug images, plots, and representations,
+   * or enables them again. This drops the output of a frame if its receiver
+   * has not taken the output of the previous frames yet. Nothing is disabled
+   * while requests are polled.
+   * @param suspend Disable the requests? Otherwise, the requests disabled before are enabled again.
+   */
+  void suspendFrameOutput(bool suspend);
+
+  /**
+   * Is the output of the current frame dropped?
+   * @return Were any requests disabled by suspendFrameOutput()?
+   */
+  bool isFrameOutputSuspended() const {return !suspended.empty();}
+
   /**
    * Has this request still to be published during this polling phase?
    * This also marks the request as polled.
@@ -113,3 +181,9 @@ inline bool DebugRequestTable::isActive(const char* name)
   std::unordered_map<const char*, size_t>::const_iterator i = fastIndex.find(name);
   return i != fastIndex.end() ? enabled[i->second] != 0 : isActiveSlow(name);
 }
+
+inline bool DebugRequestTable::isActive(unsigned staticId, const char* name)
+{
+  const char state = stateOfStaticId[staticId];
+  return state == unbound ? bindStaticId(staticId, name) : state != disabledRequest;
+}
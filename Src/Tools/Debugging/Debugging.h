@@ -48,6 +48,7 @@
 #define DEBUG_RESPONSE_ONCE(id) if(false)
 #define DEBUG_RESPONSE_NOT(id) if(true)
 #define DECLARE_DEBUG_RESPONSE(id) ((void) 0)
+#define _DEBUG_REQUEST_ID(id) 0u
 #define OUTPUT(type, format, expression) ((void) 0)
 #define OUTPUT_TEXT(expression) ((void) 0)
 #else
@@ -135,6 +136,26 @@ inline bool _debugRequestActive(const char* id)
   return Global::getDebugRequestTable().isActive(id);
 }
 
+/**
+ * Register debug request if required and check whether it is active.
+ * @param staticId The static id of the debug request.
+ * @param id The name of the debug request.
+ * @return Is it active?
+ */
+inline bool _debugRequestActive(unsigned staticId, const char* id)
+{
+  if(Global::getDebugRequestTable().pollCounter && Global::getDebugRequestTable().notYetPolled(id))
+    OUTPUT(idDebugResponse, text, id << Global::getDebugRequestTable().isActive(staticId, id));
+  return Global::getDebugRequestTable().isActive(staticId, id);
+}
+
+/**
+ * Determines the static id of a debug request once per call site.
+ * @param id The name of the debug request. It must be a string constant.
+ */
+#define _DEBUG_REQUEST_ID(id) \
+  ([] {static const unsigned _staticId = DebugRequestTable::getStaticId(id); return _staticId;}())
+
 /**
  * Declares a debugging switch. This is only necessary in case, where the actual switch
  * is not always reached in each execution cycle.
@@ -151,26 +172,26 @@ inline bool _debugRequestActive(const char* id)
  * @param id The id of the debugging switch
  */
 #define DEBUG_RESPONSE(id) \
-  if(_debugRequestActive(id))
+  if(_debugRequestActive(_DEBUG_REQUEST_ID(id), id))
 
 /**
  * A debugging switch, allowing the non-recurring execution of the following block.
  * @param id The id of the debugging switch
  */
 #define DEBUG_RESPONSE_ONCE(id) \
-  if(_debugRequestActive(id) && (Global::getDebugRequestTable().disable(id), true))
+  if(_debugRequestActive(_DEBUG_REQUEST_ID(id), id) && (Global::getDebugRequestTable().disable(id), true))
 
 /**
  * A debugging switch, allowing the enabling or disabling of the block that follows.
  * @param id The id of the debugging switch
  */
 #define DEBUG_RESPONSE_NOT(id) \
-  if(!_debugRequestActive(id))
+  if(!_debugRequestActive(_DEBUG_REQUEST_ID(id), id))
 
 /**
  * Execute following block if debug request is active.
  * The request is not pollable.
  */
 #define DECLARED_DEBUG_RESPONSE(id) \
-  if(Global::getDebugRequestTable().isActive(id))
+  if(Global::getDebugRequestTable().isActive(_DEBUG_REQUEST_ID(id), id))
 #endif // TARGET_TOOL
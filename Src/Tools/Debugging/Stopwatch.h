@@ -13,17 +13,39 @@
 #include "TimingManager.h"
 #include "Debugging.h"
 #include "Tools/Module/Blackboard.h"
+#include "Platform/Time.h"
 
 /**
  * Helper function to declare a plot as a single statement.
+ * @param staticId The static id of the debug request of the plot.
  * @param id The id of the plot.
  * @param value The time to plot in ms.
  */
-inline void _plot(const char* id, unsigned time)
+inline void _plot(unsigned staticId, const char* id, unsigned time)
 {
-  DEBUG_RESPONSE(id) OUTPUT(idPlot, bin, (id + 5) << static_cast<float>(time) * 0.001f);
+#if !defined TARGET_TOOL && (!defined TARGET_ROBOT || !defined NDEBUG)
+  if(_debugRequestActive(staticId, id))
+    OUTPUT(idPlot, bin, (id + 5) << static_cast<float>(time) * 0.001f);
+#endif
 }
 
+/** The state of a single run of a cycle stopwatch. */
+struct _CycleStopwatch
+{
+  const unsigned index; /**< The index of the cycle stopwatch. */
+  const unsigned long long start; /**< The counter when the run started. */
+  bool running = true; /**< Is the measured block still running? */
+
+  _CycleStopwatch(unsigned index) : index(index), start(Time::getCycleCounter()) {}
+
+  /** Ends the run and adds its duration to the cycle stopwatch. */
+  void stop()
+  {
+    Global::getTimingManager().addCycles(index, Time::getCycleCounter() - start);
+    running = false;
+  }
+};
+
 /**
  * Allows the measurement the execution time of the following block.
  * @param eventID The id of the stop watch.
@@ -36,4 +58,17 @@ inline void _plot(const char* id, unsigned time)
  * @param eventID The id of the stop watch.
  */
 #define STOPWATCH_WITH_PLOT(eventID) \
-  for(bool _start = true; (_start ? Global::getTimingManager().startTiming(eventID) : _plot("plot:stopwatch:" eventID, Global::getTimingManager().stopTiming(eventID))), _start; _start ^= true)
+  for(bool _start = true; (_start ? Global::getTimingManager().startTiming(eventID) : _plot(_DEBUG_REQUEST_ID("plot:stopwatch:" eventID), "plot:stopwatch:" eventID, Global::getTimingManager().stopTiming(eventID))), _start; _start ^= true)
+
+/**
+ * Allows the measurement the execution time of the following block with the
+ * time stamp counter. The stopwatch registers itself when it is executed for
+ * the first time. Afterwards, a measurement only reads the counter twice and
+ * adds the difference to a dense array, so it can also be used inside inner
+ * loops. All runs in a frame are summed up. The stopwatch does not appear in
+ * traces and it measures wall clock time rather than thread time.
+ * @param eventID The id of the stop watch. It must not be used by STOPWATCH.
+ */
+#define CYCLE_STOPWATCH(eventID) \
+  for(_CycleStopwatch _cycleStopwatch([] {static const unsigned index = TimingManager::registerCycleStopwatch(eventID); return index;}()); \
+      _cycleStopwatch.running; _cycleStopwatch.stop())
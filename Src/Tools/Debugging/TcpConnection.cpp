@@ -60,6 +60,61 @@ bool TcpConnection::sendAndReceive(const unsigned char* dataToSend, int sendSize
   return false;
 }
 
+bool TcpConnection::sendAndReceiveNonBlocking(const unsigned char* dataToSend, int sendSize,
+                                              unsigned char*& dataRead, int& readSize)
+{
+  ASSERT(tcpComm);
+  bool connectedBefore = isConnected();
+  readSize = receive(dataRead);
+
+  if(handshake == sender && !packageOffset &&
+     ((readSize > 0 && !sendSize) || (!connectedBefore && isConnected())))
+    sendHeartbeat(); // a heartbeat must not interrupt a package
+
+  if(packageOffset && !isConnected())
+  {
+    packageOffset = 0;
+    return true; // The rest of the package cannot be sent anymore
+  }
+
+  if((handshake != receiver || ack || packageOffset) &&
+     isConnected() && sendSize > 0)
+  {
+    int sent = 0;
+    if(packageOffset < static_cast<int>(sizeof(sendSize))) // sends size of block
+      sent = tcpComm->sendSome(reinterpret_cast<const unsigned char*>(&sendSize) + packageOffset,
+                               static_cast<int>(sizeof(sendSize)) - packageOffset);
+    if(sent >= 0)
+    {
+      packageOffset += sent;
+      if(packageOffset >= static_cast<int>(sizeof(sendSize))) // sends data
+      {
+        const int offset = packageOffset - static_cast<int>(sizeof(sendSize));
+        sent = tcpComm->sendSome(dataToSend + offset, sendSize - offset);
+        if(sent >= 0)
+        {
+          packageOffset += sent;
+          if(packageOffset == sendSize + static_cast<int>(sizeof(sendSize)))
+          {
+            packageOffset = 0;
+            ack = false;
+            return true;
+          }
+          return false;
+        }
+      }
+      else
+        return false;
+    }
+
+    // The connection was lost
+    packageOffset = 0;
+    if(connectedBefore)
+      return true; // We cannot reconnect, so we fake success to prevent this packet from being sent again
+  }
+  return false;
+}
+
 bool TcpConnection::sendHeartbeat()
 {
   ASSERT(tcpComm);
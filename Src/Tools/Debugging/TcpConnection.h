@@ -32,6 +32,7 @@ private:
   bool ack = false;
   bool client = false;;
   Handshake handshake = noHandshake; /**< The handshake mode. */
+  int packageOffset = 0; /**< The number of bytes of the current package already sent by sendAndReceiveNonBlocking(), including its size. */
 
 public:
   TcpConnection() = default;
@@ -83,6 +84,23 @@ public:
    */
   bool sendAndReceive(const unsigned char* dataToSend, int sendSize, unsigned char*& dataRead, int& readSize);
 
+  /**
+   * The function sends and receives data, but it never waits until the network
+   * can take outgoing data. Instead, a package is transmitted in parts by
+   * successive calls. The parameters are the same as for sendAndReceive().
+   * @param dataToSend The data to be send. It must remain the same until the
+   *                   function returned true.
+   * @return Returns true if the data has been sent completely.
+   */
+  bool sendAndReceiveNonBlocking(const unsigned char* dataToSend, int sendSize, unsigned char*& dataRead, int& readSize);
+
+  /**
+   * The function states whether a new package could be sent now, i.e. the
+   * communication partner acknowledged the previous one if this is required.
+   * @return Can a new package be sent?
+   */
+  bool canSend() const {return (handshake != receiver || ack) && isConnected();}
+
   /**
    * The function states whether the connection is still established.
    * @return Does the connection still exist?
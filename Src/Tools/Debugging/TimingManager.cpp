@@ -6,17 +6,80 @@
  */
 
 #include "TimingManager.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 #include "Platform/BHAssert.h"
 #include "Platform/Time.h"
 #include "Debugging.h"
 #include "Tools/MessageQueue/MessageQueue.h"
+#include "Tools/Streams/OutStreams.h"
 
 using namespace std;
 
+/** The number of events kept in the trace. */
+static const size_t traceSize = 16384;
+
+/** A small number identifying the calling thread in traces. */
+static unsigned getThreadId()
+{
+  static atomic<unsigned> numOfThreads(0);
+  thread_local unsigned threadId = ++numOfThreads;
+  return threadId;
+}
+
+/** The wall clock time in microseconds used for traces. */
+static long long getTraceTime()
+{
+  return chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/** The names of all cycle stopwatches. Their indices are shared by all processes. */
+static const char* cycleStopwatchNames[TimingManager::maxNumOfCycleStopwatches];
+
+/** The number of cycle stopwatches registered. */
+static atomic<unsigned> numOfCycleStopwatches(0);
+
+/** Protects the registration of cycle stopwatches. */
+static mutex cycleStopwatchMutex;
+
+/**
+ * Determines how often the counter returned by Time::getCycleCounter() is
+ * incremented per microsecond. This is only measured once, which takes 10 ms.
+ * @return The number of counts per microsecond.
+ */
+static double getCyclesPerMicrosecond()
+{
+  static const double cyclesPerMicrosecond = []
+  {
+    const chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    const unsigned long long startCycles = Time::getCycleCounter();
+    chrono::steady_clock::time_point now;
+    do
+      now = chrono::steady_clock::now();
+    while(now - start < chrono::milliseconds(10));
+    const unsigned long long cycles = Time::getCycleCounter() - startCycles;
+    return static_cast<double>(cycles) / static_cast<double>(chrono::duration_cast<chrono::microseconds>(now - start).count());
+  }();
+  return cyclesPerMicrosecond;
+}
+
 struct TimingManager::Pimpl
 {
+  /** An entry of the trace. */
+  struct Event
+  {
+    const char* name; /**< The name of the stopwatch or event. */
+    unsigned threadId; /**< The thread that executed it. */
+    long long begin; /**< When the event began (in microseconds). */
+    long long end; /**< When the event ended (in microseconds). */
+  };
+
   /**
    * NOTE: the hashmaps only work because the compiler uses a string table and
    *       allocates only one address for all const string literals with the same value.
@@ -37,11 +100,39 @@ struct TimingManager::Pimpl
   bool processRunning = false; /**< Is a process iteration running right now? */
   bool dataPrepared = false; /**< True if data hs already been prepared this frame */
   int watchNameIndex = 0; /**< Every frame a few watch names are transmitted. This is the index of the watchname that is to be transmitted next */
+  std::mutex mutex; /**< Stopwatches can be used by the worker threads of the ModuleScheduler in parallel. */
+  unordered_map<const char*, long long> eventBegins; /**< Key: name of a running event. Value: its begin time. */
+  vector<Event> trace; /**< The ring buffer of the most recent events. */
+  size_t traceIndex = 0; /**< The index in trace where the next event is stored. */
+  array<atomic<unsigned long long>, maxNumOfCycleStopwatches> cycles; /**< The cycles accumulated by each cycle stopwatch in the current frame. */
+  double cyclesPerMicrosecond; /**< The calibration of the cycle counter. */
+
+  /**
+   * Adds an event to the trace. The mutex must be locked.
+   * @param name The name of the event.
+   * @param end When the event ended.
+   */
+  void addEvent(const char* name, long long end)
+  {
+    const auto begin = eventBegins.find(name);
+    if(begin == eventBegins.end())
+      return;
+    Event& event = trace[traceIndex % traceSize];
+    event.name = name;
+    event.threadId = getThreadId();
+    event.begin = begin->second;
+    event.end = end;
+    ++traceIndex;
+  }
 };
 
 TimingManager::TimingManager() : prvt(new TimingManager::Pimpl)
 {
   prvt->data.setSize(500000);
+  prvt->trace.resize(traceSize);
+  for(atomic<unsigned long long>& cycles : prvt->cycles)
+    cycles = 0;
+  prvt->cyclesPerMicrosecond = getCyclesPerMicrosecond();
 }
 
 TimingManager::~TimingManager()
@@ -49,9 +140,30 @@ TimingManager::~TimingManager()
   delete prvt;
 }
 
+unsigned TimingManager::registerCycleStopwatch(const char* identifier)
+{
+  std::lock_guard<std::mutex> lock(cycleStopwatchMutex);
+  const unsigned numOfNames = numOfCycleStopwatches;
+  for(unsigned i = 0; i < numOfNames; ++i)
+    if(!strcmp(cycleStopwatchNames[i], identifier))
+      return i;
+  ASSERT(numOfNames < maxNumOfCycleStopwatches);
+  cycleStopwatchNames[numOfNames] = identifier;
+  numOfCycleStopwatches = numOfNames + 1;
+  return numOfNames;
+}
+
+void TimingManager::addCycles(unsigned index, unsigned long long cycles)
+{
+  prvt->cycles[index].fetch_add(cycles, memory_order_relaxed);
+}
+
 void TimingManager::startTiming(const char* identifier)
 {
   unsigned long long startTime = Time::getCurrentThreadTime();
+  const long long traceTime = getTraceTime();
+  std::lock_guard<std::mutex> lock(prvt->mutex);
+  prvt->eventBegins[identifier] = traceTime;
   if(prvt->timing.find(identifier) == prvt->timing.end())
   {
     //create new entry
@@ -65,11 +177,50 @@ void TimingManager::startTiming(const char* identifier)
 unsigned TimingManager::stopTiming(const char* identifier)
 {
   const unsigned long long stopTime = Time::getCurrentThreadTime();
+  const long long traceTime = getTraceTime();
+  std::lock_guard<std::mutex> lock(prvt->mutex);
+  prvt->addEvent(identifier, traceTime);
   const unsigned diff = unsigned(stopTime - prvt->timing[identifier]);
   prvt->timing[identifier] = diff;
   return diff;
 }
 
+void TimingManager::beginEvent(const char* identifier)
+{
+  const long long traceTime = getTraceTime();
+  std::lock_guard<std::mutex> lock(prvt->mutex);
+  prvt->eventBegins[identifier] = traceTime;
+}
+
+void TimingManager::endEvent(const char* identifier)
+{
+  const long long traceTime = getTraceTime();
+  std::lock_guard<std::mutex> lock(prvt->mutex);
+  prvt->addEvent(identifier, traceTime);
+}
+
+bool TimingManager::saveTrace(const std::string& fileName) const
+{
+  OutTextRawFile stream(fileName);
+  if(!stream.exists())
+    return false;
+
+  std::lock_guard<std::mutex> lock(prvt->mutex);
+  const size_t first = prvt->traceIndex > traceSize ? prvt->traceIndex - traceSize : 0;
+  long long start = getTraceTime();
+  for(size_t i = first; i < prvt->traceIndex; ++i)
+    start = std::min(start, prvt->trace[i % traceSize].begin);
+  stream << "{\"traceEvents\":[";
+  for(size_t i = first; i < prvt->traceIndex; ++i)
+  {
+    const Pimpl::Event& event = prvt->trace[i % traceSize];
+    stream << (i == first ? "\n" : ",\n") << "{\"name\":\"" << event.name << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << event.threadId
+           << ",\"ts\":" << static_cast<unsigned>(event.begin - start) << ",\"dur\":" << static_cast<unsigned>(event.end - event.begin) << "}";
+  }
+  stream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+  return true;
+}
+
 void TimingManager::signalProcessStart()
 {
   prvt->currentProcessStartTime = Time::getCurrentSystemTime();
@@ -113,6 +264,23 @@ void TimingManager::prepareData()
    */
   OutBinaryMessage& out = prvt->data.out.bin;
 
+  // cycle stopwatches that ran in this frame are reported as normal stopwatches
+  const unsigned numOfCycleNames = numOfCycleStopwatches;
+  for(unsigned i = 0; i < numOfCycleNames; ++i)
+  {
+    const unsigned long long cycles = prvt->cycles[i].exchange(0, memory_order_relaxed);
+    if(cycles)
+    {
+      const char* watchName = cycleStopwatchNames[i];
+      if(prvt->timing.find(watchName) == prvt->timing.end())
+      {
+        prvt->watchNames.push_back(watchName);
+        prvt->idTable[watchName] = (unsigned short)prvt->idTable.size();
+      }
+      prvt->timing[watchName] = static_cast<unsigned long long>(static_cast<double>(cycles) / prvt->cyclesPerMicrosecond);
+    }
+  }
+
   // every frame we send 3 watch names
   out << (unsigned short)3; //number of names to follow
   for(int i = 0; i < 3; ++i, prvt->watchNameIndex = (prvt->watchNameIndex + 1) % prvt->watchNames.size())
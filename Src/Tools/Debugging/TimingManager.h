@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <string>
+
 class Process;
 class MessageQueue;
 
@@ -15,6 +17,11 @@ class MessageQueue;
  * It always belongs to exactly one process and should only be created/destroyed
  * by that process.
  * There should be exactly one TimingManager per process.
+ * In addition, the begin and end times of the most recent stopwatch runs and
+ * other events are kept in a ring buffer that can be saved as a trace.
+ * Cycle stopwatches are a cheaper alternative for blocks that are executed
+ * very often. They are identified by dense indices and accumulate the
+ * time stamp counter differences of all their runs in a frame.
  */
 class TimingManager
 {
@@ -27,12 +34,49 @@ private:
   ~TimingManager();
 
 public:
+  static const unsigned maxNumOfCycleStopwatches = 256; /**< The maximum number of distinct cycle stopwatches. */
+
+  /**
+   * Registers the name of a cycle stopwatch. The registry is shared by all processes.
+   * @param identifier The name of the stopwatch. It must not be used by a normal stopwatch.
+   * @return The index of the stopwatch. The same name always gets the same index.
+   */
+  static unsigned registerCycleStopwatch(const char* identifier);
+
+  /**
+   * Adds the duration of a run to a cycle stopwatch. This can be called
+   * by several threads of the same process in parallel.
+   * @param index The index returned by registerCycleStopwatch().
+   * @param cycles The difference between two values returned by Time::getCycleCounter().
+   */
+  void addCycles(unsigned index, unsigned long long cycles);
+
   /** Start the stopwatch for the specified identifier. */
   void startTiming(const char* identifier);
 
   /** Stops the stopwatch for the specified identifier and returns the time in us. */
   unsigned stopTiming(const char* identifier);
 
+  /**
+   * Records the begin of an event in the trace without using a stopwatch.
+   * @param identifier The name of the event. As for stopwatches, the address is used as key.
+   */
+  void beginEvent(const char* identifier);
+
+  /**
+   * Records the end of an event in the trace.
+   * @param identifier The name of the event passed to beginEvent().
+   */
+  void endEvent(const char* identifier);
+
+  /**
+   * Saves the events in the ring buffer in the Chrome trace event format,
+   * which can be viewed with chrome://tracing or the Perfetto UI.
+   * @param fileName The name of the file relative to the configuration directory.
+   * @return Could the file be written?
+   */
+  bool saveTrace(const std::string& fileName) const;
+
   /**
    * The TimingManager has a special stopwatch that is used to keep track
    * of the overall process time.
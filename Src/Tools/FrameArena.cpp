@@ -0,0 +1,86 @@
+/**
+ * @file Tools/FrameArena.cpp
+ * Implementation of an arena for temporary data of providers.
+ */
+
+#include "FrameArena.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+/** The size of the first chunk of each arena in bytes. */
+static const std::size_t initialChunkSize = 64 * 1024;
+
+namespace
+{
+  /** The arena of a single thread. */
+  struct Arena
+  {
+    std::vector<std::pair<char*, std::size_t>> chunks; /**< The start address and the size of all chunks in the order of use. */
+    char* top = nullptr; /**< The next free byte in the current chunk. */
+    char* end = nullptr; /**< The end of the current chunk. */
+
+    ~Arena()
+    {
+      for(const auto& chunk : chunks)
+        std::free(chunk.first);
+    }
+
+    /**
+     * Adds a new chunk at the end and continues allocating from it.
+     * @param size The minimum size of the chunk.
+     */
+    void addChunk(std::size_t size)
+    {
+      if(!chunks.empty() && chunks.back().second * 2 > size)
+        size = chunks.back().second * 2;
+      char* memory = static_cast<char*>(std::malloc(size));
+      if(!memory)
+        throw std::bad_alloc();
+      chunks.emplace_back(memory, size);
+      top = memory;
+      end = memory + size;
+    }
+  };
+
+  thread_local Arena arena;
+}
+
+void* FrameArena::allocate(std::size_t size, std::size_t alignment)
+{
+  char* ptr = reinterpret_cast<char*>((reinterpret_cast<std::uintptr_t>(arena.top) + alignment - 1) & ~(alignment - 1));
+  if(!arena.top || ptr + size > arena.end)
+  {
+    arena.addChunk(std::max(size + alignment, initialChunkSize));
+    ptr = reinterpret_cast<char*>((reinterpret_cast<std::uintptr_t>(arena.top) + alignment - 1) & ~(alignment - 1));
+  }
+  arena.top = ptr + size;
+  return ptr;
+}
+
+void FrameArena::deallocate(void* ptr, std::size_t size)
+{
+  if(static_cast<char*>(ptr) + size == arena.top)
+    arena.top = static_cast<char*>(ptr);
+}
+
+void FrameArena::reset()
+{
+  if(arena.chunks.size() > 1)
+  {
+    std::size_t size = 0;
+    for(const auto& chunk : arena.chunks)
+    {
+      size += chunk.second;
+      std::free(chunk.first);
+    }
+    arena.chunks.clear();
+    arena.addChunk(size);
+  }
+  else if(!arena.chunks.empty())
+  {
+    arena.top = arena.chunks.front().first;
+    arena.end = arena.top + arena.chunks.front().second;
+  }
+}
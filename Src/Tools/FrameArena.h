@@ -0,0 +1,68 @@
+/**
+ * @file Tools/FrameArena.h
+ * Declaration of an arena for temporary data of providers and of a vector
+ * type that uses it.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * Each thread has its own arena, from which memory is taken by simply moving
+ * a pointer forward. The module manager resets the arena of a thread before
+ * it executes a provider in that thread, i.e. all memory taken from the arena
+ * becomes invalid when the provider returns. Freeing memory only returns it
+ * to the arena if it was the most recent block allocated. If a frame needs
+ * more than the arena has, another chunk is added. When the arena is reset,
+ * all chunks are merged into a single one, so after a few frames, using the
+ * arena does not allocate heap memory anymore.
+ */
+class FrameArena
+{
+public:
+  /**
+   * Allocates memory in the arena of the calling thread.
+   * @param size The number of bytes required.
+   * @param alignment The alignment of the memory. Must be a power of 2.
+   * @return The address of the memory.
+   */
+  static void* allocate(std::size_t size, std::size_t alignment);
+
+  /**
+   * Returns memory to the arena of the calling thread if it was the last
+   * block allocated. Otherwise, the memory is only recycled by the next reset.
+   * @param ptr The address of the memory.
+   * @param size The number of bytes that were requested.
+   */
+  static void deallocate(void* ptr, std::size_t size);
+
+  /** Invalidates all memory allocated from the arena of the calling thread. */
+  static void reset();
+};
+
+/**
+ * An allocator for containers that only exist while a provider is executed.
+ * @tparam T The type of the elements allocated.
+ */
+template<typename T> class FrameAllocator
+{
+public:
+  using value_type = T;
+
+  FrameAllocator() = default;
+  template<typename U> FrameAllocator(const FrameAllocator<U>&) {}
+
+  T* allocate(std::size_t n) {return static_cast<T*>(FrameArena::allocate(n * sizeof(T), alignof(T)));}
+  void deallocate(T* ptr, std::size_t n) {FrameArena::deallocate(ptr, n * sizeof(T));}
+
+  template<typename U> bool operator==(const FrameAllocator<U>&) const {return true;}
+  template<typename U> bool operator!=(const FrameAllocator<U>&) const {return false;}
+};
+
+/**
+ * A vector for temporary data within an update method. It must neither be
+ * stored beyond the end of the update method nor be passed to another thread.
+ */
+template<typename T> using FrameVector = std::vector<T, FrameAllocator<T>>;
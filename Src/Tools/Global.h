@@ -112,4 +112,5 @@ public:
   friend class ConsoleRoboCupCtrl; // The class ConsoleRoboCupCtrl can set theStreamHandler.
   friend class RobotConsole; // The class RobotConsole can set theDebugOut.
   friend class Framework;
+  friend class ModuleScheduler; // The class ModuleScheduler passes these pointers to its worker threads.
 };
@@ -53,6 +53,24 @@ template<bool avx> ALWAYSINLINE bool simdAligned(const void* x) { return avx ? a
   template<int imm> static ALWAYSINLINE __m256i name (const __m256i a, const __m256i b){return name256 (a, b, imm);}
 #endif
 
+/**
+ * Checks at runtime whether the CPU executing this code supports the widest
+ * instruction set this translation unit was compiled for, i.e. AVX2 if
+ * _supportsAVX2 is set and SSSE3 otherwise. Code that is executed on
+ * machines other than the one it was built on should fall back to a scalar
+ * implementation if this returns false.
+ * @return Can the SIMD code paths be executed?
+ */
+inline bool simdSupported()
+{
+#ifdef _MSC_VER
+  return true;
+#else
+  static const bool supported = _supportsAVX2 ? __builtin_cpu_supports("avx2") != 0 : __builtin_cpu_supports("ssse3") != 0;
+  return supported;
+#endif
+}
+
 ALWAYSINLINE __m128i _mm_slli_epi8(const __m128i& a, int imm)
 {
   return _mm_and_si128(_mm_slli_epi16(a, imm), _mm_set1_epi8(static_cast<unsigned char>(0xFF << imm)));
@@ -7,62 +7,48 @@ void LutRasterizer::create(const TriangleMesh& object, const Eigen::AlignedBox3d
 {
   setObject(object);
   allocateLut(viewpointRange, spacing);
-  for(int idx = 0; idx < (int) vertexList.size(); idx++)
-    computeVertexList(vertexList[idx], object, viewpointOfIndex(idx));
+  computeLut(nullptr);
 }
 
 void LutRasterizer::loadOrCreate(const TriangleMesh& object, const Eigen::AlignedBox3d& viewpointRange, double spacing, const char* filename)
 {
   setObject(object);
   allocateLut(viewpointRange, spacing);
-  if(!loadVertexList(filename))
-  {
-    for(int idx = 0; idx < (int) vertexList.size(); idx++)
-      computeVertexList(vertexList[idx], object, viewpointOfIndex(idx));
-    if(filename != nullptr)
-      saveVertexList(filename);
-  }
+  if(filename == nullptr || !lut.load(filename, LUTVERSION, computeHash()))
+    computeLut(filename);
 }
 
-bool LutRasterizer::loadVertexList(const char* filename)
+uint64_t LutRasterizer::computeHash() const
 {
-  FILE* f = fopen(filename, "rb");
-  if(f == nullptr)
-    return false;
-  for(int idx = 0; idx < (int) vertexList.size(); idx++)
-  {
-    int ctr;
-    fread(&ctr, sizeof(ctr), 1, f);
-    vertexList[idx].resize(ctr);
-    if(ctr > 0)
-      fread(&vertexList[idx][0], sizeof(vertexList[idx][0]), ctr, f);
-    if(feof(f) || ferror(f))
-    {
-      vertexList.clear();
-      fclose(f);
-      return false;
-    }
-  }
-  char x;
-  if(fread(&x, sizeof(x), 1, f) != 0)
-  {
-    vertexList.clear();
-    return false; // file should have an end
-  }
-  fclose(f);
-  return true;
+  PrecomputedTable::Hash hash;
+  hash << object.vertex << object.face << object.isRotationalSymmetricZ << object.isRotationalSymmetric
+       << viewpointRange.min() << viewpointRange.max() << spacing << vertexListSize;
+  return hash;
 }
 
-void LutRasterizer::saveVertexList(const char* filename) const
+void LutRasterizer::computeLut(const char* filename)
 {
-  FILE* f = fopen(filename, "wb");
-  for(int idx = 0; idx < (int) vertexList.size(); idx++)
+  const int n = numOfViewpoints();
+  vector<VertexList> vertexLists(n);
+  size_t numOfIndices = 0;
+  for(int idx = 0; idx < n; idx++)
+  {
+    computeVertexList(vertexLists[idx], object, viewpointOfIndex(idx));
+    numOfIndices += vertexLists[idx].size();
+  }
+
+  vector<char> table((n + 1) * sizeof(unsigned) + numOfIndices);
+  unsigned* offsets = reinterpret_cast<unsigned*>(table.data());
+  unsigned char* indices = reinterpret_cast<unsigned char*>(offsets + n + 1);
+  unsigned offset = 0;
+  for(int idx = 0; idx < n; idx++)
   {
-    int ctr = static_cast<int>(vertexList[idx].size());
-    fwrite(&ctr, sizeof(ctr), 1, f);
-    fwrite(&vertexList[idx][0], sizeof(vertexList[idx][0]), ctr, f);
+    offsets[idx] = offset;
+    for(unsigned char vIdx : vertexLists[idx])
+      indices[offset++] = vIdx;
   }
-  fclose(f);
+  offsets[n] = offset;
+  lut.set(std::move(table), filename ? filename : "", LUTVERSION, computeHash());
 }
 
 void LutRasterizer::allocateLut(const Eigen::AlignedBox3d& viewpointRange, double spacing)
@@ -94,7 +80,6 @@ void LutRasterizer::allocateLut(const Eigen::AlignedBox3d& viewpointRange, doubl
     basePoint[i] = min(point0X[i], point1X[i]);
     vertexListSize[i] = (int) ceil(fabs(point1X[i] - point0X[i]) / spacing - eps + 1);
   }
-  vertexList.resize(vertexListSize[0]*vertexListSize[1]*vertexListSize[2]);
 }
 
 void LutRasterizer::countVertices(vector<int>& counter, const TriangleMesh::EdgeList& el)
@@ -207,7 +192,7 @@ void LutRasterizer::setObject(const TriangleMesh& object)
 {
   assert(object.vertex.size() <= NEWSTART); // We only have 8 bit for vertex indices
   this->object = object;
-  vertexList.clear();
+  lut = PrecomputedTable();
   vertexWith1.resize(object.vertex.size());
   for(int i = 0; i < (int) vertexWith1.size(); i++)
   {
@@ -305,13 +290,13 @@ void LutRasterizer::rasterize(CodedContour& contour, const Eigen::Isometry3d& ob
     return;
 
   // Project all points and store the edges midpoints as CodedContourPoint
-  const VertexList& vl = vertexList[idx];
+  const unsigned char* vlEnd = vertexListBegin(idx + 1);
   alignas(16) float p[4]; // First and second point (x,y) of the current edge
   bool isNewEdge = true;
   int clippedCtr = 0;
-  for(int i = 0; i < (int) vl.size(); i++)
+  for(const unsigned char* vl = vertexListBegin(idx); vl < vlEnd; ++vl)
   {
-    int vIdx = vl[i];
+    int vIdx = *vl;
     if(vIdx != NEWSTART)
     {
       shift4Floats(p);
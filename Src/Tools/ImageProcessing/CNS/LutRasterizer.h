@@ -3,6 +3,7 @@
 #include "TriangleMesh.h"
 #include "CameraModelOpenCV.h"
 #include "CodedContour.h"
+#include "Tools/PrecomputedTable.h"
 #include <Eigen/StdVector>
 
 //! Algorithms and precomputed data-structures to perform ShapeCNSDetector::rasterize efficiently
@@ -49,14 +50,19 @@ public:
 
   enum {NEWSTART = 0xff};
 
-  //! Look-up-table storing the contour of \c object from different viewpoints as \c VertexList objects
-  /*! edgelist[indexOfViewPoint(v)] is the contour of \c object viewed from \c v as a list of vertex
-      indidces.
+  //! The version of the layout of \c lut. Increment it when the layout or \c computeVertexList changes.
+  enum {LUTVERSION = 1};
+
+  //! Look-up-table storing the contour of \c object from different viewpoints as vertex lists
+  /*! The vertex list of \c indexOfViewPoint(v) is the contour of \c object viewed from \c v as a list of vertex
+      indidces (see \c vertexListBegin).
 
       Technically, the array is a regular \c spacing grid of points with dimensions \c edgeListSize[0]*
-      \c edgeListSize[1] * \c edgeListSize[2] in X, Y, Z.
+      \c edgeListSize[1] * \c edgeListSize[2] in X, Y, Z. The table consists of \c numOfViewpoints()+1
+      offsets (\c unsigned) into the vertex indices (\c unsigned \c char) that follow them. If the table was
+      loaded, it is memory-mapped and shared with other processes.
    */
-  std::vector<VertexList> vertexList;
+  PrecomputedTable lut;
 
   //! See \c indexOfViewPoint
   int vertexListSize[3];
@@ -67,7 +73,7 @@ public:
   //! See \c indexOfViewPoint
   double spacing;
 
-  //! The range of viewpoints covered by the LUT \c vertexList
+  //! The range of viewpoints covered by the LUT \c lut
   /*! This is the parameter passed to \c create, so viewpoints inside this box
       are tabulated, the actually tabulated area may be larger due to effects of
       rotational normalization and rounding to \c spacing.
@@ -89,7 +95,8 @@ public:
   void create(const TriangleMesh& object, const Eigen::AlignedBox3d& viewpointRange, double spacing);
 
   //! Same as \c create but tries to load and saves the look-up-table in \c filename
-  /*! Note: At the moment the user has to take care to delete \c filename the parameters have been changed.
+  /*! The file is memory-mapped. It is only used if it was generated from the same parameters
+      (see \c computeHash), otherwise it is recomputed and replaced.
       If \c filename is \c nullptr, the table is neither loaded nor saved.
    */
   void loadOrCreate(const TriangleMesh& object, const Eigen::AlignedBox3d& viewpointRange, double spacing, const char* filename = nullptr);
@@ -103,7 +110,7 @@ public:
    */
   void rasterize(CodedContour& contour, const Eigen::Isometry3d& object2World, const CameraModelOpenCV& camera) const;
 
-  //! Returns the viewpoint from which \c vertexList[idx] is computed.
+  //! Returns the viewpoint from which vertex list \c idx in \c lut is computed.
   Eigen::Vector3d viewpointOfIndex(int idx) const
   {
     return basePoint + spacing * Eigen::Vector3d(
@@ -142,7 +149,7 @@ public:
     viewpointInObject = object2Camera.inverse().translation();
   }
 
-  //! Computes the index in \c vertexList corresponding to the viewpoint closest to \c viewpoint
+  //! Computes the index in \c lut corresponding to the viewpoint closest to \c viewpoint
   /*! If \c viewpoint is outside the volume (here cube) of tabulated viewpoints,
       -1 is returned.
    */
@@ -197,7 +204,7 @@ public:
   //! Takes a list of vertices defining an edge list and converts it back to an edge list
   static void convertVertexListToEdgeList(TriangleMesh::EdgeList& edgeList, LutRasterizer::VertexList& vertexList);
 
-  //! Allocates \c vertexList for a ranges of discretized vertex coordinates (see \c computeLut)
+  //! Sets the dimensions of \c lut for a ranges of discretized vertex coordinates (see \c computeLut)
   /*! \c object must already been set.*/
   void allocateLut(const Eigen::AlignedBox3d& viewpointRange, double spacing);
 
@@ -221,20 +228,27 @@ public:
                          float P0[4], float P1[4], float P2[4], float clipRange[4],
                          const Eigen::Isometry3d& object2World, const CameraModelOpenCV& camera) const;
 
-  //! Tries to load \c vertexList from \c filename
-  /*! \c vertexList must already be allocated and all parameter set. If loading fails, \c false is returned.
-   */
-  bool loadVertexList(const char* filename);
+  //! Returns the number of viewpoints tabulated in \c lut
+  int numOfViewpoints() const {return vertexListSize[0] * vertexListSize[1] * vertexListSize[2];}
+
+  //! Returns the start of the vertex list of viewpoint \c idx in \c lut
+  /*! The list ends at \c vertexListBegin(idx + 1). \c idx may be \c numOfViewpoints(). */
+  const unsigned char* vertexListBegin(int idx) const
+  {
+    const unsigned* offsets = reinterpret_cast<const unsigned*>(lut.getData());
+    return reinterpret_cast<const unsigned char*>(offsets + numOfViewpoints() + 1) + offsets[idx];
+  }
+
+  //! Computes a hash of all parameters \c lut is generated from
+  /*! \c object must already be set and \c allocateLut called. */
+  uint64_t computeHash() const;
 
-  //! Save \c vertexList such that it can be loaded by \c loadVertexList and \c loadOrCreate.
-  void saveVertexList(const char* filename) const;
+  //! Computes \c lut for the current parameters and saves it to \c filename unless it is \c nullptr
+  void computeLut(const char* filename);
 
   //! Returns the memory consumption of \c this
   int memory() const
   {
-    int mem = static_cast<int>(sizeof(*this) + vertexList.capacity() * sizeof(vertexList.front()) + object.memory());
-    for(size_t i = 0; i < vertexList.size(); i++)
-      mem += static_cast<int>(vertexList[i].capacity() * sizeof(vertexList[i].front()));
-    return mem;
+    return static_cast<int>(sizeof(*this) + lut.getSize() + object.memory());
   }
 };
@@ -66,10 +66,7 @@ void ObjectCNSStereoDetector::search(IsometryWithResponses& object2WorldList,
     object2WorldList.insert(object2WorldList.end(), oldObject2WorldList.begin(), oldObject2WorldList.end());
 
   // Refinement
-  // TODO: Eliminate duplicates
-  if(spec.nRefineIterations > 0)
-    for(int i = 0; i < (int) object2WorldList.size(); i++)
-      refine(cns, object2WorldList[i], spec.nRefineIterations);
+  refineAll(cns, object2WorldList);
   if(!spec.refineExisting)
     object2WorldList.insert(object2WorldList.end(), oldObject2WorldList.begin(), oldObject2WorldList.end());
   sort(object2WorldList.begin(), object2WorldList.end(), MoreOnResponse());
@@ -427,6 +424,36 @@ void ObjectCNSStereoDetector::refine(const CNSImage& cns, IsometryWithResponse&
   }
 }
 
+void ObjectCNSStereoDetector::refineAll(const CNSImage& cns, IsometryWithResponses& object2WorldList) const
+{
+  sort(object2WorldList.begin(), object2WorldList.end(), MoreOnResponse());
+
+  if(spec.minDistanceBetweenObjects > 0)
+  {
+    const double minSqrDistance = spec.minDistanceBetweenObjects * spec.minDistanceBetweenObjects;
+    size_t kept = 0;
+    for(size_t i = 0; i < object2WorldList.size(); ++i)
+    {
+      bool duplicate = false;
+      for(size_t j = 0; j < kept && !duplicate; ++j)
+        duplicate = (object2WorldList[i].translation() - object2WorldList[j].translation()).squaredNorm() < minSqrDistance;
+      if(!duplicate)
+        object2WorldList[kept++] = object2WorldList[i];
+    }
+    object2WorldList.resize(kept);
+  }
+
+  if(spec.nRefinedObjects >= 0 && static_cast<int>(object2WorldList.size()) > spec.nRefinedObjects)
+    object2WorldList.resize(spec.nRefinedObjects);
+
+  if(spec.nRefineIterations > 0)
+  {
+    for(IsometryWithResponse& object2World : object2WorldList)
+      refine(cns, object2World, spec.nRefineIterations);
+    sort(object2WorldList.begin(), object2WorldList.end(), MoreOnResponse());
+  }
+}
+
 void ObjectCNSStereoDetector::rasteredConeOfOrientations(std::vector<Eigen::Isometry3d>& a2bList, const Eigen::Vector3d& az2b0, double delta, double eps)
 {
   Eigen::Isometry3d a2b0 = fromTo(Eigen::Vector3d::UnitZ(), az2b0);
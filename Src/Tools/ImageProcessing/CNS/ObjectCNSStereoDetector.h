@@ -311,6 +311,15 @@ public:
    */
   void refine(const CNSImage& cns, IsometryWithResponse& object2World, int iterationCtr = 1) const;
 
+  //! Refines a whole batch of candidates, e.g. the results of several \c searchBlockAllPoses
+  /*! The candidates are sorted by their response. Candidates that are closer than
+      \c spec.minDistanceBetweenObjects to a better one are removed, because they
+      would converge to the same pose anyway. Only the \c spec.nRefinedObjects best
+      remaining candidates are kept and refined with \c spec.nRefineIterations.
+      The result is sorted by the refined responses.
+   */
+  void refineAll(const CNSImage& cns, IsometryWithResponses& object2WorldList) const;
+
   //! Finds the maximum of \c response with sub-pixel interpolation
   /*! The maximum is response[argMax[2]][argMax[1]][argMax[0]]. If the discrete maximum is
       in the interior of the array, it is subpixel-refined with fractional
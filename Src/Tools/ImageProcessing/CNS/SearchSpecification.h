@@ -37,6 +37,13 @@ public:
   //! If \c true, object frames passed to search are additionally refined
   bool refineExisting = true;
 
+  //! How many of the best candidates are refined (all if negative)
+  int nRefinedObjects = -1;
+
+  //! Candidates closer than this to a better one are dropped before refinement (none if 0)
+  /*! Given in the units of the object's translation. */
+  double minDistanceBetweenObjects = 0;
+
   //! A block of \c blockX*blockY pixel is search with the same rasterized shape
   /*! Must be a multiple of 16 for technical reasons. */
   int blockX = 64;
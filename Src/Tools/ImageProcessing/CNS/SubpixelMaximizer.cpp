@@ -38,8 +38,8 @@ SubpixelMaximizer::FitMatrix::FitMatrix()
 
 void SubpixelMaximizer::fitUsingSSE3(float coef[FitMatrix::ROWS], const signed short data[3][3][3]) const
 {
-  assert(FitMatrix::PADDEDCOLS == 32);
-  __m128 localFitMatrixScale = _mm_set_ss(fitMatrix.scale);
+  assert(FitMatrix::ROWS == 10 && FitMatrix::PADDEDCOLS == 32);
+  __m128 localFitMatrixScale = _mm_set1_ps(fitMatrix.scale);
   const short* localFitMatrix = fitMatrix();
   // Load data into four SSE Registers
   __m128i x[4];
@@ -50,18 +50,26 @@ void SubpixelMaximizer::fitUsingSSE3(float coef[FitMatrix::ROWS], const signed s
   x[3] = _mm_loadu_si128((__m128i*)(dataFlat + 24));
   x[3] = _mm_srli_si128(_mm_slli_si128(x[3], 10), 10);   // Clear dataFlat[27..31]
 
+  // Compute the scalar products between ((float*)x)[0..31] and the rows of localFitMatrix,
+  // each still distributed over four 32 bit lanes
+  __m128i sum[FitMatrix::ROWS];
   for(int i = 0; i < FitMatrix::ROWS; i++)
   {
-    // Compute scalar product between ((float*)x)[0..31] and localFitMatrix
-    __m128i sum =             _mm_madd_epi16(x[0], *(__m128i*)(localFitMatrix + 0));
-    sum = _mm_add_epi32(sum, _mm_madd_epi16(x[1], *(__m128i*)(localFitMatrix + 8)));
-    sum = _mm_add_epi32(sum, _mm_madd_epi16(x[2], *(__m128i*)(localFitMatrix + 16)));
-    sum = _mm_add_epi32(sum, _mm_madd_epi16(x[3], *(__m128i*)(localFitMatrix + 24)));
-    sum = _mm_hadd_epi32(sum, sum);
-    sum = _mm_hadd_epi32(sum, sum);
-    _mm_store_ss(coef + i, _mm_mul_ss(_mm_cvtepi32_ps(sum), localFitMatrixScale));
+    sum[i] =                    _mm_madd_epi16(x[0], *(__m128i*)(localFitMatrix + 0));
+    sum[i] = _mm_add_epi32(sum[i], _mm_madd_epi16(x[1], *(__m128i*)(localFitMatrix + 8)));
+    sum[i] = _mm_add_epi32(sum[i], _mm_madd_epi16(x[2], *(__m128i*)(localFitMatrix + 16)));
+    sum[i] = _mm_add_epi32(sum[i], _mm_madd_epi16(x[3], *(__m128i*)(localFitMatrix + 24)));
     localFitMatrix += 32;
   }
+
+  // Reduce four rows at once, afterwards lane k holds the complete sum of row i + k
+  for(int i = 0; i < 8; i += 4)
+  {
+    __m128i total = _mm_hadd_epi32(_mm_hadd_epi32(sum[i], sum[i + 1]), _mm_hadd_epi32(sum[i + 2], sum[i + 3]));
+    _mm_storeu_ps(coef + i, _mm_mul_ps(_mm_cvtepi32_ps(total), localFitMatrixScale));
+  }
+  __m128i total = _mm_hadd_epi32(_mm_hadd_epi32(sum[8], sum[9]), _mm_setzero_si128());
+  _mm_storel_pi((__m64*)(coef + 8), _mm_mul_ps(_mm_cvtepi32_ps(total), localFitMatrixScale));
 }
 
 void SubpixelMaximizer::fitUsingC(float coef[10], const signed short data[3][3][3]) const
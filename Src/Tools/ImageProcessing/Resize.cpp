@@ -218,7 +218,7 @@ namespace Resize
     ASSERT(width % scaleFactor == 0);
     ASSERT(height % scaleFactor == 0);
 
-    if(width % 16 == 0)
+    if(width % 16 == 0 && simdSupported())
     {
       if(_supportsAVX2 && width % 32 == 0)
       {
@@ -933,7 +933,7 @@ namespace Resize
     ASSERT(width % (scaleFactor >> 1) == 0);
     ASSERT(height % scaleFactor == 0);
 
-    if(width % 16 == 0)
+    if(width % 16 == 0 && simdSupported())
     {
       if(_supportsAVX2 && width / (scaleFactor >> 1) % 32 == 0)
       {
@@ -972,6 +972,37 @@ namespace Resize
         }
       }
     }
+
+    // Color channels have half the horizontal resolution of the luminance.
+    const int horizontalFactor = scaleFactor >> 1;
+    const int averagedPixels = horizontalFactor * scaleFactor;
+
+    destImage.setResolution(width / horizontalFactor, srcImage.height >> downScalesExponent);
+
+    unsigned int* summs = new unsigned int[destImage.width];
+    memset(summs, 0, destImage.width * sizeof(unsigned int));
+
+    TImage<unsigned char>::PixelType* pDest = nullptr;
+    for(int y = 0; y < srcImage.height; ++y)
+    {
+      if(y % scaleFactor == 0)
+        pDest = destImage[y / scaleFactor];
+      const unsigned char* pSrc = srcImage[y];
+      unsigned int* pSumms = summs;
+      for(int x = 0; x < width; x += horizontalFactor, ++pSumms)
+        for(int i = 0; i < horizontalFactor; ++i, ++pSrc)
+          *pSumms += *pSrc;
+
+      if(y % scaleFactor == scaleFactor - 1)
+      {
+        pSumms = summs;
+        for(int i = 0; i < destImage.width; ++i, ++pSumms, ++pDest)
+          *pDest = static_cast<unsigned char>(*pSumms / averagedPixels);
+        memset(summs, 0, destImage.width * sizeof(unsigned int));
+      }
+    }
+
+    delete[] summs;
   }
 
   template<bool avx> void shrinkColorChannel16x16SSE(const TImage<unsigned char>& srcImage, TImage<unsigned char>& destImage)
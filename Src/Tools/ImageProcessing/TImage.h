@@ -88,7 +88,7 @@ TImage<Pixel>::TImage(const TImage& other) :
   width(other.width), height(other.height)
 {
   int padding = static_cast<int>(reinterpret_cast<const char*>(other.image) - reinterpret_cast<const char*>(other.imagePadding));
-  imagePadding = Memory::alignedMalloc(maxWidth * maxHeight * sizeof(Pixel) + (padding * 2), 16);
+  imagePadding = Memory::alignedMalloc(maxWidth * maxHeight * sizeof(Pixel) + (padding * 2), 32);
   image = reinterpret_cast<Pixel*>(reinterpret_cast<char*>(imagePadding) + padding);
   memcpy(image, other.image, width * height * sizeof(Pixel));
 }
@@ -106,7 +106,7 @@ TImage<Pixel>& TImage<Pixel>::operator=(const TImage& other)
          >= reinterpret_cast<const char*>(other.image) - reinterpret_cast<const char*>(other.imagePadding));
   width = other.width;
   height = other.height;
-  memcpy(image, other.image, maxWidth * maxHeight * sizeof(Pixel));
+  memcpy(image, other.image, width * height * sizeof(Pixel));
   return *this;
 }
 
@@ -14,6 +14,9 @@
 #include "PixelTypes.h"
 #include "YHSColorConversion.h"
 
+#include <algorithm>
+#include <cmath>
+
 namespace YHS2s
 {
 #define PREFETCH
@@ -66,17 +69,17 @@ namespace YHS2s
   template<bool aligned, bool avx, bool classifyAllColors, bool saveGrayscaled, bool saveColorchanneled, bool saveSaturation, bool saveHue>
   void classifyByYHS2FieldColorSSE(const YUYVPixel* const srcImage, const int srcWidth, const int srcHeight, const FieldColors& theFieldColors,
                                    TImage<PixelTypes::GrayscaledPixel>& grayscaled, TImage<PixelTypes::GrayscaledPixel>& ued, TImage<PixelTypes::GrayscaledPixel>& ved,
-                                   TImage<ColoredPixel>& colored, TImage<HuePixel>& hued, TImage<PixelTypes::GrayscaledPixel>& saturated)
+                                   TImage<ColoredPixel>& colored, TImage<HuePixel>& hued, TImage<PixelTypes::GrayscaledPixel>& saturated, const int firstRow)
   {
     ASSERT(srcWidth % 32 == 0);
 
-    __m_auto_i* grayscaledDest = reinterpret_cast<__m_auto_i*>(grayscaled[0]) - 1;
-    __m_auto_i* uedDest0 = reinterpret_cast<__m_auto_i*>(ued[0]) - 1;
-    __m_auto_i* vedDest1 = reinterpret_cast<__m_auto_i*>(ved[0]) - 1;
-    __m_auto_i* coloredDest = reinterpret_cast<__m_auto_i*>(colored[0]) - 1;
-    __m_auto_i* saturatedDest = reinterpret_cast<__m_auto_i*>(saturated[0]) - 1;
-    __m_auto_i* huedDest = reinterpret_cast<__m_auto_i*>(hued[0]) - 1;
-    const __m_auto_i* const imageEnd = reinterpret_cast<const __m_auto_i*>(srcImage + srcWidth * srcHeight) - 1;
+    __m_auto_i* grayscaledDest = reinterpret_cast<__m_auto_i*>(grayscaled[firstRow]) - 1;
+    __m_auto_i* uedDest0 = reinterpret_cast<__m_auto_i*>(ued[firstRow]) - 1;
+    __m_auto_i* vedDest1 = reinterpret_cast<__m_auto_i*>(ved[firstRow]) - 1;
+    __m_auto_i* coloredDest = reinterpret_cast<__m_auto_i*>(colored[firstRow]) - 1;
+    __m_auto_i* saturatedDest = reinterpret_cast<__m_auto_i*>(saturated[firstRow]) - 1;
+    __m_auto_i* huedDest = reinterpret_cast<__m_auto_i*>(hued[firstRow]) - 1;
+    const __m_auto_i* const imageEnd = reinterpret_cast<const __m_auto_i*>(srcImage + srcWidth * (firstRow + srcHeight)) - 1;
 
     const __m_auto_i fieldHFrom = _mmauto_set1_epi8(theFieldColors.fieldHue.min);
     const __m_auto_i fieldHTo = _mmauto_set1_epi8(theFieldColors.fieldHue.max);
@@ -96,12 +99,12 @@ namespace YHS2s
     static const __m_auto_i channelMask = _mmauto_set1_epi16(0x00FF);
 
 #ifdef PREFETCH
-    const char* prefetchSrc = reinterpret_cast<const char*>(srcImage) + (avx ? 128 : 64);
-    const char* prefetchGrayscaledDest = reinterpret_cast<const char*>(grayscaled[0]) + (avx ? 64 : 32);
-    const char* prefetchColoredDest = reinterpret_cast<const char*>(colored[0]) - (avx ? 64 : 32);
+    const char* prefetchSrc = reinterpret_cast<const char*>(srcImage + srcWidth * firstRow) + (avx ? 128 : 64);
+    const char* prefetchGrayscaledDest = reinterpret_cast<const char*>(grayscaled[firstRow]) + (avx ? 64 : 32);
+    const char* prefetchColoredDest = reinterpret_cast<const char*>(colored[firstRow]) - (avx ? 64 : 32);
 #endif // PREFETCH
 
-    const __m_auto_i* src = reinterpret_cast<__m_auto_i const*>(srcImage) - 1;
+    const __m_auto_i* src = reinterpret_cast<__m_auto_i const*>(srcImage + srcWidth * firstRow) - 1;
     while(src < imageEnd)
     {
       const __m_auto_i p0 = _mmauto_loadt_si_all<aligned>(++src);
@@ -205,14 +208,83 @@ namespace YHS2s
     }
   }
 
+  /**
+   * Scalar reference implementation of classifyByYHS2FieldColorSSE. It computes the
+   * saturation exactly instead of using the reciprocal approximations of the
+   * SIMD version, so both can differ slightly for some pixels.
+   * It is used if the CPU does not support the instruction set the SIMD version
+   * was compiled for.
+   * Both implementations convert srcHeight rows starting with the row firstRow.
+   */
+  template<bool classifyAllColors, bool saveGrayscaled, bool saveColorchanneled, bool saveSaturation, bool saveHue>
+  void updateScalar(const YUYVPixel* const src, const int srcWidth, const int srcHeight, const FieldColors& theFieldColors,
+                    TImage<PixelTypes::GrayscaledPixel>& grayscaled, TImage<PixelTypes::GrayscaledPixel>& ued, TImage<PixelTypes::GrayscaledPixel>& ved,
+                    TImage<ColoredPixel>& colored, TImage<HuePixel>& hued, TImage<PixelTypes::GrayscaledPixel>& saturated, const int firstRow = 0)
+  {
+    PixelTypes::GrayscaledPixel* grayscaledDest = grayscaled[firstRow];
+    PixelTypes::GrayscaledPixel* uedDest = ued[firstRow];
+    PixelTypes::GrayscaledPixel* vedDest = ved[firstRow];
+    ColoredPixel* coloredDest = colored[firstRow];
+    HuePixel* huedDest = hued[firstRow];
+    PixelTypes::GrayscaledPixel* saturatedDest = saturated[firstRow];
+
+    const YUYVPixel* const srcEnd = src + srcWidth * (firstRow + srcHeight);
+    for(const YUYVPixel* pixel = src + srcWidth * firstRow; pixel < srcEnd; ++pixel)
+    {
+      const int uC = pixel->u - 128;
+      const int vC = pixel->v - 128;
+      const float normUV = std::sqrt(static_cast<float>((uC * uC + vC * vC) * 2));
+      const unsigned char hue = YHSColorConversion::computeHue(pixel->u, pixel->v);
+
+      if(saveColorchanneled)
+      {
+        *uedDest++ = static_cast<unsigned char>(uC);
+        *vedDest++ = static_cast<unsigned char>(vC);
+      }
+
+      const bool isHueField = theFieldColors.fieldHue.min <= hue && hue <= theFieldColors.fieldHue.max;
+      for(size_t i = 0; i < 2; ++i)
+      {
+        const unsigned char y = pixel->y(i);
+        const unsigned char sat = y == 0 ? 0 : static_cast<unsigned char>(std::min(255, static_cast<int>(normUV * 256.f / y + 0.5f)));
+
+        if(saveGrayscaled)
+          *grayscaledDest++ = y;
+        if(saveSaturation)
+          *saturatedDest++ = sat;
+        if(saveHue)
+          *huedDest++ = hue;
+
+        FieldColors::Color color;
+        if(sat >= theFieldColors.maxNonColorSaturation)
+        {
+          color = isHueField ? FieldColors::field : FieldColors::none;
+          if(classifyAllColors && color == FieldColors::none)
+            for(int j = 0; j < FieldColors::numOfColors - FieldColors::numOfNonColors; ++j)
+            {
+              const Rangeuc& range = theFieldColors.colorHues[j];
+              if((range.min <= hue && hue <= range.max) || (range.max <= hue && hue <= range.min))
+              {
+                color = static_cast<FieldColors::Color>(FieldColors::numOfNonColors + j);
+                break;
+              }
+            }
+        }
+        else
+          color = y >= theFieldColors.blackWhiteDelimiter ? FieldColors::white : FieldColors::black;
+        *coloredDest++ = color;
+      }
+    }
+  }
+
   template<bool classifyAllColors, bool saveGrayscaled, bool saveColorchanneled, bool saveSaturation,  bool saveHue>
   void updateSSE(const YUYVPixel* const src, const int srcWidth, const int srcHeight, const FieldColors& theFieldColors,
                  TImage<PixelTypes::GrayscaledPixel>& grayscaled, TImage<PixelTypes::GrayscaledPixel>& ued, TImage<PixelTypes::GrayscaledPixel>& ved,
-                 TImage<ColoredPixel>& colored, TImage<HuePixel>& hued, TImage<PixelTypes::GrayscaledPixel>& saturated)
+                 TImage<ColoredPixel>& colored, TImage<HuePixel>& hued, TImage<PixelTypes::GrayscaledPixel>& saturated, const int firstRow = 0)
   {
     if(simdAligned<_supportsAVX2>(src))
-      classifyByYHS2FieldColorSSE<true, _supportsAVX2, classifyAllColors, saveGrayscaled, saveColorchanneled, saveSaturation, saveHue>(src, srcWidth, srcHeight, theFieldColors, grayscaled, ued, ved, colored, hued, saturated);
+      classifyByYHS2FieldColorSSE<true, _supportsAVX2, classifyAllColors, saveGrayscaled, saveColorchanneled, saveSaturation, saveHue>(src, srcWidth, srcHeight, theFieldColors, grayscaled, ued, ved, colored, hued, saturated, firstRow);
     else
-      classifyByYHS2FieldColorSSE<false, _supportsAVX2, classifyAllColors, saveGrayscaled, saveColorchanneled, saveSaturation, saveHue>(src, srcWidth, srcHeight, theFieldColors, grayscaled, ued, ved, colored, hued, saturated);
+      classifyByYHS2FieldColorSSE<false, _supportsAVX2, classifyAllColors, saveGrayscaled, saveColorchanneled, saveSaturation, saveHue>(src, srcWidth, srcHeight, theFieldColors, grayscaled, ued, ved, colored, hued, saturated, firstRow);
   }
 }
@@ -0,0 +1,88 @@
+/**
+ * @file DeltaCoding.cpp
+ * The file implements functions that exploit the redundancy between the
+ * messages in a streamed message queue before it is compressed.
+ */
+
+#include "DeltaCoding.h"
+#include <vector>
+
+namespace DeltaCoding
+{
+  static const size_t queueHeaderSize = 2 * sizeof(unsigned); /**< The size of the header of a streamed queue. */
+  static const size_t messageHeaderSize = 4; /**< The size of the header of each message. */
+
+  /** A message and the one it is encoded relative to. */
+  struct Message
+  {
+    size_t offset; /**< The offset of the message data in the stream. */
+    size_t size; /**< The size of the message data. */
+    int reference; /**< The index of the previous message with the same id and size or -1 if there is none. */
+  };
+
+  /**
+   * Find all messages in a streamed message queue and their references.
+   * @param data The streamed message queue.
+   * @param size The size of the streamed message queue in bytes.
+   * @return The messages in the sequence they were stored.
+   */
+  static std::vector<Message> findMessages(const char* data, size_t size)
+  {
+    std::vector<Message> messages;
+    int last[256];
+    for(int& l : last)
+      l = -1;
+
+    if(size >= queueHeaderSize)
+      for(size_t offset = queueHeaderSize; offset + messageHeaderSize <= size;)
+      {
+        const unsigned char id = static_cast<unsigned char>(data[offset]);
+        const size_t messageSize = static_cast<unsigned char>(data[offset + 1])
+                                   | static_cast<unsigned char>(data[offset + 2]) << 8
+                                   | static_cast<unsigned char>(data[offset + 3]) << 16;
+        offset += messageHeaderSize;
+        if(offset + messageSize > size)
+          break;
+
+        int reference = last[id];
+        if(reference != -1 && messages[reference].size != messageSize)
+          reference = -1;
+        last[id] = static_cast<int>(messages.size());
+        messages.push_back({offset, messageSize, reference});
+        offset += messageSize;
+      }
+    return messages;
+  }
+
+  /**
+   * Combine a message with another one by a bitwise exclusive or.
+   * @param data The streamed message queue.
+   * @param message The message that is changed.
+   * @param reference The message that is combined with the first one.
+   */
+  static void combine(char* data, const Message& message, const Message& reference)
+  {
+    char* p = data + message.offset;
+    const char* q = data + reference.offset;
+    for(char* pEnd = p + message.size; p < pEnd; ++p, ++q)
+      *p ^= *q;
+  }
+
+  void encode(char* data, size_t size)
+  {
+    // Backwards, so that each reference is still unchanged when it is used.
+    const std::vector<Message> messages = findMessages(data, size);
+    for(auto m = messages.rbegin(); m != messages.rend(); ++m)
+      if(m->reference != -1)
+        combine(data, *m, messages[m->reference]);
+  }
+
+  void decode(char* data, size_t size)
+  {
+    // Forwards, so that each reference is already restored when it is used.
+    const std::vector<Message> messages = findMessages(data, size);
+    for(const Message& m : messages)
+      if(m.reference != -1)
+        combine(data, m, messages[m.reference]);
+  }
+}
@@ -0,0 +1,32 @@
+/**
+ * @file DeltaCoding.h
+ * The file declares functions that exploit the redundancy between the
+ * messages in a streamed message queue before it is compressed. Each message
+ * is replaced by the bitwise exclusive or with the previous message that has
+ * the same id and the same size. Since most representations change only
+ * slightly from frame to frame, the result mainly consists of zeros.
+ *
+ * The functions work on the format returned by MessageQueue::getStreamedData():
+ * | used size | number of messages | ID (1 byte) | Message size (3 byte) | Message | ... |
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace DeltaCoding
+{
+  /**
+   * Encode the messages of a streamed message queue in place.
+   * @param data The streamed message queue.
+   * @param size The size of the streamed message queue in bytes.
+   */
+  void encode(char* data, size_t size);
+
+  /**
+   * Decode the messages of a streamed message queue in place.
+   * @param data The streamed message queue that was encoded with encode().
+   * @param size The size of the streamed message queue in bytes.
+   */
+  void decode(char* data, size_t size);
+}
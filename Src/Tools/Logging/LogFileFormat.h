@@ -17,5 +17,7 @@ namespace Logging
     logFileCompressed,
     logFileMessageIDs,
     logFileStreamSpecification,
+    logFileIndexed,
+    logFileIndexedDeltaEncoded,
   });
 }
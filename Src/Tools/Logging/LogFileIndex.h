@@ -0,0 +1,55 @@
+/**
+ * @file LogFileIndex.h
+ * The file declares the index that is stored at the end of log files in the
+ * format Logging::logFileIndexed. It allows to locate frames and images without
+ * decompressing the blocks before them.
+ *
+ * File layout after the magic byte logFileIndexed:
+ * | size of compressed block | compressed block | ... | 0 | LogFileIndex | size of streamed LogFileIndex |
+ * All sizes are unsigned (4 bytes). The blocks are the same as in logFileCompressed.
+ */
+
+#pragma once
+
+#include "Tools/Streams/AutoStreamable.h"
+
+STREAMABLE(LogFileIndex,
+{
+  /** Information about a single compressed block. */
+  STREAMABLE(Block,
+  {,
+    (unsigned)(0) size, /**< The size of the compressed block in bytes without its size field. */
+    (unsigned)(0) firstFrame, /**< The number of the first frame in this block. */
+    (unsigned)(0) numOfFrames, /**< The number of frames in this block. */
+    (unsigned)(0) firstTimeStamp, /**< The system time when the first frame was logged. */
+    (unsigned)(0) lastTimeStamp, /**< The system time when the last frame was logged. */
+    (std::vector<unsigned char>) messageIDs, /**< The ids of all representations logged in this block. They are numbered as in the message id table of the log file. */
+  });
+
+  /**
+   * Find the block that contains a certain frame.
+   * @param frame The number of the frame.
+   * @return The index of the block or -1 if the frame is not part of the log.
+   */
+  int getBlock(unsigned frame) const,
+
+  (std::vector<Block>) blocks, /**< All blocks in the sequence in which they are stored. */
+  (std::vector<unsigned>) imageFrames, /**< The numbers of all frames that contain an image in ascending order. */
+});
+
+inline int LogFileIndex::getBlock(unsigned frame) const
+{
+  int first = 0;
+  int last = static_cast<int>(blocks.size()) - 1;
+  while(first <= last)
+  {
+    const int middle = (first + last) / 2;
+    if(frame < blocks[middle].firstFrame)
+      last = middle - 1;
+    else if(frame >= blocks[middle].firstFrame + blocks[middle].numOfFrames)
+      first = middle + 1;
+    else
+      return middle;
+  }
+  return -1;
+}
@@ -9,8 +9,10 @@
 
 #include "Tools/Debugging/Stopwatch.h"
 #include "Logger.h"
+#include "DeltaCoding.h"
 #include "LogFileFormat.h"
 #include "Platform/Time.h"
+#include "Representations/Infrastructure/LowFrameRateImage.h"
 #include "Representations/Infrastructure/TeamInfo.h"
 #include "Tools/Settings.h"
 #include "Tools/Debugging/AnnotationManager.h"
@@ -18,6 +20,7 @@
 #include "Tools/Streams/StreamHandler.h"
 
 #include <snappy-c.h>
+#include <algorithm>
 
 Logger::Logger(LoggedProcess loggedProcess) : loggedProcess(loggedProcess)
 {
@@ -47,6 +50,9 @@ Logger::Logger(LoggedProcess loggedProcess) : loggedProcess(loggedProcess)
       buffer.push_back(new MessageQueue());
       buffer.back()->setSize(parameters.blockSize);
     }
+    compressedBuffer.resize(parameters.maxBufferSize);
+    compressed.resize(parameters.maxBufferSize, false);
+    blockInfos.resize(parameters.maxBufferSize);
     writerThread.setPriority(parameters.writePriority);
   }
 }
@@ -54,7 +60,9 @@ Logger::Logger(LoggedProcess loggedProcess) : loggedProcess(loggedProcess)
 Logger::~Logger()
 {
   if(frameCounter)
-    framesToWrite.post();
+    blocksToCompress.post();
+  compressing = false;
+  compressionThreads.clear(); // Thread's destructor waits for termination
   writerThread.stop();
   for(MessageQueue* m : buffer)
     delete m;
@@ -87,6 +95,9 @@ void Logger::execute()
           FAIL(name << "Logger: " << representation << " is not available in blackboard.");
         }
 
+      // Images are streamed last, so that a full block drops them rather than the other representations.
+      std::stable_partition(loggables.begin(), loggables.end(), [](const Loggable& loggable) {return !loggable.isImage;});
+
       blackboardVersion = Blackboard::getInstance().getVersion();
     }
 
@@ -130,22 +141,55 @@ void Logger::logFrame()
   {
     // Buffer is full, can't do anything this frame
     OUTPUT_WARNING(name << "Logger: Writer thread too slow, discarding frame.");
+    ++discardedFrames;
     return;
   }
 
   OutMessage& out = buffer[writeIndex]->out;
+  BlockInfo& blockInfo = blockInfos[writeIndex];
+  const unsigned now = Time::getCurrentSystemTime();
+  if(frameCounter == 0)
+  {
+    blockInfo.block = LogFileIndex::Block();
+    blockInfo.block.firstFrame = loggedFrames;
+    blockInfo.block.firstTimeStamp = now;
+    blockInfo.imageFrames.clear();
+  }
 
   out.bin << (loggedProcess == LoggedProcess::cognition ? 'c' : 'm');
   out.finishMessage(idProcessBegin);
 
+  // Images are skipped while the buffer is getting full, because they would take the space of the representations.
+  const int usedBlocks = (parameters.maxBufferSize + writeIndex - readIndex) % parameters.maxBufferSize;
+  const bool logImages = usedBlocks * 100 <= (100 - parameters.minFreeBufferForImages) * parameters.maxBufferSize;
+
   // Stream all representations to the queue
   STOPWATCH("Logger")
   {
     for(const Loggable& loggable : loggables)
     {
+      if(loggable.isImage && !logImages)
+      {
+        ++discardedImages;
+        continue;
+      }
       out.bin << *loggable.representation;
       if(!out.finishMessage(loggable.id))
         OUTPUT_WARNING("Logging of " << ::getName(loggable.id) << " failed. The buffer is full.");
+      else
+      {
+        std::vector<unsigned char>& messageIDs = blockInfo.block.messageIDs;
+        if(std::find(messageIDs.begin(), messageIDs.end(), static_cast<unsigned char>(loggable.id)) == messageIDs.end())
+          messageIDs.push_back(static_cast<unsigned char>(loggable.id));
+        if((loggable.id == idImage
+            || loggable.id == idJPEGImage
+            || loggable.id == idThumbnail
+            || loggable.id == idImagePatches
+            || (loggable.id == idLowFrameRateImage
+                && static_cast<const LowFrameRateImage*>(loggable.representation)->imageUpdated))
+           && (blockInfo.imageFrames.empty() || blockInfo.imageFrames.back() != loggedFrames))
+          blockInfo.imageFrames.push_back(loggedFrames);
+      }
     }
 
     // Append annotations
@@ -161,6 +205,9 @@ void Logger::logFrame()
 
   out.bin << (loggedProcess == LoggedProcess::cognition ? 'c' : 'm');
   out.finishMessage(idProcessFinished);
+  ++blockInfo.block.numOfFrames;
+  blockInfo.block.lastTimeStamp = now;
+  ++loggedFrames;
 
   // Cognition runs at 60 fps. Therefore use a new block every 60 frames.
   // Thus one block is used per second.
@@ -168,74 +215,149 @@ void Logger::logFrame()
   {
     // The next call to logFrame will use a new block.
     writeIndex = (writeIndex + 1) % parameters.maxBufferSize;
-    framesToWrite.post(); // Signal to the writer thread that another block is ready
+    blocksToCompress.post(); // Signal to the compression threads that another block is ready
     if(parameters.debugStatistics)
+    {
+      std::lock_guard<std::mutex> lock(pipelineMutex);
       OUTPUT_WARNING(name << "Logger buffer is "
                      << ((parameters.maxBufferSize + readIndex - writeIndex) % parameters.maxBufferSize) /
                      static_cast<float>(parameters.maxBufferSize) * 100.f
-                     << "% free.");
+                     << "% free, "
+                     << (parameters.maxBufferSize + writeIndex - compressIndex) % parameters.maxBufferSize
+                     << " blocks wait for compression, "
+                     << (parameters.maxBufferSize + compressIndex - readIndex) % parameters.maxBufferSize
+                     << " blocks for writing, max. compression time " << maxCompressionTime
+                     << " ms, max. write time " << maxWriteTime << " ms, "
+                     << discardedFrames << " frames and " << discardedImages << " images discarded.");
+      maxCompressionTime = maxWriteTime = discardedFrames = discardedImages = 0;
+    }
     frameCounter = 0;
   }
 }
 
-void Logger::writeThread()
+void Logger::compressThread()
 {
   BH_TRACE_INIT(getName(loggedProcess));
   const size_t compressedSize = snappy_max_compressed_length(parameters.blockSize + 2 * sizeof(unsigned));
-  std::vector<char> compressedBuffer(compressedSize + sizeof(unsigned)); // Also reserve 4 bytes for header
-  OutBinaryFile* file = nullptr;
 
-  while(writerThread.isRunning()) // Check if we are expecting more data
-    if(framesToWrite.wait(100)) // Wait 100 ms for new data then check again if we should quit
+  while(compressing)
+    if(blocksToCompress.wait(100)) // Wait 100 ms for new data then check again if we should quit
     {
-      writerIdle = false;
-      MessageQueue& queue = *buffer[readIndex];
+      int index;
+      {
+        std::lock_guard<std::mutex> lock(pipelineMutex);
+        index = compressIndex;
+        compressIndex = (compressIndex + 1) % parameters.maxBufferSize;
+      }
+
+      const unsigned startTime = Time::getRealSystemTime();
+      MessageQueue& queue = *buffer[index];
+      std::vector<char>& compressedBlock = compressedBuffer[index];
       if(queue.getNumberOfMessages() > 0)
       {
+        if(parameters.deltaEncoding)
+          DeltaCoding::encode(queue.getStreamedData(), queue.getStreamedSize());
         size_t size = compressedSize;
+        compressedBlock.resize(compressedSize + sizeof(unsigned)); // Also reserve 4 bytes for header
         VERIFY(snappy_compress(queue.getStreamedData(), queue.getStreamedSize(),
-                               compressedBuffer.data() + sizeof(unsigned), &size) == SNAPPY_OK);
-        reinterpret_cast<unsigned&>(compressedBuffer[0]) = static_cast<unsigned>(size);
-        if(!file)
+                               compressedBlock.data() + sizeof(unsigned), &size) == SNAPPY_OK);
+        reinterpret_cast<unsigned&>(compressedBlock[0]) = static_cast<unsigned>(size);
+        compressedBlock.resize(size + sizeof(unsigned));
+      }
+      else
+        compressedBlock.clear();
+
+      {
+        std::lock_guard<std::mutex> lock(pipelineMutex);
+        compressed[index] = true;
+        maxCompressionTime = std::max(maxCompressionTime, static_cast<unsigned>(Time::getRealTimeSince(startTime)));
+      }
+      blockCompressed.notify_all();
+    }
+}
+
+void Logger::writeThread()
+{
+  BH_TRACE_INIT(getName(loggedProcess));
+  OutBinaryFile* file = nullptr;
+  LogFileIndex index;
+
+  while(writerThread.isRunning()) // Check if we are expecting more data
+  {
+    {
+      // Wait 100 ms for the next block in sequence then check again if we should quit
+      std::unique_lock<std::mutex> lock(pipelineMutex);
+      if(!blockCompressed.wait_for(lock, std::chrono::milliseconds(100), [this] {return compressed[readIndex] != 0;}))
+      {
+        if(!writerIdle)
         {
-          // find next free log filename
-          std::string num = "";
-          for(int i = 0; i < 100; ++i)
+          writerIdle = true;
+          writerIdleStart = Time::getCurrentSystemTime();
+        }
+        continue;
+      }
+    }
+
+    writerIdle = false;
+    const unsigned startTime = Time::getRealSystemTime();
+    MessageQueue& queue = *buffer[readIndex];
+    const std::vector<char>& compressedBlock = compressedBuffer[readIndex];
+    if(!compressedBlock.empty())
+    {
+      if(!file)
+      {
+        // find next free log filename
+        std::string num = "";
+        for(int i = 0; i < 100; ++i)
+        {
+          if(i)
           {
-            if(i)
-            {
-              char buf[6];
-              sprintf(buf, "_(%02d)", i);
-              num = buf;
-            }
-            InBinaryFile stream(logFilename + num + ".log");
-            if(!stream.exists())
-              break;
+            char buf[6];
+            sprintf(buf, "_(%02d)", i);
+            num = buf;
           }
-          logFilename += num + ".log";
-
-          file = new OutBinaryFile(logFilename);
-          ASSERT(file->exists());
-          *file << Logging::logFileMessageIDs;
-          queue.writeMessageIDs(*file);
-          *file << Logging::logFileStreamSpecification;
-          file->write(streamSpecification.data(), streamSpecification.size());
-          *file << Logging::logFileCompressed; // Write magic byte that indicates a compressed log file
+          InBinaryFile stream(logFilename + num + ".log");
+          if(!stream.exists())
+            break;
         }
-        if(SystemCall::getFreeDiskSpace(logFilename.c_str())
-           < (static_cast<unsigned long long>(parameters.minFreeSpace) << 20) + size + sizeof(unsigned))
-          break;
-        file->write(compressedBuffer.data(), size + sizeof(unsigned));
-        queue.clear();
+        logFilename += num + ".log";
+
+        file = new OutBinaryFile(logFilename);
+        ASSERT(file->exists());
+        *file << Logging::logFileMessageIDs;
+        queue.writeMessageIDs(*file);
+        *file << Logging::logFileStreamSpecification;
+        file->write(streamSpecification.data(), streamSpecification.size());
+        // Write magic byte that indicates a compressed log file with index
+        *file << (parameters.deltaEncoding ? Logging::logFileIndexedDeltaEncoded : Logging::logFileIndexed);
       }
-      readIndex = (readIndex + 1) % parameters.maxBufferSize;
+      if(SystemCall::getFreeDiskSpace(logFilename.c_str())
+         < (static_cast<unsigned long long>(parameters.minFreeSpace) << 20) + compressedBlock.size())
+        break;
+      file->write(compressedBlock.data(), compressedBlock.size());
+
+      const BlockInfo& blockInfo = blockInfos[readIndex];
+      index.blocks.push_back(blockInfo.block);
+      index.blocks.back().size = static_cast<unsigned>(compressedBlock.size() - sizeof(unsigned));
+      index.imageFrames.insert(index.imageFrames.end(), blockInfo.imageFrames.begin(), blockInfo.imageFrames.end());
     }
-    else if(!writerIdle)
+    queue.clear();
+
     {
-      writerIdle = true;
-      writerIdleStart = Time::getCurrentSystemTime();
+      std::lock_guard<std::mutex> lock(pipelineMutex);
+      compressed[readIndex] = false;
+      maxWriteTime = std::max(maxWriteTime, static_cast<unsigned>(Time::getRealTimeSince(startTime)));
     }
+    readIndex = (readIndex + 1) % parameters.maxBufferSize;
+  }
 
   if(file)
+  {
+    // Terminate the sequence of blocks and append the index. Its size is written last
+    // so that it can be found from the end of the file.
+    OutBinarySize size;
+    size << index;
+    *file << 0u << index << static_cast<unsigned>(size.getSize());
     delete file;
+  }
 }
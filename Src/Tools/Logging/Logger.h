@@ -6,8 +6,14 @@
  * Logfile format:
  * logFileMessageIDs | number of message ids | streamed message id names |
  * logFileStreamSpecification | streamed StreamHandler |
- * idLogFileCompressed | size of next compressed block | compressed block | size | compressed block | etc...
- * Each block is compressed using libsnappy
+ * logFileIndexed | size of next compressed block | compressed block | size | compressed block | etc... |
+ * 0 | streamed LogFileIndex | size of streamed LogFileIndex |
+ * If delta encoding is active, the magic byte is logFileIndexedDeltaEncoded instead
+ * and each block was encoded with DeltaCoding::encode() before it was compressed.
+ * Each block is compressed using libsnappy. Blocks are compressed by several threads
+ * in parallel and written in the order they were logged by a separate writer thread.
+ * When the log file is closed, an index of all blocks written is appended, which
+ * can be found by reading its size from the end of the file.
  *
  * Block format (after decompression):
  * | block length | number of messages | Frame | Frame | Frame | ... | Frame |
@@ -29,10 +35,14 @@
 #include "Platform/Time.h"
 #include "Representations/Infrastructure/GameInfo.h"
 #include "Tools/Debugging/Debugging.h"
+#include "Tools/Logging/LogFileIndex.h"
 #include "Tools/MessageQueue/MessageQueue.h"
 #include "Tools/Module/Blackboard.h"
 #include "Tools/Cabsl.h"
 #include "Tools/Streams/Enum.h"
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 
 class Logger : public Cabsl<Logger>
 {
@@ -60,6 +70,9 @@ private:
     (int) writePriority,
     (unsigned) minFreeSpace, /**< Minimum free space left on the device in MB. */
     (bool) debugStatistics,
+    (int)(2) numOfCompressionThreads, /**< How many threads compress blocks in parallel? */
+    (bool)(false) deltaEncoding, /**< Encode messages relative to their predecessors of the same type before compressing them? */
+    (int)(25) minFreeBufferForImages, /**< Images are not logged while less than this percentage of the buffer is free. */
   });
 
   STREAMABLE(TeamList,
@@ -78,9 +91,20 @@ private:
   public:
     const Streamable* representation;
     MessageID id;
+    bool isImage; /**< Is this an image that is dropped first if the buffer runs full? */
 
     Loggable() = default;
-    Loggable(const Streamable* representation, MessageID id) : representation(representation), id(id) {}
+    Loggable(const Streamable* representation, MessageID id) :
+      representation(representation), id(id),
+      isImage(id == idImage || id == idJPEGImage || id == idThumbnail || id == idImagePatches || id == idLowFrameRateImage)
+    {}
+  };
+
+  /** The index information collected for an entry of the ring buffer. */
+  struct BlockInfo
+  {
+    LogFileIndex::Block block; /**< The description of the block. Its size is set by the writer thread. */
+    std::vector<unsigned> imageFrames; /**< The numbers of the frames in this block that contain images. */
   };
 
   Parameters parameters;
@@ -91,11 +115,24 @@ private:
   std::vector<MessageQueue*> buffer; /**< Ring buffer of message queues. Shared with the writer thread. */
   std::string logFilename; /**< Path and name of the log file. Set in initial state. */
   bool receivedGameControllerPacket = false; /**< Ever received a packet from the GameController? */
+  std::vector<std::vector<char>> compressedBuffer; /**< The compressed block for each entry of the ring buffer. */
+  std::vector<char> compressed; /**< Has the corresponding entry of the ring buffer already been compressed? */
+  std::vector<BlockInfo> blockInfos; /**< The index information for each entry of the ring buffer. */
+  unsigned loggedFrames = 0; /**< The number of frames put into the ring buffer since the logger was started. */
   volatile int readIndex = 0; /**< The first index of the buffer that should be read by the writer thread. */
   volatile int writeIndex = 0; /**< Index of the buffer that is currently used for writing. */
+  int compressIndex = 0; /**< Index of the buffer the next compression thread will compress. */
   int frameCounter = 0; /**< Number of frames that are already in the current message queue. */
   Thread writerThread;/**< Used to write the buffer to disk in the background */
-  Semaphore framesToWrite; /**< How many frames the writer thread should write? */
+  std::vector<std::unique_ptr<Thread>> compressionThreads; /**< Compress blocks in parallel before the writer thread writes them. */
+  volatile bool compressing = false; /**< Should the compression threads continue? */
+  Semaphore blocksToCompress; /**< How many blocks the compression threads should compress? */
+  std::mutex pipelineMutex; /**< Protects compressIndex, compressed, and the statistics. */
+  std::condition_variable blockCompressed; /**< Notifies the writer thread about compressed blocks. */
+  unsigned maxCompressionTime = 0; /**< The longest time compressing a block took since the last statistics output (in ms). */
+  unsigned maxWriteTime = 0; /**< The longest time writing a block took since the last statistics output (in ms). */
+  unsigned discardedFrames = 0; /**< The number of frames discarded since the last statistics output. */
+  unsigned discardedImages = 0; /**< The number of images not logged since the last statistics output to keep buffer space for the other representations. */
   volatile bool writerIdle = true; /**< Is true if the writer thread has nothing to do. */
   volatile unsigned writerIdleStart = 0; /**< The system time at which the writer thread went idle. */
   std::vector<char> streamSpecification; /**< Streamed specification created in main thread and used in logger thread. */
@@ -114,7 +151,10 @@ private:
   /** Write all loggable representations to a buffer. */
   void logFrame();
 
-  /** Write contents of buffers to disk in the background. */
+  /** Compress blocks of the buffer in the background. */
+  void compressThread();
+
+  /** Write compressed blocks to disk in the order they were logged. */
   void writeThread();
 
   /** Minimal behavior to handle logging. */
@@ -140,6 +180,13 @@ private:
       }
       action
       {
+        compressing = true;
+        for(int i = 0; i < std::max(1, parameters.numOfCompressionThreads); ++i)
+        {
+          compressionThreads.emplace_back(new Thread);
+          compressionThreads.back()->setPriority(parameters.writePriority);
+          compressionThreads.back()->start(this, &Logger::compressThread);
+        }
         writerThread.start(this, &Logger::writeThread);
       }
     }
@@ -8,3 +8,12 @@ std::mt19937& Random::getGenerator()
 
   return generator;
 }
+
+void Random::seed(unsigned int seed)
+{
+  getGenerator().seed(seed);
+
+  // Drop values that were generated with the previous seed.
+  getNormalDistribution<float>().reset();
+  getNormalDistribution<double>().reset();
+}
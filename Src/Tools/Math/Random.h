@@ -59,6 +59,25 @@ public:
   static T triangular(T low, T mean, T high);
 
   static std::mt19937& getGenerator();
+
+  /**
+   * Reseeds the generator of the calling thread, so that the following sequence
+   * of random numbers can be reproduced.
+   */
+  static void seed(unsigned int seed);
+
+private:
+  /**
+   * Returns the normal distribution of the calling thread. It is kept between calls,
+   * because it generates its values in pairs and returns the second one with the
+   * next call.
+   */
+  template<typename T>
+  static std::normal_distribution<T>& getNormalDistribution()
+  {
+    static thread_local std::normal_distribution<T> distribution;
+    return distribution;
+  }
 };
 
 inline bool Random::bernoulli(double p)
@@ -68,10 +87,10 @@ inline bool Random::bernoulli(double p)
 }
 
 template<typename T>
-T Random::normal(T min, T max)
+T Random::normal(T mean, T sigma)
 {
-  std::normal_distribution<T> dist(min, max);
-  return dist(getGenerator());
+  using Param = typename std::normal_distribution<T>::param_type;
+  return getNormalDistribution<T>()(getGenerator(), Param(mean, sigma));
 }
 
 template<typename T>
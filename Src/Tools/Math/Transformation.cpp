@@ -112,7 +112,8 @@ bool Transformation::imageToRobotHorizontalPlane(const Vector2f& pointInImage, f
 bool Transformation::robotToImage(const Vector3f& point, const CameraMatrix& cameraMatrix,
                                   const CameraInfo& cameraInfo, Vector2f& pointInImage)
 {
-  Vector3f pointInCam = cameraMatrix.inverse() * point;
+  // Same as cameraMatrix.inverse() * point without building the inverse pose for every point
+  Vector3f pointInCam = cameraMatrix.rotation.transpose() * (point - cameraMatrix.translation);
   if(pointInCam.x() <= 0)
     return false;
 
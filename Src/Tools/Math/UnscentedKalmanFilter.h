@@ -13,7 +13,7 @@
 #include "Eigen.h"
 #include "Platform/BHAssert.h"
 
-#include <functional>
+#include <array>
 #include <limits>
 
 /**
@@ -82,29 +82,31 @@ namespace impl
     /**
      * The prediction step to propagate the whole hypothesis with a given dynamic model and an operation specific noise.
      * In other works this function is referred as dynamic step.
-     * @param dynamicModel, a function to propagate the state
+     * @param dynamicModel, a function to propagate the state, i.e. a callable with the signature void(State&)
      * @param noise, the propagation specific noise to quantify the uncertainty
      */
-    void predict(std::function<void(State&)> dynamicModel, const CovarianceType& noise);
+    template<typename DynamicModel>
+    void predict(const DynamicModel& dynamicModel, const CovarianceType& noise);
 
     /**
      * The multi dimensional update step to integrate a measurement into an existing hypothesis.
      * In other works this function is referred as measurement step.
      * @param measurement, a vector that stores all relevant data of a measurement
-     * @param measurementModel, a function that returns a measurement for a state
+     * @param measurementModel, a function that returns a measurement for a state, i.e. a callable with the signature Vectorf<N>(const State&)
      * @param measurementNoise, the measurement specific noise to quantify the uncertainty
      */
-    template<unsigned N>
-    void update(const Vectorf<N>& measurement, std::function<Vectorf<N>(const State&)> measurementModel, const Eigen::Matrix<float, N, N>& measurementNoise);
+    template<unsigned N, typename MeasurementModel>
+    void update(const Vectorf<N>& measurement, const MeasurementModel& measurementModel, const Eigen::Matrix<float, N, N>& measurementNoise);
 
     /**
      * The single dimensional update step to integrate a measurement into an existing hypothesis.
      * In other works this function is referred as measurement step.
      * @param measurement, a float value that represents a measurement
-     * @param measurementModel, a function that returns a measurement for a state
+     * @param measurementModel, a function that returns a measurement for a state, i.e. a callable with the signature float(const State&)
      * @param measurementNoise, the measurement specific noise to quantify the uncertainty
      */
-    void update(float measurement, std::function<float(const State&)> measurementModel, float measurementNoise);
+    template<typename MeasurementModel>
+    void update(float measurement, const MeasurementModel& measurementModel, float measurementNoise);
 
   private:
     /**
@@ -163,7 +165,8 @@ namespace impl
    * @param noise, the propagation specific noise to quantify the uncertainty
    */
   template<typename State, unsigned DOF, bool Manifold>
-  void UnscentedKalmanFilter<State, DOF, Manifold>::predict(std::function<void(State&)> dynamicModel, const CovarianceType& noise)
+  template<typename DynamicModel>
+  void UnscentedKalmanFilter<State, DOF, Manifold>::predict(const DynamicModel& dynamicModel, const CovarianceType& noise)
   {
     ASSERT((noise.array() >= 0.f).all());
     ASSERT(noise.trace() > 0.f);
@@ -196,8 +199,8 @@ namespace impl
    * @param measurementNoise, the measurement specific noise to quantify the uncertainty
    */
   template<typename State, unsigned DOF, bool IsManifold>
-  template<unsigned N>
-  void UnscentedKalmanFilter<State, DOF, IsManifold>::update(const Vectorf<N>& measurement, std::function<Vectorf<N>(const State&)> measurementModel, const Eigen::Matrix<float, N, N>& measurementNoise)
+  template<unsigned N, typename MeasurementModel>
+  void UnscentedKalmanFilter<State, DOF, IsManifold>::update(const Vectorf<N>& measurement, const MeasurementModel& measurementModel, const Eigen::Matrix<float, N, N>& measurementNoise)
   {
     ASSERT((measurementNoise.array() >= 0.f).all());
     ASSERT(measurementNoise.trace() > 0.f);
@@ -252,7 +255,8 @@ namespace impl
    * @param measurementNoise, the measurement specific noise to quantify the uncertainty
    */
   template<typename State, unsigned DOF, bool IsManifold>
-  void UnscentedKalmanFilter<State, DOF, IsManifold>::update(float measurement, std::function<float(const State&)> measurementModel, float measurementNoise)
+  template<typename MeasurementModel>
+  void UnscentedKalmanFilter<State, DOF, IsManifold>::update(float measurement, const MeasurementModel& measurementModel, float measurementNoise)
   {
     ASSERT(measurementNoise > 0.f);
 
@@ -95,6 +95,13 @@ public:
    */
   void removeRepetitions() {queue.removeRepetitions();}
 
+  /**
+   * The method deletes all messages of certain types from the queue.
+   * This method should not be called during message handling.
+   * @param ids The types of the messages to delete.
+   */
+  void removeMessages(std::initializer_list<MessageID> ids) {queue.removeMessages(ids);}
+
   /**
    * The method removes all messages from the queue.
    */
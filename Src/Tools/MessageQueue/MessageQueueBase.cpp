@@ -106,17 +106,14 @@ void MessageQueueBase::removeMessage(int message)
 {
   freeIndex();
   selectedMessageForReadingPosition = 0;
-  int i;
-  for(i = 0; i < message; ++i)
+  for(int i = 0; i < message; ++i)
     selectedMessageForReadingPosition += getMessageSize() + headerSize;
-  usedSize = selectedMessageForReadingPosition;
-  for(++i; i < numberOfMessages; ++i)
-  {
-    int mlength = getMessageSize() + headerSize;
-    selectedMessageForReadingPosition += mlength;
-    memcpy(buf + usedSize, buf + selectedMessageForReadingPosition, mlength);
-    usedSize = selectedMessageForReadingPosition;
-  }
+
+  // All following messages are moved at once. The areas overlap, so memmove is required.
+  const unsigned start = selectedMessageForReadingPosition;
+  const unsigned end = start + getMessageSize() + headerSize;
+  memmove(buf + start, buf + end, usedSize - end);
+  usedSize -= end - start;
   readPosition = 0;
   --numberOfMessages;
   selectedMessageForReadingPosition = 0;
@@ -341,6 +338,31 @@ void MessageQueueBase::removeRepetitions()
   lastMessage = 0;
 }
 
+void MessageQueueBase::removeMessages(std::initializer_list<MessageID> ids)
+{
+  ASSERT(!messageIndex);
+  selectedMessageForReadingPosition = 0;
+  usedSize = 0;
+  int numOfDeleted = 0;
+  for(int i = 0; i < numberOfMessages; ++i)
+  {
+    const int mlength = getMessageSize() + headerSize;
+    if(std::find(ids.begin(), ids.end(), getMessageID()) == ids.end())
+    {
+      if(usedSize != selectedMessageForReadingPosition)
+        memmove(buf + usedSize, buf + selectedMessageForReadingPosition, mlength);
+      usedSize += mlength;
+    }
+    else
+      ++numOfDeleted;
+    selectedMessageForReadingPosition += mlength;
+  }
+  numberOfMessages -= numOfDeleted;
+  readPosition = 0;
+  selectedMessageForReadingPosition = 0;
+  lastMessage = 0;
+}
+
 MessageID MessageQueueBase::getMessageID() const
 {
   MessageID id = MessageID(buf[selectedMessageForReadingPosition]);
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <cstddef>
+#include <initializer_list>
 #include <string>
 
 #include "MessageIDs.h"
@@ -158,6 +159,13 @@ public:
    */
   void removeRepetitions();
 
+  /**
+   * The method deletes all messages of certain types from the queue.
+   * This method should not be called during message handling.
+   * @param ids The types of the messages to delete.
+   */
+  void removeMessages(std::initializer_list<MessageID> ids);
+
   /**
    * Write message ids to a stream as text.
    * @param stream The stream to write to.
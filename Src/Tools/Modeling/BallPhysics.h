@@ -191,7 +191,8 @@ public:
   static float timeForDistance(const Vector2f& v, float distance, float ballFriction)
   {
     ASSERT(ballFriction < 0.f);
-    if(getEndPosition(Vector2f::Zero(), v, ballFriction).norm() < distance)
+    const float stopDistance = v.squaredNorm() / (-2000.f * ballFriction); // unit: millimeter
+    if(stopDistance < distance)
     {
       return std::numeric_limits<float>::max();
     }
@@ -10,6 +10,7 @@
 #include "PerceptRegistration.h"
 #include "UKFPose2D.h"
 #include "Tools/Debugging/DebugDrawings.h"
+#include <algorithm>
 
 PerceptRegistration::PerceptRegistration(const CameraMatrix& cameraMatrix,
     const CirclePercept& circlePercept,
@@ -97,6 +98,17 @@ PerceptRegistration::PerceptRegistration(const CameraMatrix& cameraMatrix,
         horizontalFieldLines.push_back(relevantFieldLine);
     }
   }
+  // Index all lines by the coordinate that is constant along them
+  for(unsigned i = 0; i < verticalFieldLines.size(); ++i)
+    verticalFieldLineIndex.push_back({verticalFieldLines[i].start.y(), i});
+  std::sort(verticalFieldLineIndex.begin(), verticalFieldLineIndex.end());
+  for(unsigned i = 0; i < horizontalFieldLines.size(); ++i)
+    if(std::abs(horizontalFieldLines[i].start.x() - horizontalFieldLines[i].end.x()) < 0.001f)
+      horizontalFieldLineIndex.push_back({horizontalFieldLines[i].start.x(), i});
+    else
+      unindexedFieldLines.push_back(i);
+  std::sort(horizontalFieldLineIndex.begin(), horizontalFieldLineIndex.end());
+
   // Seach center line in list of all lines:
   centerLine = 0;
   for(auto& fieldLine : horizontalFieldLines)
@@ -140,15 +152,58 @@ PerceptRegistration::PerceptRegistration(const CameraMatrix& cameraMatrix,
     lIntersections.push_back(Vector2f(theFieldDimensions.xPosOpponentGoal, theFieldDimensions.yPosRightGoal));
   }
 
+  createIndex(xIntersections, xIntersectionIndex);
+  createIndex(tIntersections, tIntersectionIndex);
+  createIndex(lIntersections, lIntersectionIndex);
+
   // Initialize time stamps
   lastGoalPostCovarianceUpdate = 0;
   lastPenaltyMarkCovarianceUpdate = 0;
   lastCirclePerceptCovarianceUpdate = 0;
 }
 
+void PerceptRegistration::createIndex(const std::vector<Vector2f>& points, std::vector<IndexEntry>& index)
+{
+  index.clear();
+  for(unsigned i = 0; i < points.size(); ++i)
+    index.push_back({points[i].x(), i});
+  std::sort(index.begin(), index.end());
+}
+
+std::vector<PerceptRegistration::IndexEntry>::const_iterator PerceptRegistration::lowerBound(const std::vector<IndexEntry>& index, float coordinate)
+{
+  return std::lower_bound(index.begin(), index.end(), IndexEntry({coordinate, 0}));
+}
+
 void PerceptRegistration::update(const Pose2f& theRobotPose, RegisteredPercepts& registeredPercepts,
-                                 const Pose3f& inverseCameraMatrix, const Vector2f& currentRotationDeviation)
+                                 const Pose3f& inverseCameraMatrix, const Vector2f& currentRotationDeviation,
+                                 bool useCache)
 {
+  // Samples close to each other register the same percepts, so reuse the results of this frame.
+  int x = 0;
+  int y = 0;
+  int rotation = 0;
+  if(useCache)
+  {
+    if(timeOfCache != theFrameInfo.time)
+    {
+      numOfCachedRegistrations = 0;
+      timeOfCache = theFrameInfo.time;
+    }
+    x = static_cast<int>(std::floor(theRobotPose.translation.x() / cacheCellSize));
+    y = static_cast<int>(std::floor(theRobotPose.translation.y() / cacheCellSize));
+    rotation = static_cast<int>(std::floor(Angle::normalize(theRobotPose.rotation) / cacheCellRotation));
+    for(size_t i = 0; i < numOfCachedRegistrations; ++i)
+    {
+      const CachedRegistration& entry = cache[i];
+      if(entry.x == x && entry.y == y && entry.rotation == rotation)
+      {
+        registeredPercepts = entry.registeredPercepts;
+        return;
+      }
+    }
+  }
+
   robotPose = theRobotPose;
   this->inverseCameraMatrix = inverseCameraMatrix;
   this->currentRotationDeviation = currentRotationDeviation;
@@ -171,6 +226,17 @@ void PerceptRegistration::update(const Pose2f& theRobotPose, RegisteredPercepts&
   registeredPercepts.totalNumberOfPerceivedLandmarks = registerLandmarks(registeredPercepts.landmarks);
   registeredPercepts.totalNumberOfPerceivedPoses     = registerPoses(registeredPercepts.poses);
   draw();
+
+  if(useCache)
+  {
+    if(numOfCachedRegistrations == cache.size())
+      cache.emplace_back();
+    CachedRegistration& entry = cache[numOfCachedRegistrations++];
+    entry.x = x;
+    entry.y = y;
+    entry.rotation = rotation;
+    entry.registeredPercepts = registeredPercepts;
+  }
 }
 
 int PerceptRegistration::registerPoses(std::vector<RegisteredPose>& poses)
@@ -350,23 +416,31 @@ int PerceptRegistration::registerLines(std::vector<RegisteredLine>& lines)
 bool PerceptRegistration::getAssociatedIntersection(const FieldLineIntersections::Intersection& intersection, Vector2f& associatedIntersection) const
 {
   const std::vector< Vector2f >* corners = &lIntersections;
+  const std::vector<IndexEntry>* index = &lIntersectionIndex;
   if(intersection.type == FieldLineIntersections::Intersection::T)
+  {
     corners = &tIntersections;
+    index = &tIntersectionIndex;
+  }
   else if(intersection.type == FieldLineIntersections::Intersection::X)
+  {
     corners = &xIntersections;
+    index = &xIntersectionIndex;
+  }
   const Vector2f pointWorld = robotPose * intersection.pos;
   const float sqrThresh = intersectionAssociationDistance * intersectionAssociationDistance;
-  for(unsigned int i = 0; i < corners->size(); ++i)
-  {
-    const Vector2f& c = corners->at(i);
-    // simple implementation for testing:
-    if((pointWorld - c).squaredNorm() < sqrThresh)
-    {
-      associatedIntersection = c;
-      return true;
-    }
-  }
-  return false;
+
+  // Only corners with a similar x coordinate can be close enough. Among them, the first one in
+  // the list is associated.
+  unsigned associated = static_cast<unsigned>(corners->size());
+  for(auto entry = lowerBound(*index, pointWorld.x() - intersectionAssociationDistance);
+      entry != index->end() && entry->coordinate <= pointWorld.x() + intersectionAssociationDistance; ++entry)
+    if(entry->index < associated && (pointWorld - (*corners)[entry->index]).squaredNorm() < sqrThresh)
+      associated = entry->index;
+  if(associated == corners->size())
+    return false;
+  associatedIntersection = (*corners)[associated];
+  return true;
 }
 
 bool PerceptRegistration::getAssociatedPenaltyMark(const Vector2f& penaltyMarkPercept, Vector2f& associatedPenaltyMark) const
@@ -417,28 +491,28 @@ const PerceptRegistration::FieldLine* PerceptRegistration::getPointerToAssociate
   if(lineLength < 1000.f && iAmBeforeKickoffInTheCenterOfMyHalfLookingForward() &&
      theGameInfo.kickOffTeam != theOwnTeamInfo.teamNumber)
     return nullptr;
-  const float sqrLineAssociationCorridor     = sqr(lineAssociationCorridor);
-  const float sqrLongLineAssociationCorridor = sqr(longLineAssociationCorridor);
-  Vector2f intersection;
   const std::vector<FieldLine>& fieldLines = isVertical ? verticalFieldLines : horizontalFieldLines;
+  const std::vector<IndexEntry>& index = isVertical ? verticalFieldLineIndex : horizontalFieldLineIndex;
 
-  for(unsigned int i = 0; i < fieldLines.size(); ++i)
-  {
-    const FieldLine& fieldLine = fieldLines[i];
-    const float currentSqrCorridor = (fieldLine.isLong && perceivedLineIsLong) ? sqrLongLineAssociationCorridor : sqrLineAssociationCorridor;
-    if(getSqrDistanceToLine(fieldLine.start, fieldLine.dir, fieldLine.length, startOnField) > currentSqrCorridor ||
-       getSqrDistanceToLine(fieldLine.start, fieldLine.dir, fieldLine.length, endOnField) > currentSqrCorridor)
-      continue;
-    if(!intersectLineWithLine(startOnField, orthogonalOnField, fieldLine.start, fieldLine.dir, intersection))
-      continue;
-    if(getSqrDistanceToLine(startOnField, dirOnField, intersection) > currentSqrCorridor)
-      continue;
-    if(!intersectLineWithLine(endOnField, orthogonalOnField, fieldLine.start, fieldLine.dir, intersection))
-      continue;
-    if(getSqrDistanceToLine(startOnField, dirOnField, intersection) > currentSqrCorridor)
-      continue;
-    return &(fieldLines[i]);
-  }
+  // Both ends of the perceived line must be within the corridor around a field line.
+  // Therefore, only field lines are considered the constant coordinate of which is close to
+  // both ends. Among all matching lines, the first one in the list is associated.
+  const float corridor = perceivedLineIsLong ? std::max(lineAssociationCorridor, longLineAssociationCorridor) : lineAssociationCorridor;
+  const float startCoordinate = isVertical ? startOnField.y() : startOnField.x();
+  const float endCoordinate = isVertical ? endOnField.y() : endOnField.x();
+  const float maxCoordinate = std::min(startCoordinate, endCoordinate) + corridor;
+  unsigned associated = static_cast<unsigned>(fieldLines.size());
+  for(auto entry = lowerBound(index, std::max(startCoordinate, endCoordinate) - corridor);
+      entry != index.end() && entry->coordinate <= maxCoordinate; ++entry)
+    if(entry->index < associated &&
+       lineMatches(fieldLines[entry->index], startOnField, endOnField, dirOnField, orthogonalOnField, perceivedLineIsLong))
+      associated = entry->index;
+  if(!isVertical)
+    for(unsigned i : unindexedFieldLines)
+      if(i < associated && lineMatches(fieldLines[i], startOnField, endOnField, dirOnField, orthogonalOnField, perceivedLineIsLong))
+        associated = i;
+  if(associated < fieldLines.size())
+    return &fieldLines[associated];
 
   // If this point has been reached, no matching line has been found.
   // However, in READY and SET, we try to consider a wide tolerance to match the center line. This
@@ -450,6 +524,19 @@ const PerceptRegistration::FieldLine* PerceptRegistration::getPointerToAssociate
   return nullptr;
 }
 
+bool PerceptRegistration::lineMatches(const FieldLine& fieldLine, const Vector2f& startOnField, const Vector2f& endOnField,
+                                      const Vector2f& dirOnField, const Vector2f& orthogonalOnField, bool perceivedLineIsLong) const
+{
+  const float currentSqrCorridor = sqr((fieldLine.isLong && perceivedLineIsLong) ? longLineAssociationCorridor : lineAssociationCorridor);
+  Vector2f intersection;
+  return getSqrDistanceToLine(fieldLine.start, fieldLine.dir, fieldLine.length, startOnField) <= currentSqrCorridor &&
+         getSqrDistanceToLine(fieldLine.start, fieldLine.dir, fieldLine.length, endOnField) <= currentSqrCorridor &&
+         intersectLineWithLine(startOnField, orthogonalOnField, fieldLine.start, fieldLine.dir, intersection) &&
+         getSqrDistanceToLine(startOnField, dirOnField, intersection) <= currentSqrCorridor &&
+         intersectLineWithLine(endOnField, orthogonalOnField, fieldLine.start, fieldLine.dir, intersection) &&
+         getSqrDistanceToLine(startOnField, dirOnField, intersection) <= currentSqrCorridor;
+}
+
 // THIS IS SOMEHOW HACKED. COULD BE IMPROVED IN THE FUTURE. T.L.
 bool PerceptRegistration::iAmBeforeKickoffAndTheLineIsProbablyTheCenterLine(const Vector2f& lineStart,
                                                                             const Vector2f& lineEnd,
@@ -146,10 +146,45 @@ private:
   std::vector< Vector2f > xIntersections;
   std::vector< Vector2f > lIntersections;
   std::vector< Vector2f > tIntersections;
+
+  /**
+   * An entry of an index that sorts field features by one coordinate.
+   * As all field features are aligned with the axes of the field, this
+   * allows to only consider the few features near a percept.
+   */
+  struct IndexEntry
+  {
+    float coordinate; /**< The coordinate of the field feature used for sorting. */
+    unsigned index; /**< The index of the field feature in its list. */
+
+    bool operator<(const IndexEntry& other) const {return coordinate < other.coordinate;}
+  };
+
+  std::vector<IndexEntry> verticalFieldLineIndex; /**< The vertical field lines sorted by their y coordinate. */
+  std::vector<IndexEntry> horizontalFieldLineIndex; /**< The horizontal field lines with a constant x coordinate sorted by it. */
+  std::vector<unsigned> unindexedFieldLines; /**< The indices of the horizontal field lines that are not parallel to the y axis. */
+  std::vector<IndexEntry> xIntersectionIndex; /**< The X intersections sorted by their x coordinate. */
+  std::vector<IndexEntry> lIntersectionIndex; /**< The L intersections sorted by their x coordinate. */
+  std::vector<IndexEntry> tIntersectionIndex; /**< The T intersections sorted by their x coordinate. */
   float goalAcceptanceThreshold;
   Pose3f inverseCameraMatrix;
   Vector2f currentRotationDeviation;
 
+  /** The registration results of a pose cell of the current frame. */
+  struct CachedRegistration
+  {
+    int x; /**< The quantized x coordinate of the poses of this cell. */
+    int y; /**< The quantized y coordinate of the poses of this cell. */
+    int rotation; /**< The quantized rotation of the poses of this cell. */
+    RegisteredPercepts registeredPercepts; /**< The percepts registered for the first pose in this cell. */
+  };
+
+  const float cacheCellSize = 20.f; /**< The edge length of the cells in which registrations are reused (in mm). */
+  const Angle cacheCellRotation = 1_deg; /**< The angular size of the cells in which registrations are reused. */
+  std::vector<CachedRegistration> cache; /**< The registrations computed in the current frame. Entries are recycled. */
+  size_t numOfCachedRegistrations = 0; /**< The number of entries of the cache that are valid. */
+  unsigned timeOfCache = 0; /**< The frame the cache entries were computed in. */
+
   Matrix2f goalPostCovariance;
   Matrix2f penaltyMarkCovariance;
   Matrix2f circlePerceptCovariance;
@@ -161,6 +196,21 @@ private:
   std::vector<unsigned int> lineCovarianceUpdates;
   std::vector<unsigned int> intersectionCovarianceUpdates;
 
+  /**
+   * Creates an index that sorts points by their x coordinate.
+   * @param points The points to index.
+   * @param index The index that is created.
+   */
+  static void createIndex(const std::vector<Vector2f>& points, std::vector<IndexEntry>& index);
+
+  /**
+   * Returns the first entry of an index that has a coordinate of at least the one given.
+   * @param index The index searched.
+   * @param coordinate The smallest coordinate that is of interest.
+   * @return An iterator to the first relevant entry.
+   */
+  static std::vector<IndexEntry>::const_iterator lowerBound(const std::vector<IndexEntry>& index, float coordinate);
+
   int registerLines(std::vector<RegisteredLine>& lines);
 
   int registerLandmarks(std::vector<RegisteredLandmark>& landmarks);
@@ -179,6 +229,9 @@ private:
 
   const FieldLine* getPointerToAssociatedLine(const Vector2f& start, const Vector2f& end) const;
 
+  bool lineMatches(const FieldLine& fieldLine, const Vector2f& startOnField, const Vector2f& endOnField,
+                   const Vector2f& dirOnField, const Vector2f& orthogonalOnField, bool perceivedLineIsLong) const;
+
   float getSqrDistanceToLine(const Vector2f& base, const Vector2f& dir, float length, const Vector2f& point) const;
 
   float getSqrDistanceToLine(const Vector2f& base, const Vector2f& dir, const Vector2f& point) const;
@@ -223,7 +276,16 @@ public:
                       const float& globalPoseAssociationMaxDistanceDeviation,
                       const Angle& globalPoseAssociationMaxAngularDeviation);
 
-  /** Computes the representation */
+  /**
+   * Computes the representation
+   * @param theRobotPose The pose for which the percepts are registered.
+   * @param registeredPercepts The registered percepts that are computed.
+   * @param inverseCameraMatrix The inverse of the current camera matrix.
+   * @param currentRotationDeviation The current deviation of the rotation of the robot's torso.
+   * @param useCache Reuse the registration of a pose from the same small cell that was
+   *                 already registered in this frame instead of registering again.
+   */
   void update(const Pose2f& theRobotPose, RegisteredPercepts& registeredPercepts,
-              const Pose3f& inverseCameraMatrix, const Vector2f& currentRotationDeviation);
+              const Pose3f& inverseCameraMatrix, const Vector2f& currentRotationDeviation,
+              bool useCache = false);
 };
@@ -17,11 +17,12 @@ void UKFPose2D::motionUpdate(const Pose2f& odometryOffset, const Pose2f& filterP
   generateSigmaPoints();
 
   // addOdometryToSigmaPoints
+  const Vector2f& odoOffset = odometryOffset.translation;
   for(int i = 0; i < 7; ++i)
   {
-    Vector2f odo(odometryOffset.translation);
-    odo.rotate(sigmaPoints[i].z());
-    sigmaPoints[i] += Vector3f(odo.x(), odo.y(), odometryOffset.rotation);
+    const float c = std::cos(sigmaPoints[i].z());
+    const float s = std::sin(sigmaPoints[i].z());
+    sigmaPoints[i] += Vector3f(c * odoOffset.x() - s * odoOffset.y(), s * odoOffset.x() + c * odoOffset.y(), odometryOffset.rotation);
   }
 
   // computeMeanOfSigmaPoints
@@ -31,12 +32,11 @@ void UKFPose2D::motionUpdate(const Pose2f& odometryOffset, const Pose2f& filterP
   mean *= 1.f / 7.f;
 
   // computeCovOfSigmaPoints
-  const Vector3f d = sigmaPoints[0] - mean;
-  cov << d * d.x(), d * d.y(), d * d.z();
-  for(int i = 1; i < 7; ++i)
+  cov = Matrix3f::Zero();
+  for(int i = 0; i < 7; ++i)
   {
     const Vector3f d = sigmaPoints[i] - mean;
-    cov += (Matrix3f() << d * d.x(), d * d.y(), d * d.z()).finished();
+    cov.noalias() += d * d.transpose();
   }
   cov *= 0.5f;
   Covariance::fixCovariance(cov);
@@ -127,9 +127,12 @@ void UKFPose2D::landmarkSensorUpdate(const Vector2f& landmarkPosition, const Vec
   Vector2f landmarkReadings[7];
   for(int i = 0; i < 7; ++i)
   {
-    Pose2f pose(sigmaPoints[i].z(), sigmaPoints[i].head<2>());
-    Vector2f landmarkPosRel = pose.invert() * landmarkPosition; // TODO: optimize this
-    landmarkReadings[i] = Vector2f(landmarkPosRel.x(), landmarkPosRel.y());
+    // Same as Pose2f(sigmaPoints[i].z(), sigmaPoints[i].head<2>()).invert() * landmarkPosition,
+    // but with a single sine/cosine pair per sigma point.
+    const float c = std::cos(sigmaPoints[i].z());
+    const float s = std::sin(sigmaPoints[i].z());
+    const Vector2f offset = landmarkPosition - sigmaPoints[i].head<2>();
+    landmarkReadings[i] = Vector2f(c * offset.x() + s * offset.y(), c * offset.y() - s * offset.x());
   }
 
   // computeMeanOfLandmarkReadings
@@ -139,24 +142,18 @@ void UKFPose2D::landmarkSensorUpdate(const Vector2f& landmarkPosition, const Vec
   landmarkReadingMean *= 1.f / 7.f;
 
   // computeCovOfLandmarkReadingsAndSigmaPoints
+  // The two sigma points of each column of l lie symmetrically around the mean, so the mean cancels out.
   Matrix2x3f landmarkReadingAndMeanCov = Matrix2x3f::Zero();
   for(int i = 0; i < 3; ++i)
-  {
-    const Vector2f d1 = landmarkReadings[i * 2 + 1] - landmarkReadingMean;
-    landmarkReadingAndMeanCov += (Matrix2x3f() << d1 * l(0, i), d1 * l(1, i), d1 * l(2, i)).finished();
-    const Vector2f d2 = landmarkReadings[i * 2 + 2] - landmarkReadingMean;
-    landmarkReadingAndMeanCov += (Matrix2x3f() << d2 * -l(0, i), d2 * -l(1, i), d2 * -l(2, i)).finished();
-  }
+    landmarkReadingAndMeanCov.noalias() += (landmarkReadings[i * 2 + 1] - landmarkReadings[i * 2 + 2]) * l.col(i).transpose();
   landmarkReadingAndMeanCov *= 0.5f;
 
   // computeCovOfLandmarkReadingsReadings
-  const Vector2f d = landmarkReadings[0] - landmarkReadingMean;
   Matrix2f landmarkReadingCov = Matrix2f::Zero();
-  landmarkReadingCov << d * d.x(), d * d.y();
-  for(int i = 1; i < 7; ++i)
+  for(int i = 0; i < 7; ++i)
   {
     const Vector2f d = landmarkReadings[i] - landmarkReadingMean;
-    landmarkReadingCov += (Matrix2f() << d * d.x(), d * d.y()).finished();
+    landmarkReadingCov.noalias() += d * d.transpose();
   }
   landmarkReadingCov *= 0.5f;
 
@@ -189,23 +186,18 @@ void UKFPose2D::lineSensorUpdate(bool vertical, const Vector2f& reading, const M
   lineReadingMean *= 1.f / 7.f;
 
   // computeCovOfLineReadingsAndSigmaPoints
+  // The two sigma points of each column of l lie symmetrically around the mean, so the mean cancels out.
   Matrix2x3f lineReadingAndMeanCov = Matrix2x3f::Zero();
   for(int i = 0; i < 3; ++i)
-  {
-    const Vector2f d1 = lineReadings[i * 2 + 1] - lineReadingMean;
-    lineReadingAndMeanCov += (Matrix2x3f() << d1 * l(0, i), d1 * l(1, i), d1 * l(2, i)).finished();
-    const Vector2f d2 = lineReadings[i * 2 + 2] - lineReadingMean;
-    lineReadingAndMeanCov += (Matrix2x3f() << d2 * -l(0, i), d2 * -l(1, i), d2 * -l(2, i)).finished();
-  }
+    lineReadingAndMeanCov.noalias() += (lineReadings[i * 2 + 1] - lineReadings[i * 2 + 2]) * l.col(i).transpose();
   lineReadingAndMeanCov *= 0.5f;
 
   // computeCovOfLineReadingsReadings
-  const Vector2f d = lineReadings[0] - lineReadingMean;
-  Matrix2f lineReadingCov = (Matrix2f() << d * d.x(), d * d.y()).finished();
-  for(int i = 1; i < 7; ++i)
+  Matrix2f lineReadingCov = Matrix2f::Zero();
+  for(int i = 0; i < 7; ++i)
   {
     const Vector2f d = lineReadings[i] - lineReadingMean;
-    lineReadingCov += (Matrix2f() << d * d.x(), d * d.y()).finished();
+    lineReadingCov.noalias() += d * d.transpose();
   }
   lineReadingCov *= 0.5f;
 
@@ -236,24 +228,18 @@ void UKFPose2D::poseSensorUpdate(const Vector3f& reading, const Matrix3f& readin
   poseReadingMean *= 1.f / 7.f;
 
   // computeCovOfPoseReadingsAndSigmaPoints
+  // The two sigma points of each column of l lie symmetrically around the mean, so the mean cancels out.
   Matrix3f poseReadingAndMeanCov = Matrix3f::Zero();
   for(int i = 0; i < 3; ++i)
-  {
-    const Vector3f d1 = poseReadings[i * 2 + 1] - poseReadingMean;
-    poseReadingAndMeanCov += (Matrix3f() << d1 * l(0, i), d1 * l(1, i), d1 * l(2, i)).finished();
-    const Vector3f d2 = poseReadings[i * 2 + 2] - poseReadingMean;
-    poseReadingAndMeanCov += (Matrix3f() << d2 * -l(0, i), d2 * -l(1, i), d2 * -l(2, i)).finished();
-  }
+    poseReadingAndMeanCov.noalias() += (poseReadings[i * 2 + 1] - poseReadings[i * 2 + 2]) * l.col(i).transpose();
   poseReadingAndMeanCov *= 0.5f;
 
   // computeCovOfPoseReadingsReadings
-  Matrix3f poseReadingCov;
-  const Vector3f d = poseReadings[0] - poseReadingMean;
-  poseReadingCov << d * d.x(), d * d.y(), d * d.z();
-  for(int i = 1; i < 7; ++i)
+  Matrix3f poseReadingCov = Matrix3f::Zero();
+  for(int i = 0; i < 7; ++i)
   {
     const Vector3f d = poseReadings[i] - poseReadingMean;
-    poseReadingCov += (Matrix3f() << d * d.x(), d * d.y(), d * d.z()).finished();
+    poseReadingCov.noalias() += d * d.transpose();
   }
   poseReadingCov *= 0.5f;
 
@@ -40,6 +40,12 @@ const Blackboard::Entry& Blackboard::get(const char* representation) const
   return entries->find(representation)->second;
 }
 
+Streamable* Blackboard::find(const char* representation)
+{
+  auto i = entries->find(representation);
+  return i == entries->end() ? nullptr : i->second.data.get();
+}
+
 bool Blackboard::exists(const char* representation) const
 {
   return entries->find(representation) != entries->end();
@@ -59,6 +65,13 @@ const Streamable& Blackboard::operator[](const char* representation) const
   return *entry.data;
 }
 
+const Streaming::BinaryFunctions& Blackboard::getBinaryFunctions(const char* representation) const
+{
+  const Entry& entry = get(representation);
+  ASSERT(entry.binary);
+  return *entry.binary;
+}
+
 void Blackboard::free(const char* representation)
 {
   Entry& entry = get(representation);
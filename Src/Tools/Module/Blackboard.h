@@ -8,11 +8,11 @@
 
 #pragma once
 
+#include "Tools/Debugging/AllocationTracker.h"
+#include "Tools/Streams/BinaryCoding.h"
 #include <memory>
 #include <functional>
 
-class Streamable;
-
 /**
  * Helper class to check whether a type has an accessible serialize method.
  */
@@ -31,6 +31,7 @@ private:
     std::unique_ptr<Streamable> data; /**< The representation. */
     int counter = 0; /**< How many modules requested its existance? */
     std::function<void(Streamable*)> reset;
+    const Streaming::BinaryFunctions* binary = nullptr; /**< Codes the representation in binary form. */
   };
 
   class Entries; /**< Type of the map for all entries. */
@@ -39,11 +40,12 @@ private:
 
   /**
    * Set the blackboard instance of a process.
-   * Only Process::setGlobals calls this method.
+   * Only Process::setGlobals and the worker threads of the ModuleScheduler call this method.
    * @param instance The blackboard of this process.
    */
   static void setInstance(Blackboard& instance);
   friend class Process;
+  friend class ModuleScheduler;
 
   /**
    * Retrieve the blackboard entry for the name of a representation.
@@ -54,6 +56,15 @@ private:
   Entry& get(const char* representation);
   const Entry& get(const char* representation) const;
 
+  /**
+   * Find the data of a representation if it exists.
+   * @param representation The name of the representation.
+   * @return The representation or nullptr if it was not allocated.
+   */
+  Streamable* find(const char* representation);
+
+  template<typename T> friend class BlackboardSlot;
+
 public:
   /**
    * The default constructor creates the blackboard and sets it as
@@ -87,18 +98,24 @@ public:
     Entry& entry = get(representation);
     if(entry.counter++ == 0)
     {
-      entry.data = std::make_unique<T>();
-      if(HasSerialize::test(dynamic_cast<T*>(&*entry.data)))
+      T* data;
+      {
+        AllocationTracker::Scope scope(AllocationTracker::registerAccount(representation));
+        data = new T;
+      }
+      entry.data.reset(data);
+      entry.binary = &Streaming::BinaryFunctions::get<T>();
+      if(HasSerialize::test(data))
         entry.reset = [](Streamable* data)
         {
-          dynamic_cast<T*>(data)->~T();
-          new (dynamic_cast<T*>(data)) T();
+          static_cast<T*>(data)->~T();
+          new (static_cast<T*>(data)) T();
         };
       else
         entry.reset = [](Streamable* data) {};
       ++version;
     }
-    return dynamic_cast<T&>(*entry.data);
+    return static_cast<T&>(*entry.data);
   }
 
   /**
@@ -125,6 +142,14 @@ public:
   Streamable& operator[](const char* representation);
   const Streamable& operator[](const char* representation) const;
 
+  /**
+   * Access the functions that code a representation of a certain
+   * name in binary form. The representation must already exist.
+   * @param representation The name of the representation.
+   * @return The functions for the type of the representation.
+   */
+  const Streaming::BinaryFunctions& getBinaryFunctions(const char* representation) const;
+
   /**
    * Return the current version.
    * It can be used to determine whether the configuration of the
@@ -140,3 +165,67 @@ public:
    */
   static Blackboard& getInstance();
 };
+
+/**
+ * A typed handle to a representation in the blackboard of the current process.
+ * The name of the representation is only looked up when the handle is accessed
+ * for the first time and after the configuration of the blackboard changed.
+ * Otherwise, the access only costs a comparison of the blackboard version.
+ * @param T The type of the representation.
+ */
+template<typename T> class BlackboardSlot
+{
+private:
+  const char* representation = nullptr; /**< The name of the representation. */
+  mutable Blackboard* blackboard = nullptr; /**< The blackboard the data was resolved in. */
+  mutable T* data = nullptr; /**< The representation or nullptr if it does not exist. */
+  mutable int version = -1; /**< The blackboard version the data was resolved for. */
+
+  /** Resolve the representation again if the blackboard changed since the last access. */
+  void resolve() const
+  {
+    Blackboard& instance = Blackboard::getInstance();
+    if(&instance != blackboard || instance.version != version)
+    {
+      Streamable* streamable = instance.find(representation);
+      data = streamable ? static_cast<T*>(streamable) : nullptr;
+      blackboard = &instance;
+      version = instance.version;
+    }
+  }
+
+public:
+  BlackboardSlot() = default;
+
+  /**
+   * Constructor.
+   * @param representation The name of the representation. The string must stay valid.
+   */
+  BlackboardSlot(const char* representation) : representation(representation) {}
+
+  /**
+   * Does the representation currently exist in the blackboard?
+   * @return Can the slot be dereferenced?
+   */
+  bool exists() const
+  {
+    resolve();
+    return data != nullptr;
+  }
+
+  /**
+   * Access the representation. It must exist.
+   * @return The representation.
+   */
+  T& operator*() const
+  {
+    resolve();
+    return *data;
+  }
+
+  T* operator->() const
+  {
+    resolve();
+    return data;
+  }
+};
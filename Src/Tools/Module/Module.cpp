@@ -5,6 +5,7 @@
  */
 
 #include "Module.h"
+#include "ParameterCache.h"
 #include "Tools/Streams/InStreams.h"
 
 ModuleBase* ModuleBase::first = nullptr;
@@ -23,9 +24,19 @@ void loadModuleParameters(Streamable& parameters, const char* moduleName, const
   }
   else
     name = fileName;
+#ifdef TARGET_ROBOT
+  if(ParameterCache::read(moduleName, name, parameters))
+    return;
+#endif
   InMapFile stream(name);
   if(stream.exists())
+  {
     stream >> parameters;
+#ifdef TARGET_ROBOT
+    if(!stream.hasErrors())
+      ParameterCache::write(moduleName, name, parameters);
+#endif
+  }
   else
     ASSERT(!failOnMissing);
 }
@@ -66,6 +66,13 @@ public:
 
   static const unsigned char numOfCategories = numOfCategorys;
 
+  /** How important is it that the providers of a module run in every frame? */
+  ENUM(CostClass,
+  {,
+    essential, /**< The providers are always executed. */
+    optional, /**< The providers may be skipped if the frame runs out of time. */
+  });
+
   class Info
   {
   public:
@@ -119,7 +126,9 @@ private:
   ModuleBase* next; /**< The next entry in the list of all modules. */
   const char* name; /**< The name of the module that can be created by this instance. */
   Category category; /**< The category of this module. */
+  CostClass costClass; /**< Can the providers of this module be skipped? */
   const Info* info; /**< Information about the requirements and provisions of the module. */
+  const char* const* uses; /**< The names of the representations used but not required. Terminated by nullptr. */
 
 protected:
   /**
@@ -133,9 +142,12 @@ public:
    * Constructor.
    * @param name The name of the module that can be created by this instance.
    * @param category The category of this module.
+   * @param info Information about the requirements and provisions of the module.
+   * @param uses The names of the representations used, terminated by nullptr.
+   * @param costClass Can the providers of this module be skipped?
    */
-  ModuleBase(const char* name, Category category, const Info* info) :
-    next(first), name(name), category(category), info(info)
+  ModuleBase(const char* name, Category category, const Info* info, const char* const* uses, CostClass costClass = essential) :
+    next(first), name(name), category(category), costClass(costClass), info(info), uses(uses)
   {
     first = this;
   }
@@ -175,9 +187,10 @@ public:
    * and it is used to do the registration of the information required.
    * @param name The name of the module that can be created by this instance.
    * @param category The category of this module.
+   * @param costClass Can the providers of this module be skipped?
    */
-  Module(const char* name, Category category) :
-    ModuleBase(name, category, B::getModuleInfo())
+  Module(const char* name, Category category, CostClass costClass = essential) :
+    ModuleBase(name, category, B::getModuleInfo(), B::getModuleUses(), costClass)
   {}
 };
 
@@ -418,6 +431,19 @@ void loadModuleParameters(Streamable& parameters, const char* moduleName, const
 #define _MODULE_INFO__MODULE_DEFINES_PARAMETERS(...)
 #define _MODULE_INFO__MODULE_LOADS_PARAMETERS(...)
 
+/**
+ * The following macros generate the list of the names of all representations
+ * that are used. They filter out all other macros.
+ * @param x The type name of a representation or the set of all parameters.
+ */
+#define _MODULE_USED(x) _MODULE_JOIN(_MODULE_USED_, x)
+#define _MODULE_USED_PROVIDES(type)
+#define _MODULE_USED_PROVIDES_WITHOUT_MODIFY(type)
+#define _MODULE_USED_REQUIRES(type)
+#define _MODULE_USED_USES(type) #type,
+#define _MODULE_USED__MODULE_DEFINES_PARAMETERS(...)
+#define _MODULE_USED__MODULE_LOADS_PARAMETERS(...)
+
 /**
  * Assign message id for a representation.
  * @param type The type of the representation the id of which is assigned.
@@ -456,14 +482,14 @@ void loadModuleParameters(Streamable& parameters, const char* moduleName, const
  * @param n The number of entries in the third parameter.
  * @param ... The requirements, provided representations and parameter definitions.
  */
-#define _MODULE_I(name, n, ...) _MODULE_II(name, n, (_MODULE_PARAMETERS, __VA_ARGS__), (_MODULE_LOAD, __VA_ARGS__), (_MODULE_DECLARE, __VA_ARGS__), (_MODULE_FREE, __VA_ARGS__), (_MODULE_INFO, __VA_ARGS__))
+#define _MODULE_I(name, n, ...) _MODULE_II(name, n, (_MODULE_PARAMETERS, __VA_ARGS__), (_MODULE_LOAD, __VA_ARGS__), (_MODULE_DECLARE, __VA_ARGS__), (_MODULE_FREE, __VA_ARGS__), (_MODULE_INFO, __VA_ARGS__), (_MODULE_USED, __VA_ARGS__))
 
 /**
  * Generates the actual code of the module's base class.
  * It create all the code and fills in data from the requirements, representations,
  * provided, and parameters defined.
  */
-#define _MODULE_II(name, n, params, load, declare, free, info) \
+#define _MODULE_II(name, n, params, load, declare, free, info, used) \
   namespace name##Module \
   { \
     _MODULE_ATTR_##n params \
@@ -489,6 +515,15 @@ void loadModuleParameters(Streamable& parameters, const char* moduleName, const
       }; \
       return infos; \
     } \
+    static const char* const* getModuleUses() \
+    { \
+      static const char* const uses[] = \
+      { \
+        _MODULE_ATTR_##n used \
+        nullptr \
+      }; \
+      return uses; \
+    } \
     friend class Module<name, name##Base>; \
     _MODULE_ATTR_##n declare \
   public: \
@@ -534,3 +569,14 @@ void loadModuleParameters(Streamable& parameters, const char* moduleName, const
  */
 #define MAKE_MODULE(module, category) \
   Module<module, module##Base> the##module##Module(#module, ModuleBase::category);
+
+/**
+ * The macro creates a creator for a module whose providers can be skipped if
+ * the frame runs out of time. In that case, the representations provided are
+ * reset to their default state, i.e. they contain no percepts.
+ * It has to be part of the implementation file.
+ * @param module The name of the module that can be created.
+ * @param category The category of this module.
+ */
+#define MAKE_OPTIONAL_MODULE(module, category) \
+  Module<module, module##Base> the##module##Module(#module, ModuleBase::category, ModuleBase::optional);
@@ -5,10 +5,14 @@
  */
 
 #include "ModuleManager.h"
+#include "ParameterCache.h"
 #include "Platform/BHAssert.h"
 #include "Platform/Time.h"
+#include "Tools/Debugging/DebugDrawings.h"
+#include "Tools/FrameArena.h"
 #include <algorithm>
 #include <map>
+#include <unordered_map>
 
 ModuleManager::Configuration::RepresentationProvider::RepresentationProvider(const std::string& representation,
                                                                              const std::string& provider) :
@@ -153,6 +157,7 @@ void ModuleManager::update(In& stream, unsigned timeStamp)
   std::string representation,
               module;
 
+  schedule.clear(); // refers to the providers that are replaced now
   providers.clear();
   sent.clear();
   received.clear();
@@ -189,6 +194,8 @@ void ModuleManager::update(In& stream, unsigned timeStamp)
             if(i->update && rp.representation == i->representation)
             {
               providers.push_back(Provider(i->representation, &m, i->update));
+              if(m.module->costClass == ModuleBase::optional)
+                providers.back().skippedName = skippedNames.insert(std::string("skipped:") + i->representation).first->c_str();
               break;
             }
           m.required = true;
@@ -300,6 +307,8 @@ void ModuleManager::rollBack(const std::list<Provider>& providers, const std::li
   this->received = received;
   for(auto& m : modules)
     m.required = m.requiredBackup;
+  if(timeStamp)
+    createSchedule();
 }
 
 void ModuleManager::load()
@@ -315,42 +324,62 @@ void ModuleManager::load()
 
 void ModuleManager::execute()
 {
-  // Execute all providers in the given sequence
-  for(auto& p : providers)
-    if(p.moduleState->required)
-    {
-      if(!p.moduleState->instance)
-        p.moduleState->instance = p.moduleState->module->createNew();
-#ifdef TARGET_ROBOT
-      unsigned timeStamp = Time::getCurrentSystemTime();
-#endif
-      if(p.moduleState->instance)
-        p.update(*p.moduleState->instance);
-#ifdef TARGET_ROBOT
-      int duration = Time::getTimeSince(timeStamp);
-      if(timeStamp > 20000 &&
-         ((duration > 100 &&
-           !Global::getDebugRequestTable().isActive("representation:JPEGImage") &&
-           !Global::getDebugRequestTable().isActive("representation:Image")) ||
-          duration > 500))
-        TRACE("TIMING: providing %s took %d ms at %d s after start",
-              p.representation, duration, timeStamp / 1000 - 10);
-#endif
-    }
+  frameStart = Time::getRealSystemTime();
+  numOfSkippedProviders = 0;
+  for(const auto& m : modules)
+    AllocationTracker::resetAllocations(m.allocationAccount);
+
+  // Execute all providers in the given sequence or in parallel based on their dependencies
+  if(timeStamp && !schedule.empty())
+    scheduler.execute([this](size_t i) {execute(*schedule[i]);});
+  else
+    for(auto& p : providers)
+      if(p.moduleState->required)
+        execute(p);
   BH_TRACE;
+  DECLARE_PLOT("module:ModuleManager:skippedProviders");
+  PLOT("module:ModuleManager:skippedProviders", static_cast<unsigned>(numOfSkippedProviders));
 
   if(!timeStamp) // Configuration changed recently?
   {
     // all representations must be constructed now, so we can receive data
     timeStamp = nextTimeStamp;
     toSend.clear();
+    toSendBinary.clear();
     for(const auto& s : sent)
+    {
       toSend.push_back(&Blackboard::getInstance()[s]);
+      toSendBinary.push_back(&Blackboard::getInstance().getBinaryFunctions(s));
+    }
     toReceive.clear();
+    toReceiveBinary.clear();
     for(const auto& r : received)
+    {
       toReceive.push_back(&Blackboard::getInstance()[r]);
+      toReceiveBinary.push_back(&Blackboard::getInstance().getBinaryFunctions(r));
+    }
+
+    // all providers allocated their representations, so they can run in parallel from now on
+    createSchedule();
+
+    // all modules loaded their parameters, so the ones read from configuration files can be cached
+    ParameterCache::flush();
   }
 
+  DEBUG_RESPONSE_ONCE("module:ModuleManager:allocations")
+    outputAllocations();
+
+  DEBUG_RESPONSE_ONCE("module:ModuleManager:constructionTimes")
+    outputConstructionTimes();
+
+  DEBUG_RESPONSE("module:ModuleManager:allocationFree")
+    for(const auto& m : modules)
+    {
+      const unsigned allocations = AllocationTracker::getStatistics(m.allocationAccount).allocations;
+      if(allocations)
+        OUTPUT_WARNING(m.module->name << " allocated heap memory " << allocations << " times in this frame");
+    }
+
   DEBUG_RESPONSE_ONCE("automated requests:ModuleTable")
   {
     Global::getDebugOut().bin << static_cast<unsigned>(modules.size());
@@ -382,6 +411,151 @@ void ModuleManager::execute()
   }
 }
 
+void ModuleManager::execute(Provider& p)
+{
+  if(p.skippedName && p.executed && config.frameBudget
+     && static_cast<float>(Time::getRealTimeSince(frameStart)) + p.averageDuration > static_cast<float>(config.frameBudget))
+  {
+    // Reusing the previous result could mix up images of different cameras, so the representation is emptied instead.
+    Blackboard::getInstance().reset(p.representation);
+    Global::getTimingManager().startTiming(p.skippedName);
+    Global::getTimingManager().stopTiming(p.skippedName);
+    ++numOfSkippedProviders;
+    return;
+  }
+
+  AllocationTracker::Scope scope(p.moduleState->allocationAccount);
+  FrameArena::reset();
+  if(!p.moduleState->instance)
+  {
+    const unsigned constructionStart = Time::getRealSystemTime();
+    p.moduleState->instance = p.moduleState->module->createNew();
+    p.moduleState->constructionTime = Time::getRealTimeSince(constructionStart);
+  }
+  unsigned timeStamp = Time::getRealSystemTime();
+  if(p.moduleState->instance)
+    p.update(*p.moduleState->instance);
+  int duration = Time::getRealTimeSince(timeStamp);
+  p.averageDuration = p.executed ? 0.9f * p.averageDuration + 0.1f * static_cast<float>(duration) : static_cast<float>(duration);
+  p.executed = true;
+#ifdef TARGET_ROBOT
+  if(timeStamp > 20000 &&
+     ((duration > 100 &&
+       !Global::getDebugRequestTable().isActive("representation:JPEGImage") &&
+       !Global::getDebugRequestTable().isActive("representation:Image")) ||
+      duration > 500))
+    TRACE("TIMING: providing %s took %d ms at %d s after start",
+          p.representation, duration, timeStamp / 1000 - 10);
+#endif
+}
+
+void ModuleManager::outputAllocations() const
+{
+  std::vector<std::pair<const char*, AllocationTracker::Statistics>> accounts;
+  accounts.emplace_back("other", AllocationTracker::getStatistics(0));
+  for(const auto& m : modules)
+    accounts.emplace_back(m.module->name, AllocationTracker::getStatistics(m.allocationAccount));
+  for(const auto& p : providers)
+    if(p.moduleState->required)
+      accounts.emplace_back(p.representation, AllocationTracker::getStatistics(AllocationTracker::registerAccount(p.representation)));
+  std::sort(accounts.begin(), accounts.end(), [](const std::pair<const char*, AllocationTracker::Statistics>& a,
+                                                 const std::pair<const char*, AllocationTracker::Statistics>& b)
+  {
+    return a.second.liveBytes > b.second.liveBytes;
+  });
+
+  OUTPUT_TEXT("account: live bytes, peak bytes, allocations (modules: in this frame, others: in total)");
+  for(const auto& account : accounts)
+    if(account.second.peakBytes)
+      OUTPUT_TEXT(account.first << ": " << static_cast<unsigned>(account.second.liveBytes) << ", "
+                  << static_cast<unsigned>(account.second.peakBytes) << ", " << account.second.allocations);
+}
+
+void ModuleManager::outputConstructionTimes() const
+{
+  std::vector<const ModuleState*> constructed;
+  for(const auto& m : modules)
+    if(m.instance)
+      constructed.push_back(&m);
+  std::sort(constructed.begin(), constructed.end(), [](const ModuleState* a, const ModuleState* b)
+  {
+    return a->constructionTime > b->constructionTime;
+  });
+
+  int total = 0;
+  for(const ModuleState* m : constructed)
+    total += m->constructionTime;
+  OUTPUT_TEXT("module: construction time in ms (total: " << total << ")");
+  for(const ModuleState* m : constructed)
+    OUTPUT_TEXT(m->module->name << ": " << m->constructionTime);
+}
+
+void ModuleManager::createSchedule()
+{
+  schedule.clear();
+#if defined TARGET_ROBOT && defined NDEBUG
+  scheduler.setNumOfThreads(config.numOfWorkerThreads);
+#else
+  // Debugging infrastructure such as debug requests and drawings is not thread-safe.
+  if(config.numOfWorkerThreads)
+    OUTPUT_WARNING("Providers are only executed in parallel in Release builds on the robot.");
+  scheduler.setNumOfThreads(0);
+#endif
+  if(!scheduler.getNumOfThreads())
+    return;
+
+  std::unordered_map<std::string, size_t> providerIndex;
+  for(auto& p : providers)
+    if(p.moduleState->required)
+    {
+      providerIndex[p.representation] = schedule.size();
+      schedule.push_back(&p);
+    }
+
+  std::vector<std::vector<size_t>> dependencies(schedule.size());
+  auto addDependency = [&dependencies](size_t first, size_t second)
+  {
+    if(std::find(dependencies[second].begin(), dependencies[second].end(), first) == dependencies[second].end())
+      dependencies[second].push_back(first);
+  };
+
+  for(size_t i = 0; i < schedule.size(); ++i)
+  {
+    const ModuleState* moduleState = schedule[i]->moduleState;
+
+    // Providers of the same module share its instance.
+    for(size_t j = i; j-- > 0;)
+      if(schedule[j]->moduleState == moduleState)
+      {
+        addDependency(j, i);
+        break;
+      }
+
+    for(const ModuleBase::Info* j = moduleState->module->info; j->representation; ++j)
+      if(!j->update)
+      {
+        auto k = providerIndex.find(j->representation);
+        if(k != providerIndex.end() && k->second < i)
+          addDependency(k->second, i);
+      }
+
+    // Used representations must keep the value they would have had in sequential execution.
+    for(const char* const* j = moduleState->module->uses; *j; ++j)
+    {
+      auto k = providerIndex.find(*j);
+      if(k != providerIndex.end() && k->second != i)
+      {
+        if(k->second < i)
+          addDependency(k->second, i);
+        else
+          addDependency(i, k->second);
+      }
+    }
+  }
+
+  scheduler.setTasks(dependencies);
+}
+
 void ModuleManager::readPackage(In& stream)
 {
   unsigned timeStamp;
@@ -400,3 +574,27 @@ void ModuleManager::writePackage(Out& stream) const
   for(const Streamable* s : toSend)
     stream << *s;
 }
+
+void ModuleManager::codePackage(Streaming::BinarySizer& coder) const
+{
+  coder.code(&timeStamp, sizeof(timeStamp));
+  for(size_t i = 0; i < toSend.size(); ++i)
+    toSendBinary[i]->size(coder, *toSend[i]);
+}
+
+void ModuleManager::codePackage(Streaming::BinaryWriter& coder) const
+{
+  coder.code(&timeStamp, sizeof(timeStamp));
+  for(size_t i = 0; i < toSend.size(); ++i)
+    toSendBinary[i]->write(coder, *toSend[i]);
+}
+
+void ModuleManager::codePackage(Streaming::BinaryReader& coder)
+{
+  unsigned timeStamp;
+  coder.code(&timeStamp, sizeof(timeStamp));
+  // Communication is only possible if both sides are based on the same module request.
+  if(timeStamp == this->timeStamp)
+    for(size_t i = 0; i < toReceive.size(); ++i)
+      toReceiveBinary[i]->read(coder, *toReceive[i]);
+}
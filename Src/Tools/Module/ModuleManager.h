@@ -7,7 +7,10 @@
 #pragma once
 
 #include "Module.h"
+#include "ModuleScheduler.h"
+#include "Tools/Debugging/AllocationTracker.h"
 #include "Tools/Streams/AutoStreamable.h"
+#include <atomic>
 #include <list>
 #include <set>
 #include <vector>
@@ -29,12 +32,14 @@ private:
     Streamable* instance = nullptr; /**< A pointer to the instance of the module if it was created. Otherwise the pointer is 0. */
     bool required = false; /**< A flag that is required when determining whether a module is currently required or not. */
     bool requiredBackup; /**< Temporary backup of "required" */
+    unsigned allocationAccount; /**< The account that is charged for the heap allocations of the module. */
+    int constructionTime = 0; /**< The time it took to create the instance, including loading its parameters (in ms). */
 
     /**
      * Constructor.
      * @param module A pointer to the module base that is able to create an instance of the module.
      */
-    ModuleState(ModuleBase* module) : module(module) {}
+    ModuleState(ModuleBase* module) : module(module), allocationAccount(AllocationTracker::registerAccount(module->name)) {}
 
     /**
      * Comparison operator. Only uses the name for comparison.
@@ -53,6 +58,9 @@ private:
     const char* representation; /**< The representation that will be provided. */
     ModuleState* moduleState; /**< The moduleState that will give access to the module that provides the information. */
     void (*update)(Streamable&); /**< The update handler within the module. */
+    const char* skippedName = nullptr; /**< The name of the stopwatch reporting that an optional provider was skipped. nullptr if it is essential. */
+    float averageDuration = 0.f; /**< The smoothed duration of the provider in ms. */
+    bool executed = false; /**< Was the provider executed at least once? */
 
     /**
      * Constructor.
@@ -95,6 +103,8 @@ public:
     }),
 
     (std::vector<RepresentationProvider>) representationProviders,
+    (unsigned)(0) numOfWorkerThreads, /**< The number of additional threads executing independent providers in parallel. 0 executes all providers sequentially. */
+    (unsigned)(0) frameBudget, /**< Optional providers are skipped if they probably would not finish within this many ms after the frame started. 0 never skips any. */
   });
 
 private:
@@ -106,8 +116,15 @@ private:
   std::list<const char*> received; /**< The list of all names of representations received from the other process */
   std::vector<Streamable*> toSend; /**< The list of all representations sent to the other process */
   std::vector<Streamable*> toReceive; /**< The list of all representations received from the other process */
+  std::vector<const Streaming::BinaryFunctions*> toSendBinary; /**< The functions that code the representations in toSend in binary form. */
+  std::vector<const Streaming::BinaryFunctions*> toReceiveBinary; /**< The functions that code the representations in toReceive in binary form. */
   unsigned timeStamp = 0; /**< The timestamp of the last module request. Communication is only possible if both sides use the same timestamp. */
   unsigned nextTimeStamp = 0; /**< The next timestamp used to verify communication. */
+  ModuleScheduler scheduler; /**< Executes the providers in parallel if worker threads are configured. */
+  std::vector<Provider*> schedule; /**< The providers in the order of the tasks of the scheduler. */
+  std::set<std::string> skippedNames; /**< Storage for the names used when reporting skipped providers. */
+  unsigned frameStart = 0; /**< The real system time when the execution of the providers started in the current frame. */
+  std::atomic<unsigned> numOfSkippedProviders{0}; /**< The number of optional providers skipped in the current frame. */
 
 public:
   /**
@@ -160,6 +177,17 @@ public:
    */
   void writePackage(Out& stream) const;
 
+  /**
+   * The methods code a package in binary form. Other than readPackage and
+   * writePackage, they do not use the streams for representations that can
+   * be coded statically. The data is the same.
+   * @param coder The coder that determines the size of the package, writes it,
+   *              or reads it.
+   */
+  void codePackage(Streaming::BinarySizer& coder) const;
+  void codePackage(Streaming::BinaryWriter& coder) const;
+  void codePackage(Streaming::BinaryReader& coder);
+
 private:
   /**
    * Find information about a representation provided or required by a certain module.
@@ -200,6 +228,33 @@ private:
    */
   bool sortProviders(const std::list<std::string>& providedByDefault);
 
+  /**
+   * The method determines which providers depend on each other and passes the
+   * resulting graph to the scheduler. A provider depends on the providers of the
+   * representations it requires, on the earlier providers of the same module,
+   * and on the providers that write or read a representation it uses in the
+   * order in which they would be executed sequentially.
+   */
+  void createSchedule();
+
+  /**
+   * The method executes a single provider. An optional provider is skipped
+   * if it probably would not finish within the frame budget.
+   * @param provider The provider that is executed.
+   */
+  void execute(Provider& provider);
+
+  /**
+   * Prints the heap usage of the modules and representations of this process
+   * as well as that of all code outside modules.
+   */
+  void outputAllocations() const;
+
+  /**
+   * The method prints the time it took to construct each module instance, longest first.
+   */
+  void outputConstructionTimes() const;
+
   /**
    * The method restores a previous module configuration.
    * It is called after it was determined that the new configuration is invalid.
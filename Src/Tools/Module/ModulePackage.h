@@ -16,6 +16,17 @@ struct ModulePackage
 {
   ModuleManager* moduleManager = nullptr; /**< A pointer to the module manager. It knows the actual data to be streamed. */
   unsigned timeStamp = 0; /**< The time stamp of the package. */
+
+  /**
+   * Codes the package in binary form. The data is the same as the one
+   * streamed by the operators below.
+   * @param coder A BinarySizer, a BinaryWriter or a BinaryReader.
+   */
+  template<typename Coder> void serializeBinary(Coder& coder)
+  {
+    Streaming::codeBinary(coder, timeStamp);
+    moduleManager->codePackage(coder);
+  }
 };
 
 /**
@@ -46,5 +57,5 @@ inline In& operator>>(In& stream, ModulePackage& modulePackage)
   return stream;
 }
 
-class CognitionToMotion : public ModulePackage {};
-class MotionToCognition : public ModulePackage {};
+class CognitionToMotion : public ModulePackage {public: using BinaryCoded = CognitionToMotion;};
+class MotionToCognition : public ModulePackage {public: using BinaryCoded = MotionToCognition;};
@@ -0,0 +1,127 @@
+/**
+ * @file ModuleScheduler.cpp
+ * Implementation of a class that executes the providers of a process in parallel
+ * while maintaining the dependencies between them.
+ */
+
+#include "ModuleScheduler.h"
+#include "Blackboard.h"
+#include "Platform/BHAssert.h"
+#include "Tools/Global.h"
+#include <chrono>
+
+ModuleScheduler::~ModuleScheduler()
+{
+  setNumOfThreads(0);
+}
+
+void ModuleScheduler::setNumOfThreads(unsigned numOfThreads)
+{
+  if(numOfThreads == workers.size())
+    return;
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopping = true;
+  }
+  changed.notify_all();
+  workers.clear(); // Thread's destructor waits for termination
+  stopping = false;
+
+  globals.annotationManager = Global::theAnnotationManager;
+  globals.debugOut = Global::theDebugOut;
+  globals.teamOut = Global::theTeamOut;
+  globals.settings = Global::theSettings;
+  globals.debugRequestTable = Global::theDebugRequestTable;
+  globals.debugDataTable = Global::theDebugDataTable;
+  globals.streamHandler = Global::theStreamHandler;
+  globals.drawingManager = Global::theDrawingManager;
+  globals.drawingManager3D = Global::theDrawingManager3D;
+  globals.timingManager = Global::theTimingManager;
+  globals.blackboard = &Blackboard::getInstance();
+
+  for(unsigned i = 0; i < numOfThreads; ++i)
+  {
+    workers.emplace_back(new Thread);
+    workers.back()->start(this, &ModuleScheduler::work);
+  }
+}
+
+void ModuleScheduler::setTasks(const std::vector<std::vector<size_t>>& dependencies)
+{
+  successors.clear();
+  successors.resize(dependencies.size());
+  numOfPredecessors.resize(dependencies.size());
+  for(size_t i = 0; i < dependencies.size(); ++i)
+  {
+    numOfPredecessors[i] = static_cast<unsigned>(dependencies[i].size());
+    for(size_t j : dependencies[i])
+    {
+      ASSERT(j < i);
+      successors[j].push_back(i);
+    }
+  }
+}
+
+void ModuleScheduler::execute(const std::function<void(size_t)>& task)
+{
+  std::unique_lock<std::mutex> lock(mutex);
+  this->task = &task;
+  remaining = numOfPredecessors;
+  finished = 0;
+  for(size_t i = 0; i < remaining.size(); ++i)
+    if(!remaining[i])
+      ready.push_back(i);
+  changed.notify_all();
+
+  while(finished < remaining.size())
+    if(ready.empty())
+      changed.wait(lock);
+    else
+      runNext(lock);
+
+  this->task = nullptr;
+}
+
+void ModuleScheduler::runNext(std::unique_lock<std::mutex>& lock)
+{
+  const size_t index = ready.front();
+  ready.pop_front();
+  const std::function<void(size_t)>& task = *this->task;
+  lock.unlock();
+  task(index);
+  lock.lock();
+
+  bool notify = ++finished == remaining.size();
+  for(size_t successor : successors[index])
+    if(--remaining[successor] == 0)
+    {
+      ready.push_back(successor);
+      notify = true;
+    }
+  if(notify)
+    changed.notify_all();
+}
+
+void ModuleScheduler::work()
+{
+  Thread::nameThread("ModuleWorker");
+  Global::theAnnotationManager = globals.annotationManager;
+  Global::theDebugOut = globals.debugOut;
+  Global::theTeamOut = globals.teamOut;
+  Global::theSettings = globals.settings;
+  Global::theDebugRequestTable = globals.debugRequestTable;
+  Global::theDebugDataTable = globals.debugDataTable;
+  Global::theStreamHandler = globals.streamHandler;
+  Global::theDrawingManager = globals.drawingManager;
+  Global::theDrawingManager3D = globals.drawingManager3D;
+  Global::theTimingManager = globals.timingManager;
+  Blackboard::setInstance(*globals.blackboard);
+
+  std::unique_lock<std::mutex> lock(mutex);
+  while(!stopping)
+    if(ready.empty())
+      changed.wait_for(lock, std::chrono::milliseconds(100));
+    else
+      runNext(lock);
+}
@@ -0,0 +1,106 @@
+/**
+ * @file ModuleScheduler.h
+ * Declaration of a class that executes the providers of a process in parallel
+ * while maintaining the dependencies between them.
+ */
+
+#pragma once
+
+#include "Platform/Thread.h"
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+class AnnotationManager;
+class Blackboard;
+class DebugDataTable;
+class DebugRequestTable;
+class DrawingManager;
+class DrawingManager3D;
+class OutMessage;
+class StreamHandler;
+class TimingManager;
+struct Settings;
+
+/**
+ * @class ModuleScheduler
+ * The class executes a directed acyclic graph of tasks on a small pool of
+ * threads. The thread calling execute() participates in executing the tasks.
+ * A task is only started after all its predecessors were finished, so the
+ * results are the same as when executing all tasks in a topological order.
+ */
+class ModuleScheduler
+{
+private:
+  /** The process-wide instances that are made available to the worker threads. */
+  struct Globals
+  {
+    AnnotationManager* annotationManager;
+    OutMessage* debugOut;
+    OutMessage* teamOut;
+    Settings* settings;
+    DebugRequestTable* debugRequestTable;
+    DebugDataTable* debugDataTable;
+    StreamHandler* streamHandler;
+    DrawingManager* drawingManager;
+    DrawingManager3D* drawingManager3D;
+    TimingManager* timingManager;
+    Blackboard* blackboard;
+  };
+
+  std::vector<std::vector<size_t>> successors; /**< For each task, the tasks that depend on it. */
+  std::vector<unsigned> numOfPredecessors; /**< For each task, the number of tasks it depends on. */
+  std::vector<unsigned> remaining; /**< For each task, the number of predecessors that are not finished yet in this run. */
+  std::deque<size_t> ready; /**< The tasks that can be executed now. */
+  size_t finished = 0; /**< The number of tasks finished in this run. */
+  const std::function<void(size_t)>* task = nullptr; /**< The function executing a task during a run. */
+  std::mutex mutex; /**< Protects all attributes shared with the worker threads. */
+  std::condition_variable changed; /**< Signals that tasks became ready or all tasks are finished. */
+  std::vector<std::unique_ptr<Thread>> workers; /**< The worker threads. */
+  bool stopping = false; /**< Should the worker threads terminate? */
+  Globals globals; /**< The instances of the process that started the workers. */
+
+  /** The main function of a worker thread. */
+  void work();
+
+  /**
+   * Execute a task and mark successors as ready that have no pending predecessors anymore.
+   * The mutex must be locked when calling this method. It is temporarily released
+   * while the task is executed.
+   * @param lock The lock that holds the mutex.
+   */
+  void runNext(std::unique_lock<std::mutex>& lock);
+
+public:
+  /** Destructor. Stops all worker threads. */
+  ~ModuleScheduler();
+
+  /**
+   * Set the number of worker threads used. The workers are (re)started
+   * and receive the process-wide instances of the calling thread.
+   * @param numOfThreads The number of additional threads. 0 stops all workers.
+   */
+  void setNumOfThreads(unsigned numOfThreads);
+
+  /**
+   * Return the number of worker threads.
+   * @return The number of additional threads executing tasks.
+   */
+  unsigned getNumOfThreads() const {return static_cast<unsigned>(workers.size());}
+
+  /**
+   * Define the graph of tasks.
+   * @param dependencies For each task, the indices of the tasks it depends on.
+   *                     All indices must be smaller than the index of the task itself.
+   */
+  void setTasks(const std::vector<std::vector<size_t>>& dependencies);
+
+  /**
+   * Execute all tasks once.
+   * @param task The function that is called with the index of each task.
+   */
+  void execute(const std::function<void(size_t)>& task);
+};
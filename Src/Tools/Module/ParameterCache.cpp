@@ -0,0 +1,235 @@
+/**
+ * @file ParameterCache.cpp
+ * Implementation of a cache that stores module parameters read from
+ * configuration files in binary form.
+ */
+
+#include "ParameterCache.h"
+#include "Platform/File.h"
+#include "Tools/Streams/InStreams.h"
+#include "Tools/Streams/OutStreams.h"
+#include "Tools/Streams/Streamable.h"
+#include <cstdio>
+#include <mutex>
+#include <sys/stat.h>
+#include <unordered_map>
+#include <vector>
+
+/** Identifies the format of the cache file. */
+static const unsigned magic = 0x31435042; // "BPC1"
+
+namespace
+{
+  /** The identity of a file. */
+  struct FileId
+  {
+    std::string path; /**< The full path of the file. */
+    unsigned modified = 0; /**< The modification time of the file. */
+    unsigned size = 0; /**< The size of the file in bytes. */
+
+    bool operator==(const FileId& other) const {return path == other.path && modified == other.modified && size == other.size;}
+    bool operator!=(const FileId& other) const {return !(*this == other);}
+  };
+
+  /** An entry of the cache. */
+  struct Entry
+  {
+    FileId source; /**< The configuration file the parameters were read from. */
+    std::vector<char> data; /**< The parameters in binary form. */
+  };
+
+  /** The cache of the parameters of all modules. */
+  class Cache
+  {
+  private:
+    std::unordered_map<std::string, Entry> entries; /**< The parameters per module and name of the configuration file. */
+    std::string path; /**< The path of the cache file. */
+    bool loaded = false; /**< Was the cache file already read? */
+    bool changed = false; /**< Were entries added since the cache file was written? */
+
+    /**
+     * Writes the header of the cache file and all entries known.
+     * The file is replaced as a whole, so it is never left incomplete.
+     */
+    void save()
+    {
+      const std::string tempPath = path + ".tmp";
+      {
+        OutBinaryFile stream(tempPath);
+        if(!stream.exists())
+          return;
+        stream << magic << executable.path << executable.modified << executable.size;
+        for(const auto& entry : entries)
+        {
+          stream << entry.first << entry.second.source.path << entry.second.source.modified
+                 << entry.second.source.size << static_cast<unsigned>(entry.second.data.size());
+          stream.write(entry.second.data.data(), entry.second.data.size());
+        }
+      }
+      std::rename(tempPath.c_str(), path.c_str());
+    }
+
+    /** Reads the cache file if it was written by the same executable. */
+    void load()
+    {
+      loaded = true;
+      if(executable.path.empty())
+        return;
+      path = std::string(File::getBHDir()) + "/Config/parameters.cache";
+
+      File file(path, "rb", false);
+      if(!file.exists())
+        return;
+      std::vector<char> buffer(file.getSize());
+      file.read(buffer.data(), buffer.size());
+
+      InBinaryMemory stream(buffer.data(), buffer.size());
+      unsigned fileMagic = 0;
+      FileId writer;
+      if(buffer.size() >= sizeof(unsigned))
+        stream >> fileMagic;
+      if(fileMagic != magic)
+        return;
+      stream >> writer.path >> writer.modified >> writer.size;
+      if(writer != executable)
+        return;
+
+      while(!stream.eof())
+      {
+        std::string key;
+        Entry entry;
+        unsigned size;
+        stream >> key >> entry.source.path >> entry.source.modified >> entry.source.size >> size;
+        entry.data.resize(size);
+        stream.read(entry.data.data(), size);
+        entries[key] = std::move(entry);
+      }
+    }
+
+  public:
+    std::mutex mutex; /**< The cache is shared by all threads. */
+    FileId executable; /**< The executable that is running. Its path is empty if it is unknown. */
+
+    Cache()
+    {
+#ifdef LINUX
+      executable = identify("/proc/self/exe");
+#endif
+    }
+
+    /** Parameters loaded after the last flush are stored when the process ends. */
+    ~Cache() {flush();}
+
+    /**
+     * Determines the identity of a file.
+     * @param path The full path of the file.
+     * @return The identity. Its path is empty if the file does not exist.
+     */
+    static FileId identify(const std::string& path)
+    {
+      FileId id;
+      struct stat buffer;
+      if(!stat(path.c_str(), &buffer))
+      {
+        id.path = path;
+        id.modified = static_cast<unsigned>(buffer.st_mtime);
+        id.size = static_cast<unsigned>(buffer.st_size);
+      }
+      return id;
+    }
+
+    /**
+     * Determines the identity of the configuration file that would be read.
+     * @param name The name of the configuration file.
+     * @return The identity. Its path is empty if no file would be found.
+     */
+    static FileId resolve(const std::string& name)
+    {
+      for(const std::string& path : File::getFullNames(name))
+      {
+        FileId id = identify(path);
+        if(!id.path.empty())
+          return id;
+      }
+      return FileId();
+    }
+
+    /**
+     * Returns the entry of a configuration file.
+     * @param key The name of the module and the name of the configuration file.
+     * @return The entry or nullptr if there is none.
+     */
+    const Entry* find(const std::string& key)
+    {
+      if(!loaded)
+        load();
+      auto i = entries.find(key);
+      return i == entries.end() ? nullptr : &i->second;
+    }
+
+    /**
+     * Adds or replaces the entry of a configuration file. The cache file is
+     * only updated by flush().
+     * @param key The name of the module and the name of the configuration file.
+     * @param entry The entry.
+     */
+    void add(const std::string& key, Entry&& entry)
+    {
+      if(!loaded)
+        load();
+      if(!path.empty())
+      {
+        entries[key] = std::move(entry);
+        changed = true;
+      }
+    }
+
+    /** Writes the cache file if entries were added since it was written last. */
+    void flush()
+    {
+      if(changed)
+      {
+        save();
+        changed = false;
+      }
+    }
+  };
+
+  Cache cache;
+}
+
+bool ParameterCache::read(const char* moduleName, const std::string& name, Streamable& parameters)
+{
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  if(cache.executable.path.empty())
+    return false;
+  const Entry* entry = cache.find(std::string(moduleName) + ":" + name);
+  if(!entry || entry->source.path.empty() || entry->source != Cache::resolve(name))
+    return false;
+  InBinaryMemory stream(entry->data.data(), entry->data.size());
+  stream >> parameters;
+  return true;
+}
+
+void ParameterCache::write(const char* moduleName, const std::string& name, const Streamable& parameters)
+{
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  if(cache.executable.path.empty())
+    return;
+  Entry entry;
+  entry.source = Cache::resolve(name);
+  if(entry.source.path.empty())
+    return;
+  OutBinarySize size;
+  size << parameters;
+  entry.data.resize(size.getSize());
+  OutBinaryMemory stream(entry.data.data());
+  stream << parameters;
+  cache.add(std::string(moduleName) + ":" + name, std::move(entry));
+}
+
+void ParameterCache::flush()
+{
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  cache.flush();
+}
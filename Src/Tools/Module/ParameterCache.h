@@ -0,0 +1,51 @@
+/**
+ * @file ParameterCache.h
+ * Declaration of a cache that stores module parameters read from
+ * configuration files in binary form.
+ */
+
+#pragma once
+
+#include <string>
+
+class Streamable;
+
+/**
+ * @class ParameterCache
+ * Parsing the configuration files of all modules takes a noticeable part
+ * of the startup time. Therefore, the parameters are stored in binary form
+ * in a single file after they were read from their configuration files
+ * without errors. When they are requested again, e.g. after the next start,
+ * they are taken from that file as long as the configuration file that
+ * would be found now is still the same, i.e. it has the same path,
+ * modification time and size. In addition, the cache is only used by the
+ * same executable that wrote it, because the binary format depends on the
+ * declaration of the parameters.
+ */
+class ParameterCache
+{
+public:
+  /**
+   * Reads parameters from the cache.
+   * @param moduleName The name of the module the parameters belong to.
+   * @param name The name of the configuration file the parameters were read from.
+   * @param parameters The parameters that are read.
+   * @return Were the parameters found? Otherwise, they were not changed.
+   */
+  static bool read(const char* moduleName, const std::string& name, Streamable& parameters);
+
+  /**
+   * Writes parameters to the cache.
+   * @param moduleName The name of the module the parameters belong to.
+   * @param name The name of the configuration file the parameters were read from.
+   * @param parameters The parameters that are written.
+   */
+  static void write(const char* moduleName, const std::string& name, const Streamable& parameters);
+
+  /**
+   * Writes the cache file if parameters were added since it was written last.
+   * This should be called after all modules were constructed, so that the
+   * file is only written once and not for every module.
+   */
+  static void flush();
+};
@@ -15,71 +15,118 @@
 #include "Tools/Math/Pose3f.h"
 #include "Tools/Math/Rotation.h"
 
+namespace
+{
+  /**
+   * Computes the direction of the hip yaw pitch axis for a foot target,
+   * which is the second column of the rotation of the target combined
+   * with the ankle roll. The atan2 of its components is independent from
+   * its length, so no trigonometric functions are needed to determine it.
+   * @param target The foot target relative to the hip, rotated by +/-45°.
+   * @return The unnormalized direction.
+   */
+  Vector3f hipRotationC1(const Pose3f& target)
+  {
+    const Vector3f footToHip = target.rotation.transpose() * -target.translation;
+    if(footToHip.y() == 0.f && footToHip.z() == 0.f)
+      return target.rotation.col(1);
+    else
+      return target.rotation * Vector3f(0.f, footToHip.z(), -footToHip.y());
+  }
+
+  /**
+   * Computes the joint angles of one leg after its hip yaw pitch was applied.
+   * The rotations by the hip roll and the hip pitch are built directly from
+   * the components of the hip-to-foot vector instead of from their angles.
+   * @param hipToFoot The translation of the foot target relative to the hip.
+   * @param footRotationC2 The third column of the rotation of the foot target.
+   * @param h1 The length of the upper leg.
+   * @param h2 The length of the lower leg.
+   * @param angles The six joint angles of the leg starting with the hip roll.
+   *               The hip roll is returned without the +/-45° offset.
+   * @return Is the target position reachable?
+   */
+  bool calcLegJoints(const Vector3f& hipToFoot, const Vector3f& footRotationC2, float h1, float h2, Angle* angles)
+  {
+    const Rangef cosClipping = Rangef::OneRange();
+    const float yzSqr = sqr(hipToFoot.y()) + sqr(hipToFoot.z());
+    const float yz = std::sqrt(yzSqr);
+    const float hSqr = sqr(hipToFoot.x()) + yzSqr;
+    const float h = std::sqrt(hSqr);
+    const float pitchY = yz * -sgn(hipToFoot.z());
+
+    angles[0] = -std::atan2(-hipToFoot.y(), -hipToFoot.z());
+    const float joint2MinusAlpha = std::atan2(-hipToFoot.x(), pitchY);
+
+    // Rotate around the x-axis by -angles[0] and around the y-axis by -joint2MinusAlpha.
+    const float cosRoll = yz > 0.f ? -hipToFoot.z() / yz : 1.f;
+    const float sinRoll = yz > 0.f ? -hipToFoot.y() / yz : 0.f;
+    const float cosPitch = h > 0.f ? pitchY / h : 1.f;
+    const float sinPitch = h > 0.f ? hipToFoot.x() / h : 0.f;
+    const float y = cosRoll * footRotationC2.y() - sinRoll * footRotationC2.z();
+    const float z = sinRoll * footRotationC2.y() + cosRoll * footRotationC2.z();
+    const Vector3f c2(cosPitch * footRotationC2.x() + sinPitch * z, y, -sinPitch * footRotationC2.x() + cosPitch * z);
+
+    const float h1Sqr = h1 * h1;
+    const float h2Sqr = h2 * h2;
+    const float alpha = -std::acos(cosClipping.limit((h1Sqr + hSqr - h2Sqr) / (2.f * h1 * h)));
+    const float beta = -std::acos(cosClipping.limit((h2Sqr + hSqr - h1Sqr) / (2.f * h2 * h)));
+
+    angles[1] = joint2MinusAlpha + alpha;
+    angles[2] = -alpha - beta;
+    angles[3] = std::atan2(c2.x(), c2.z()) + beta;
+    angles[4] = std::asin(-c2.y());
+    return h <= h1 + h2;
+  }
+
+  /**
+   * Computes the joint angles of both legs.
+   * @param lTarget0 The target of the left foot relative to the left hip, rotated by -45° around the x-axis.
+   * @param rTarget0 The target of the right foot relative to the right hip, rotated by 45° around the x-axis.
+   * @param jointAngles The resulting joint angles.
+   * @param robotDimensions The robot dimensions.
+   * @param ratio The ratio between the left and right yaw angle.
+   * @return Are both target positions reachable?
+   */
+  bool calcLegJoints(const Pose3f& lTarget0, const Pose3f& rTarget0, JointAngles& jointAngles,
+                     const RobotDimensions& robotDimensions, float ratio)
+  {
+    Rangef::ZeroOneRange().clamp(ratio);
+
+    const Vector3f lHipRotationC1 = hipRotationC1(lTarget0);
+    const Vector3f rHipRotationC1 = hipRotationC1(rTarget0);
+    const float lMinusJoint0 = std::atan2(-lHipRotationC1.x(), lHipRotationC1.y());
+    const float rJoint0 = std::atan2(-rHipRotationC1.x(), rHipRotationC1.y());
+    const float lJoint0Combined = -lMinusJoint0 * ratio + rJoint0 * (1.f - ratio);
+
+    // The right leg is rotated in the opposite direction, i.e. by the transposed matrix.
+    const RotationMatrix rotZ = RotationMatrix::aroundZ(lJoint0Combined);
+    const Vector3f lHipToFoot = rotZ * lTarget0.translation;
+    const Vector3f rHipToFoot = rotZ.transpose() * rTarget0.translation;
+    const Vector3f lFootRotationC2 = rotZ * lTarget0.rotation.col(2);
+    const Vector3f rFootRotationC2 = rotZ.transpose() * rTarget0.rotation.col(2);
+
+    jointAngles.angles[Joints::lHipYawPitch] = lJoint0Combined;
+    jointAngles.angles[Joints::rHipYawPitch] = lJoint0Combined;
+    const bool lReachable = calcLegJoints(lHipToFoot, lFootRotationC2, robotDimensions.upperLegLength, robotDimensions.lowerLegLength,
+                                          &jointAngles.angles[Joints::lHipRoll]);
+    const bool rReachable = calcLegJoints(rHipToFoot, rFootRotationC2, robotDimensions.upperLegLength, robotDimensions.lowerLegLength,
+                                          &jointAngles.angles[Joints::rHipRoll]);
+    jointAngles.angles[Joints::lHipRoll] += pi_4;
+    jointAngles.angles[Joints::rHipRoll] -= pi_4;
+    return lReachable && rReachable;
+  }
+}
+
 bool InverseKinematic::calcLegJoints(const Pose3f& positionLeft, const Pose3f& positionRight, JointAngles& jointAngles,
                                      const RobotDimensions& robotDimensions, float ratio)
 {
   static const Pose3f rotPi_4 = RotationMatrix::aroundX(pi_4);
   static const Pose3f rotMinusPi_4 = RotationMatrix::aroundX(-pi_4);
-  const Rangef cosClipping = Rangef::OneRange();
-
-  Rangef::ZeroOneRange().clamp(ratio);
 
   const Pose3f lTarget0 = (rotMinusPi_4 + Vector3f(0.f, -robotDimensions.yHipOffset, 0.f)) *= positionLeft;
   const Pose3f rTarget0 = (rotPi_4 + Vector3f(0.f, robotDimensions.yHipOffset, 0.f)) *= positionRight;
-  const Vector3f lFootToHip = lTarget0.rotation.inverse() * -lTarget0.translation;
-  const Vector3f rFootToHip = rTarget0.rotation.inverse() * -rTarget0.translation;
-  const float lMinusJoint5 = std::atan2(lFootToHip.y(), lFootToHip.z());
-  const float rJoint5 = std::atan2(rFootToHip.y(), rFootToHip.z());
-  const float lMinusBetaAndJoint4 = -std::atan2(lFootToHip.x(), std::sqrt(sqr(lFootToHip.y()) + sqr(lFootToHip.z())));
-  const float rMinusBetaAndJoint4 = -std::atan2(rFootToHip.x(), std::sqrt(sqr(rFootToHip.y()) + sqr(rFootToHip.z())));
-  const Vector3f lHipRotationC1 = lTarget0.rotation * (RotationMatrix::aroundX(-lMinusJoint5) * RotationMatrix::aroundY(-lMinusBetaAndJoint4)).col(1);
-  const Vector3f rHipRotationC1 = rTarget0.rotation * (RotationMatrix::aroundX(-rJoint5) * RotationMatrix::aroundY(-rMinusBetaAndJoint4)).col(1);
-  const float lMinusJoint0 = std::atan2(-lHipRotationC1.x(), lHipRotationC1.y());
-  const float rJoint0 = std::atan2(-rHipRotationC1.x(), rHipRotationC1.y());
-  const float lJoint0Combined = -lMinusJoint0 * ratio + rJoint0 * (1.f - ratio);
-
-  const Pose3f lTarget1 = RotationMatrix::aroundZ(lJoint0Combined) * lTarget0;
-  const Pose3f rTarget1 = RotationMatrix::aroundZ(-lJoint0Combined) * rTarget0;
-  const Vector3f& lHipToFoot = lTarget1.translation;
-  const Vector3f& rHipToFoot = rTarget1.translation;
-  const float lMinusPi_4MinusJoint1 = -std::atan2(-lHipToFoot.y(), -lHipToFoot.z());
-  const float rPi_4AndJoint1 = -std::atan2(-rHipToFoot.y(), -rHipToFoot.z());
-  const float lJoint2MinusAlpha = std::atan2(-lHipToFoot.x(), std::sqrt(sqr(lHipToFoot.y()) + sqr(lHipToFoot.z())) * -sgn(lHipToFoot.z()));
-  const float rJoint2MinusAlpha = std::atan2(-rHipToFoot.x(), std::sqrt(sqr(rHipToFoot.y()) + sqr(rHipToFoot.z())) * -sgn(rHipToFoot.z()));
-  const Vector3f lFootRotationC2 = Rotation::aroundY(-lJoint2MinusAlpha) * Rotation::aroundX(-lMinusPi_4MinusJoint1) * lTarget1.rotation.col(2);
-  const Vector3f rFootRotationC2 = Rotation::aroundY(-rJoint2MinusAlpha) * Rotation::aroundX(-rPi_4AndJoint1) * rTarget1.rotation.col(2);
-  const float h1 = robotDimensions.upperLegLength;
-  const float h2 = robotDimensions.lowerLegLength;
-  const float hl = lTarget1.translation.norm();
-  const float hr = rTarget1.translation.norm();
-  const float h1Sqr = h1 * h1;
-  const float h2Sqr = h2 * h2;
-  const float hlSqr = hl * hl;
-  const float hrSqr = hr * hr;
-  const float lCosMinusAlpha = (h1Sqr + hlSqr - h2Sqr) / (2.f * h1 * hl);
-  const float rCosMinusAlpha = (h1Sqr + hrSqr - h2Sqr) / (2.f * h1 * hr);
-  const float lCosMinusBeta = (h2Sqr + hlSqr - h1Sqr) / (2.f * h2 * hl);
-  const float rCosMinusBeta = (h2Sqr + hrSqr - h1Sqr) / (2.f * h2 * hr);
-  const float lAlpha = -std::acos(cosClipping.limit(lCosMinusAlpha));
-  const float rAlpha = -std::acos(cosClipping.limit(rCosMinusAlpha));
-  const float lBeta = -std::acos(cosClipping.limit(lCosMinusBeta));
-  const float rBeta = -std::acos(cosClipping.limit(rCosMinusBeta));
-
-  jointAngles.angles[Joints::lHipYawPitch] = lJoint0Combined;
-  jointAngles.angles[Joints::lHipRoll] = (lMinusPi_4MinusJoint1 + pi_4);
-  jointAngles.angles[Joints::lHipPitch] = lJoint2MinusAlpha + lAlpha;
-  jointAngles.angles[Joints::lKneePitch] = -lAlpha - lBeta;
-  jointAngles.angles[Joints::lAnklePitch] = std::atan2(lFootRotationC2.x(), lFootRotationC2.z()) + lBeta;
-  jointAngles.angles[Joints::lAnkleRoll] = std::asin(-lFootRotationC2.y());
-
-  jointAngles.angles[Joints::rHipYawPitch] = lJoint0Combined;
-  jointAngles.angles[Joints::rHipRoll] = rPi_4AndJoint1 - pi_4;
-  jointAngles.angles[Joints::rHipPitch] = rJoint2MinusAlpha + rAlpha;
-  jointAngles.angles[Joints::rKneePitch] = -rAlpha - rBeta;
-  jointAngles.angles[Joints::rAnklePitch] = std::atan2(rFootRotationC2.x(), rFootRotationC2.z()) + rBeta;
-  jointAngles.angles[Joints::rAnkleRoll] = std::asin(-rFootRotationC2.y());
-  const float maxLen = h1 + h2;
-  return hl <= maxLen && hr <= maxLen;
+  return ::calcLegJoints(lTarget0, rTarget0, jointAngles, robotDimensions, ratio);
 }
 
 bool InverseKinematic::calcLegJoints(const Pose3f& positionLeft, const Pose3f& positionRight, const Vector2f& bodyRotation,
@@ -166,67 +213,10 @@ bool InverseKinematic::calcLegJoints(const Pose3f& positionLeft, const Pose3f& p
 {
   static const Pose3f rotPi_4 = RotationMatrix::aroundX(pi_4);
   static const Pose3f rotMinusPi_4 = RotationMatrix::aroundX(-pi_4);
-  const Rangef cosClipping = Rangef::OneRange();
-
-  Rangef::ZeroOneRange().clamp(ratio);
 
   const Pose3f lTarget0 = (((rotMinusPi_4 + Vector3f(0.f, -robotDimensions.yHipOffset, 0.f)) *= bodyRotation.inverse()) *= positionLeft) += Vector3f(0.f, 0.f, robotDimensions.footHeight);
   const Pose3f rTarget0 = (((rotPi_4 + Vector3f(0.f, robotDimensions.yHipOffset, 0.f)) *= bodyRotation.inverse()) *= positionRight) += Vector3f(0.f, 0.f, robotDimensions.footHeight);
-  const Vector3f lFootToHip = lTarget0.rotation.inverse() * -lTarget0.translation;
-  const Vector3f rFootToHip = rTarget0.rotation.inverse() * -rTarget0.translation;
-  const float lMinusJoint5 = std::atan2(lFootToHip.y(), lFootToHip.z());
-  const float rJoint5 = std::atan2(rFootToHip.y(), rFootToHip.z());
-  const float lMinusBetaAndJoint4 = -std::atan2(lFootToHip.x(), std::sqrt(sqr(lFootToHip.y()) + sqr(lFootToHip.z())));
-  const float rMinusBetaAndJoint4 = -std::atan2(rFootToHip.x(), std::sqrt(sqr(rFootToHip.y()) + sqr(rFootToHip.z())));
-  const Vector3f lHipRotationC1 = lTarget0.rotation * (RotationMatrix::aroundX(-lMinusJoint5) * RotationMatrix::aroundY(-lMinusBetaAndJoint4)).col(1);
-  const Vector3f rHipRotationC1 = rTarget0.rotation * (RotationMatrix::aroundX(-rJoint5) * RotationMatrix::aroundY(-rMinusBetaAndJoint4)).col(1);
-  const float lMinusJoint0 = std::atan2(-lHipRotationC1.x(), lHipRotationC1.y());
-  const float rJoint0 = std::atan2(-rHipRotationC1.x(), rHipRotationC1.y());
-  const float lJoint0Combined = -lMinusJoint0 * ratio + rJoint0 * (1.f - ratio);
-
-  const Pose3f lTarget1 = RotationMatrix::aroundZ(lJoint0Combined) * lTarget0;
-  const Pose3f rTarget1 = RotationMatrix::aroundZ(-lJoint0Combined) * rTarget0;
-  const Vector3f& lHipToFoot = lTarget1.translation;
-  const Vector3f& rHipToFoot = rTarget1.translation;
-  const float lMinusPi_4MinusJoint1 = -std::atan2(-lHipToFoot.y(), -lHipToFoot.z());
-  const float rPi_4AndJoint1 = -std::atan2(-rHipToFoot.y(), -rHipToFoot.z());
-  const float lJoint2MinusAlpha = std::atan2(-lHipToFoot.x(), std::sqrt(sqr(lHipToFoot.y()) + sqr(lHipToFoot.z())) * -sgn(lHipToFoot.z()));
-  const float rJoint2MinusAlpha = std::atan2(-rHipToFoot.x(), std::sqrt(sqr(rHipToFoot.y()) + sqr(rHipToFoot.z())) * -sgn(rHipToFoot.z()));
-  const Vector3f lFootRotationC2 = Rotation::aroundY(-lJoint2MinusAlpha) * Rotation::aroundX(-lMinusPi_4MinusJoint1) * lTarget1.rotation.col(2);
-  const Vector3f rFootRotationC2 = Rotation::aroundY(-rJoint2MinusAlpha) * Rotation::aroundX(-rPi_4AndJoint1) * rTarget1.rotation.col(2);
-  const float h1 = robotDimensions.upperLegLength;
-  const float h2 = robotDimensions.lowerLegLength;
-  const float hl = lTarget1.translation.norm();
-  const float hr = rTarget1.translation.norm();
-  const float h1Sqr = h1 * h1;
-  const float h2Sqr = h2 * h2;
-  const float hlSqr = hl * hl;
-  const float hrSqr = hr * hr;
-  const float lCosMinusAlpha = (h1Sqr + hlSqr - h2Sqr) / (2.f * h1 * hl);
-  const float rCosMinusAlpha = (h1Sqr + hrSqr - h2Sqr) / (2.f * h1 * hr);
-  const float lCosMinusBeta = (h2Sqr + hlSqr - h1Sqr) / (2.f * h2 * hl);
-  const float rCosMinusBeta = (h2Sqr + hrSqr - h1Sqr) / (2.f * h2 * hr);
-  const float lAlpha = -std::acos(cosClipping.limit(lCosMinusAlpha));
-  const float rAlpha = -std::acos(cosClipping.limit(rCosMinusAlpha));
-  const float lBeta = -std::acos(cosClipping.limit(lCosMinusBeta));
-  const float rBeta = -std::acos(cosClipping.limit(rCosMinusBeta));
-
-  jointAngles.angles[Joints::lHipYawPitch] = lJoint0Combined;
-  jointAngles.angles[Joints::lHipRoll] = (lMinusPi_4MinusJoint1 + pi_4);
-  jointAngles.angles[Joints::lHipPitch] = lJoint2MinusAlpha + lAlpha;
-  jointAngles.angles[Joints::lKneePitch] = -lAlpha - lBeta;
-  jointAngles.angles[Joints::lAnklePitch] = std::atan2(lFootRotationC2.x(), lFootRotationC2.z()) + lBeta;
-  jointAngles.angles[Joints::lAnkleRoll] = std::asin(-lFootRotationC2.y());
-
-  jointAngles.angles[Joints::rHipYawPitch] = lJoint0Combined;
-  jointAngles.angles[Joints::rHipRoll] = rPi_4AndJoint1 - pi_4;
-  jointAngles.angles[Joints::rHipPitch] = rJoint2MinusAlpha + rAlpha;
-  jointAngles.angles[Joints::rKneePitch] = -rAlpha - rBeta;
-  jointAngles.angles[Joints::rAnklePitch] = std::atan2(rFootRotationC2.x(), rFootRotationC2.z()) + rBeta;
-  jointAngles.angles[Joints::rAnkleRoll] = std::asin(-rFootRotationC2.y());
-  const float maxLen = h1 + h2;
-
-  return hl <= maxLen &&  hr <= maxLen;
+  return ::calcLegJoints(lTarget0, rTarget0, jointAngles, robotDimensions, ratio);
 }
 
 void InverseKinematic::calcHeadJoints(const Vector3f& position, const Angle imageTilt, const RobotDimensions& robotDimensions,
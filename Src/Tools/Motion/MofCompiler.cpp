@@ -12,6 +12,7 @@
 #include "Platform/File.h"
 #include "Representations/Infrastructure/JointAngles.h"
 #include "Representations/Infrastructure/StiffnessData.h"
+#include "Tools/PrecomputedTable.h"
 
 #include <fstream>
 #include <cstdarg>
@@ -599,3 +600,40 @@ bool MofCompiler::compileMofs(char* buffer, size_t size, std::vector<float>& mot
 
   return true;
 }
+
+uint64_t MofCompiler::hashMofs()
+{
+  PrecomputedTable::Hash hash;
+  for(int i = 0; i < SpecialActionRequest::numOfSpecialActionIDs; ++i)
+  {
+    const char* name = SpecialActionRequest::getName(SpecialActionRequest::SpecialActionID(i));
+    hash.add(name, strlen(name) + 1);
+  }
+
+  // The files are visited in the same order as during compilation.
+  char dirName[1024];
+  sprintf(dirName, "%s/Config/mof", File::getBHDir());
+  if(DIR* dir = opendir(dirName))
+  {
+    std::vector<char> buffer;
+    while(dirent* entry = readdir(dir))
+    {
+      const size_t length = strlen(entry->d_name);
+      if(length <= 4 || strcmp(entry->d_name + length - 4, ".mof"))
+        continue;
+      hash.add(entry->d_name, length + 1);
+
+      char name[1280];
+      sprintf(name, "%s/%s", dirName, entry->d_name);
+      if(FILE* f = fopen(name, "rb"))
+      {
+        buffer.resize(128000);
+        buffer.resize(fread(buffer.data(), 1, buffer.size(), f));
+        fclose(f);
+        hash << buffer;
+      }
+    }
+    closedir(dir);
+  }
+  return hash;
+}
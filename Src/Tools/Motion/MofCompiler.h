@@ -11,6 +11,7 @@
 
 #include "Representations/MotionControl/SpecialActionRequest.h"
 
+#include <cstdint>
 #include <vector>
 
 class MofCompiler
@@ -52,6 +53,13 @@ public:
    */
   bool compileMofs(char* buffer, size_t size, std::vector<float>& motionData);
 
+  /**
+   * The function computes a hash of everything the compilation depends on,
+   * i.e. the names and the contents of all mofs and the names of all special actions.
+   * @return The hash value.
+   */
+  static uint64_t hashMofs();
+
 private:
   /**
    * The function replaces printf so that the output is written into a buffer.
@@ -1,15 +1,42 @@
 #include "WalkKickEngine.h"
 #include "Tools/Streams/InStreams.h"
 
+static bool operator==(const WalkKick::KeyFrame& a, const WalkKick::KeyFrame& b)
+{
+  return a.phase == b.phase && a.position == b.position && a.rotation == b.rotation;
+}
+
 WalkKickEngine::WalkKickEngine(const WalkKicks& walkKicks) :
-  walkKicks(walkKicks)
+  walkKicks(walkKicks),
+  currentVariant(&variants[WalkKicks::none][Legs::left])
 {}
 
+void WalkKickEngine::precompute()
+{
+  FOREACH_ENUM((WalkKicks) Type, kickType)
+    FOREACH_ENUM((Legs) Leg, kickLeg)
+      getVariant(kickType, kickLeg);
+}
+
 void WalkKickEngine::start(WalkKicks::Type kickType, Legs::Leg kickLeg)
 {
   currentKickType = kickType;
   currentKickLeg = kickLeg;
+  currentVariant = &getVariant(kickType, kickLeg);
+}
+
+WalkKickEngine::Variant& WalkKickEngine::getVariant(WalkKicks::Type kickType, Legs::Leg kickLeg)
+{
+  Variant& variant = variants[kickType][kickLeg];
   const WalkKick& kick = walkKicks.kicks[kickType];
+  if(variant.valid && variant.definedKickLeg == kick.kickLeg && variant.keyFrames == kick.keyFrames)
+    return variant;
+
+  variant.valid = true;
+  variant.definedKickLeg = kick.kickLeg;
+  variant.keyFrames = kick.keyFrames;
+  std::array<CubicSpline, 3>& positionSplines = variant.positionSplines;
+  std::array<CubicSpline, 3>& rotationSplines = variant.rotationSplines;
 
   // init controlPoints vector
   std::vector<Vector2f> controlPoints;
@@ -47,13 +74,15 @@ void WalkKickEngine::start(WalkKicks::Type kickType, Legs::Leg kickLeg)
   for(size_t j = 0; j < kick.keyFrames.size(); ++j)
     controlPoints[j + 1].y() = sign * kick.keyFrames[j].rotation.z();
   rotationSplines[2].initClamped(controlPoints, 0.f, 0.f);
+
+  return variant;
 }
 
 void WalkKickEngine::getState(float phase, Vector3f& position, Vector3f& rotation)
 {
   for(int i = 0; i < 3; ++i)
   {
-    position[i] = positionSplines[i](phase);
-    rotation[i] = rotationSplines[i](phase);
+    position[i] = currentVariant->positionSplines[i](phase);
+    rotation[i] = currentVariant->rotationSplines[i](phase);
   }
 }
@@ -9,17 +9,40 @@ class WalkKickEngine
 public:
   WalkKickEngine(const WalkKicks& walkKicks);
 
+  /**
+   * Builds the splines of all kick variants whose parameters changed since they
+   * were built last. Called every frame, so that starting a kick only has to
+   * select the splines.
+   */
+  void precompute();
+
   void start(WalkKicks::Type kickType, Legs::Leg kickLeg);
   void getState(float phase, Vector3f& position, Vector3f& rotation);
   WalkKicks::Type getCurrentKickType() const { return currentKickType; }
   Legs::Leg getCurrentKickLeg() const { return currentKickLeg; }
 
 private:
+  /** The splines of a kick executed with a certain leg. */
+  struct Variant
+  {
+    bool valid = false; /**< Were the splines built yet? */
+    Legs::Leg definedKickLeg = Legs::left; /**< The kick leg of the kick the splines were built from. */
+    std::vector<WalkKick::KeyFrame> keyFrames; /**< The key frames the splines were built from. */
+    std::array<CubicSpline, 3> positionSplines;
+    std::array<CubicSpline, 3> rotationSplines;
+  };
+
   const WalkKicks& walkKicks;
 
   WalkKicks::Type currentKickType = WalkKicks::none;
   Legs::Leg currentKickLeg = Legs::left;
 
-  std::array<CubicSpline, 3> positionSplines;
-  std::array<CubicSpline, 3> rotationSplines;
+  std::array<std::array<Variant, Legs::numOfLegs>, WalkKicks::numOfTypes> variants;
+  Variant* currentVariant;
+
+  /**
+   * Returns the splines of a kick variant, (re)building them if the kick
+   * parameters changed.
+   */
+  Variant& getVariant(WalkKicks::Type kickType, Legs::Leg kickLeg);
 };
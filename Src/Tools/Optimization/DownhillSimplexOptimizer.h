@@ -220,7 +220,7 @@ DownhillSimplexOptimizer<T, Dimensions, ErrorFunction>::optimize(T terminationCr
     const Data simplexExtent = best.values - ((midSum + worst.values) /= Dimensions);
     T norm = T(0);
     for(unsigned i = 0; i < Dimensions; ++i)
-      norm = simplexExtent[i] * simplexExtent[i];
+      norm += simplexExtent[i] * simplexExtent[i];
     norm = std::sqrt(norm);
     if(norm < 0.0001f)
     {
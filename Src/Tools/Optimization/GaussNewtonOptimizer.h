@@ -22,9 +22,6 @@ public:
   };
 
 private:
-  using Jacobian = Eigen::Matrix<float, Eigen::Dynamic, N>;
-  using JacobianTransposed = Eigen::Matrix<float, N, Eigen::Dynamic>;
-
   const Functor& functor;
 
 public:
@@ -41,24 +38,29 @@ float GaussNewtonOptimizer<N>::iterate(Vector& params, const Vector& epsilon)
   const size_t numOfMeasurements = functor.getNumOfMeasurements();
   ASSERT(numOfMeasurements >= N);
 
-  // build jacobi matrix
-  Jacobian J(numOfMeasurements, N);
+  Vector paramsAbove[N];
+  Vector paramsBelow[N];
   for(size_t j = 0; j < N; ++j)
   {
     Vector epsilonj = Vector::Zero();
     epsilonj(j) = epsilon(j);
-    const Vector paramsAbove = params + epsilonj;
-    const Vector paramsBelow = params - epsilonj;
-    for(size_t i = 0; i < numOfMeasurements; ++i)
-      J(i, j) = (functor(paramsAbove, i) - functor(paramsBelow, i)) / (2 * epsilon(j));
+    paramsAbove[j] = params + epsilonj;
+    paramsBelow[j] = params - epsilonj;
   }
 
-  VectorXf r = VectorXf(numOfMeasurements);
+  // Accumulate J^T*J and J^T*r row by row instead of building the whole jacobi matrix
+  Eigen::Matrix<float, N, N> JtJ = Eigen::Matrix<float, N, N>::Zero();
+  Vector Jtr = Vector::Zero();
   for(size_t i = 0; i < numOfMeasurements; ++i)
-    r(i) = functor(params, i);
+  {
+    Vector row;
+    for(size_t j = 0; j < N; ++j)
+      row(j) = (functor(paramsAbove[j], i) - functor(paramsBelow[j], i)) / (2 * epsilon(j));
+    JtJ.noalias() += row * row.transpose();
+    Jtr += row * functor(params, i);
+  }
 
-  const JacobianTransposed Jt = J.transpose();
-  const Vector s = (Jt * J).inverse() * Jt * r;
+  const Vector s = JtJ.inverse() * Jtr;
 
   params -= s;
 
@@ -0,0 +1,87 @@
+/**
+ * @file Tools/PrecomputedTable.cpp
+ * Implementation of a class that stores precomputed tables in versioned
+ * binary files that are memory-mapped when they are loaded.
+ */
+
+#include "PrecomputedTable.h"
+#include "Platform/File.h"
+#include "Platform/MappedFile.h"
+
+#include <cstdio>
+#include <cstring>
+
+/** The header of a table file. Its size keeps the table aligned to 8 bytes. */
+struct PrecomputedTableHeader
+{
+  char magic[4];
+  unsigned version;
+  uint64_t hash;
+  uint64_t size;
+};
+
+static const char precomputedTableMagic[4] = {'B', 'H', 'P', 'T'};
+
+PrecomputedTable::Hash& PrecomputedTable::Hash::add(const void* p, size_t size)
+{
+  for(const unsigned char* c = static_cast<const unsigned char*>(p), *end = c + size; c < end; ++c)
+    value = (value ^ *c) * 1099511628211ull;
+  return *this;
+}
+
+bool PrecomputedTable::load(const std::string& name, unsigned version, uint64_t hash)
+{
+  *this = PrecomputedTable();
+  std::shared_ptr<MappedFile> mappedFile = std::make_shared<MappedFile>(name);
+  if(!mappedFile->exists() || mappedFile->getSize() < sizeof(PrecomputedTableHeader))
+    return false;
+
+  PrecomputedTableHeader header;
+  std::memcpy(&header, mappedFile->getData(), sizeof(header));
+  if(std::memcmp(header.magic, precomputedTableMagic, sizeof(header.magic)) || header.version != version
+     || header.hash != hash || header.size != mappedFile->getSize() - sizeof(header))
+    return false;
+
+  data = mappedFile->getData() + sizeof(header);
+  size = static_cast<size_t>(header.size);
+  file = mappedFile;
+  return true;
+}
+
+void PrecomputedTable::set(std::vector<char>&& table, const std::string& name, unsigned version, uint64_t hash)
+{
+  *this = PrecomputedTable();
+  std::shared_ptr<std::vector<char>> newBuffer = std::make_shared<std::vector<char>>(std::move(table));
+  data = newBuffer->empty() ? nullptr : newBuffer->data();
+  size = newBuffer->size();
+  buffer = newBuffer;
+
+  if(name.empty())
+    return;
+
+  // Write to a temporary file first, so other processes never map a partial table.
+  PrecomputedTableHeader header;
+  std::memcpy(header.magic, precomputedTableMagic, sizeof(header.magic));
+  header.version = version;
+  header.hash = hash;
+  header.size = size;
+  std::string tempName;
+  std::string fullName;
+  {
+    File tempFile(name + ".tmp", "wb", false);
+    if(!tempFile.exists())
+      return;
+    tempFile.write(&header, sizeof(header));
+    if(size)
+      tempFile.write(data, size);
+    tempName = tempFile.getFullName();
+    fullName = tempName.substr(0, tempName.size() - 4);
+  }
+  if(std::rename(tempName.c_str(), fullName.c_str()))
+  {
+    // Windows does not replace existing files.
+    std::remove(fullName.c_str());
+    if(std::rename(tempName.c_str(), fullName.c_str()))
+      std::remove(tempName.c_str());
+  }
+}
@@ -0,0 +1,102 @@
+/**
+ * @file Tools/PrecomputedTable.h
+ * Declaration of a class that stores precomputed tables in versioned
+ * binary files that are memory-mapped when they are loaded.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+class MappedFile;
+
+/**
+ * A precomputed table is a block of binary data that is expensive to
+ * compute. It is stored in a file together with a version of its layout and
+ * a hash of all parameters it was generated from. When it is loaded, the file
+ * is mapped read-only, i.e. the table is shared through the page cache between
+ * all processes using it and loading takes almost no time. A file that does
+ * not match the version or the hash is ignored and should be recomputed.
+ * Copies of a table share the same data.
+ */
+class PrecomputedTable
+{
+public:
+  /** Computes a 64 bit FNV-1a hash of the parameters a table is generated from. */
+  class Hash
+  {
+  private:
+    uint64_t value = 14695981039346656037ull; /**< The hash value so far. */
+
+  public:
+    /**
+     * Adds a block of bytes to the hash.
+     * @param p The start of the block.
+     * @param size The size of the block in bytes.
+     * @return This object.
+     */
+    Hash& add(const void* p, size_t size);
+
+    /**
+     * Adds a value to the hash. It must not contain pointers or padding.
+     * @param v The value.
+     * @return This object.
+     */
+    template<typename T> Hash& operator<<(const T& v) {return add(&v, sizeof(v));}
+
+    /**
+     * Adds the elements of a vector to the hash.
+     * @param v The vector.
+     * @return This object.
+     */
+    template<typename T, typename A> Hash& operator<<(const std::vector<T, A>& v)
+    {
+      *this << v.size();
+      return v.empty() ? *this : add(v.data(), v.size() * sizeof(T));
+    }
+
+    /** The hash value. */
+    operator uint64_t() const {return value;}
+  };
+
+private:
+  std::shared_ptr<const MappedFile> file; /**< The mapped file if the table was loaded. */
+  std::shared_ptr<const std::vector<char>> buffer; /**< The buffer if the table was computed. */
+  const char* data = nullptr; /**< The table itself or nullptr if there is none. */
+  size_t size = 0; /**< The size of the table in bytes. */
+
+public:
+  /**
+   * Maps a table from a file.
+   * @param name The name of the file. Relative paths are searched in the configuration directories.
+   * @param version The version of the layout of the table expected.
+   * @param hash The hash of the parameters the table is expected to be generated from.
+   * @return Was a matching table found? Otherwise, this object is empty.
+   */
+  bool load(const std::string& name, unsigned version, uint64_t hash);
+
+  /**
+   * Uses a table that was just computed and saves it for later runs.
+   * @param table The table computed. It is moved into this object.
+   * @param name The name of the file. If empty, the table is not saved.
+   * @param version The version of the layout of the table.
+   * @param hash The hash of the parameters the table was generated from.
+   */
+  void set(std::vector<char>&& table, const std::string& name, unsigned version, uint64_t hash);
+
+  /**
+   * The table. Its start is aligned to 8 bytes.
+   * @return The address of the first byte or nullptr if the table is empty.
+   */
+  const char* getData() const {return data;}
+
+  /**
+   * The size of the table.
+   * @return The size in bytes.
+   */
+  size_t getSize() const {return size;}
+};
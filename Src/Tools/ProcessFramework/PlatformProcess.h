@@ -26,6 +26,7 @@ private:
   SenderList* firstSender = nullptr; /**< The begin of the list of all senders of this process. */
   ReceiverList* firstReceiver = nullptr; /**< The begin of the list of all receivers of this process. */
   int priority = 0; /**< The priority of the process. */
+  int cpu = -1; /**< The core the process runs on. -1 means any core. */
   Semaphore sem; /**< The semaphore is triggered whenever this process receives new data. */
   ProcessBase* processBase = nullptr;
 
@@ -66,6 +67,18 @@ public:
    */
   int getPriority() const {return priority;}
 
+  /**
+   * The function restricts the process to a single core.
+   * @param cpu The number of the core. -1 allows all cores.
+   */
+  void setCPU(int cpu);
+
+  /**
+   * The function determines the core the process is restricted to.
+   * @return The number of the core or -1 if it may run on all cores.
+   */
+  int getCPU() const {return cpu;}
+
   /**
    * The method is called when the process is terminated.
    */
@@ -16,3 +16,10 @@ void PlatformProcess::setPriority(int priority)
   if(processBase)
     processBase->setPriority(priority);
 }
+
+void PlatformProcess::setCPU(int cpu)
+{
+  this->cpu = cpu;
+  if(processBase)
+    processBase->setCPU(cpu);
+}
@@ -98,6 +98,7 @@ protected:
 
     // Call process.nextFrame if no blocking receivers are waiting
     setPriority(process.getPriority());
+    setCPU(process.getCPU());
     process.processBase = this;
     Thread::yield(); // always leave processing time to other threads
     process.setGlobals();
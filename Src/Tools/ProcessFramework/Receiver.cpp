@@ -7,6 +7,17 @@
  */
 
 #include "ProcessFramework.h"
+#include <algorithm>
+#include <chrono>
+
+/**
+ * The function returns a monotonic time stamp.
+ * @return The time in microseconds.
+ */
+static unsigned long long getCurrentTime()
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
 
 ReceiverList::ReceiverList(PlatformProcess* p, const std::string& receiverName) :
   name(receiverName), // copy the receiver's name. The name of the process is still missing.
@@ -21,15 +32,7 @@ ReceiverList::ReceiverList(PlatformProcess* p, const std::string& receiverName)
   }
   else
     getFirst() = this;
-  for(int i = 0; i < 3; ++i)
-    package[i] = 0;
-}
-
-ReceiverList::~ReceiverList()
-{
-  for(int i = 0; i < 3; ++i)
-    if(package[i])
-      delete[] (char*)package[i];
+  actual = 2;
 }
 
 ReceiverList*& ReceiverList::getFirst()
@@ -51,19 +54,25 @@ ReceiverList* ReceiverList::lookup(const std::string& processName, const std::st
   return nullptr;
 }
 
-void ReceiverList::setPackage(void* p)
+char* ReceiverList::reservePackage(size_t size)
+{
+  package[writing].resize(size);
+  return package[writing].data();
+}
+
+void ReceiverList::setPackage()
 {
-  int writing = 0;
-  if(writing == actual)
-    ++writing;
-  if(writing == reading)
-    if(++writing == actual)
-      ++writing;
-  ASSERT(writing != actual);
-  ASSERT(writing != reading);
-  if(package[writing])
-    delete[] (char*)package[writing];
-  package[writing] = p;
-  actual = writing;
+  sendTime[writing] = getCurrentTime();
+  writing = actual.exchange(writing | fresh, std::memory_order_acq_rel) & ~fresh;
   process->trigger();
 }
+
+bool ReceiverList::takePackage()
+{
+  if(!(actual.load(std::memory_order_acquire) & fresh))
+    return false;
+  reading = actual.exchange(reading, std::memory_order_acq_rel) & ~fresh;
+  handoverLatency = static_cast<unsigned>(getCurrentTime() - sendTime[reading]);
+  maxHandoverLatency = std::max(maxHandoverLatency, handoverLatency);
+  return true;
+}
@@ -8,8 +8,13 @@
 
 #pragma once
 
+#include "Tools/Global.h"
+#include "Tools/Debugging/TimingManager.h"
+#include "Tools/Streams/BinaryCoding.h"
 #include "Tools/Streams/InStreams.h"
 #include "Tools/Streams/Streamable.h"
+#include <atomic>
+#include <vector>
 
 class PlatformProcess;
 
@@ -25,10 +30,32 @@ private:
   std::string name;             /**< The name of a receiver without the module's name. */
 
 protected:
+  static const unsigned fresh = 4; /**< Flag in "actual" that marks a package that was not read yet. */
+
   PlatformProcess* process;   /**< The process this receiver is associated with. */
-  void* package[3];           /**< A triple buffer for received packages. */
-  volatile int reading = 0;   /**< Index of package reserved for reading. */
-  volatile int actual = 0;    /**< Index of package that is the most actual. */
+  std::vector<char> package[3]; /**< A triple buffer for received packages. The buffers are reused, so they are only reallocated if a package grows. */
+  unsigned long long sendTime[3]; /**< When were the packages handed over (in microseconds)? */
+
+  /**
+   * The buffers are exchanged wait-free. The sender owns "writing", the receiver owns
+   * "reading", and both swap their buffer with "actual" using a single atomic operation.
+   * The indices are kept in separate cache lines to avoid false sharing.
+   */
+  char padding1[64];
+  std::atomic<unsigned> actual; /**< Index of package that is the most actual. Combined with the flag "fresh". */
+  char padding2[64];
+  unsigned reading = 0;       /**< Index of package reserved for reading. Only used by the receiver. */
+  unsigned handoverLatency = 0; /**< The time between sending and reading the last package in microseconds. */
+  unsigned maxHandoverLatency = 0; /**< The maximum of handoverLatency. */
+  char padding3[64];
+  unsigned writing = 1;       /**< Index of package reserved for writing. Only used by the sender. */
+  char padding4[64];
+
+  /**
+   * The function takes the most actual package if a new one has arrived.
+   * @return Is there a new package in package[reading]?
+   */
+  bool takePackage();
 
   /**
    * The function checks whether a new package has arrived.
@@ -43,7 +70,7 @@ public:
    */
   ReceiverList(PlatformProcess* process, const std::string& receiverName);
 
-  virtual ~ReceiverList();
+  virtual ~ReceiverList() = default;
 
   /**
    * Returns the begin of the list of all receivers.
@@ -69,16 +96,36 @@ public:
   void checkAllForPackages();
 
   /**
-   * The function sets the package.
-   * @param p The package.
+   * The function reserves a buffer for the next package. The sender writes its
+   * package into this buffer and then calls setPackage().
+   * @param size The size of the package in bytes.
+   * @return The buffer that must be filled with the package.
+   */
+  char* reservePackage(size_t size);
+
+  /**
+   * The function marks the package written into the buffer returned by
+   * reservePackage() as the most actual one.
    */
-  void setPackage(void* p);
+  void setPackage();
 
   /**
    * The function determines whether the receiver has a pending package.
    * @return Is there still an unprocessed package?
    */
-  bool hasPendingPackage() const {return package[actual] != 0;}
+  bool hasPendingPackage() const {return (actual.load(std::memory_order_acquire) & fresh) != 0;}
+
+  /**
+   * The function returns the time between sending and reading the last package.
+   * @return The latency in microseconds.
+   */
+  unsigned getHandoverLatency() const {return handoverLatency;}
+
+  /**
+   * The function returns the maximum time between sending and reading a package.
+   * @return The worst-case latency so far in microseconds.
+   */
+  unsigned getMaxHandoverLatency() const {return maxHandoverLatency;}
 
   /**
    * The function searches for a receiver with the given name.
@@ -102,14 +149,12 @@ private:
    */
   virtual void checkForPackage()
   {
-    reading = actual;
-    if(package[reading])
+    if(takePackage())
     {
+      Global::getTimingManager().beginEvent(getName().c_str());
       T& data = *static_cast<T*>(this);
-      InBinaryMemory memory(package[reading]);
-      memory >> data;
-      delete[] (char*)package[reading];
-      package[reading] = 0;
+      Streaming::readBinary(package[reading].data(), package[reading].size(), data);
+      Global::getTimingManager().endEvent(getName().c_str());
     }
   }
 
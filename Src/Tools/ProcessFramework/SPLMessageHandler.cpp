@@ -10,7 +10,11 @@
 #include "SPLMessageHandler.h"
 #include "Platform/BHAssert.h"
 #include "Platform/SystemCall.h"
+#include "Platform/Time.h"
 #include "Tools/Debugging/DebugDrawings.h"
+#include "Tools/Global.h"
+#include "Tools/Settings.h"
+#include <cstring>
 
 void SPLMessageHandler::startLocal(int port, unsigned localId)
 {
@@ -27,6 +31,7 @@ void SPLMessageHandler::startLocal(int port, unsigned localId)
   VERIFY(socket.joinMulticast(group.c_str()));
   VERIFY(socket.setTarget(group.c_str(), port));
   socket.setLoopback(true);
+  startThread();
 }
 
 void SPLMessageHandler::start(int port, const char* subnet)
@@ -39,6 +44,13 @@ void SPLMessageHandler::start(int port, const char* subnet)
   VERIFY(socket.bind("0.0.0.0", port));
   socket.setTarget(subnet, port);
   socket.setLoopback(false);
+  startThread();
+}
+
+void SPLMessageHandler::startThread()
+{
+  teamNumber = static_cast<uint8_t>(Global::getSettings().teamNumber);
+  thread.start(this, &SPLMessageHandler::run);
 }
 
 void SPLMessageHandler::send()
@@ -53,23 +65,84 @@ void SPLMessageHandler::send()
   PLOT("module:TeamHandler:standardMessageDataBufferUsageInPercent", usageInPercent);
 }
 
+bool SPLMessageHandler::accept(const RoboCup::SPLStandardMessage& message, int size) const
+{
+  return size >= static_cast<int>(offsetof(RoboCup::SPLStandardMessage, data))
+         && size <= static_cast<int>(sizeof(RoboCup::SPLStandardMessage))
+         && !std::memcmp(message.header, SPL_STANDARD_MESSAGE_STRUCT_HEADER, sizeof(message.header))
+         && static_cast<uint8_t>(message.teamNum) == teamNumber;
+}
+
+void SPLMessageHandler::enqueue(const RoboCup::SPLStandardMessage& message, int size, unsigned receiveTimestamp)
+{
+  const unsigned head = queueHead.load(std::memory_order_relaxed);
+  if(head - queueTail.load(std::memory_order_acquire) >= queueSize)
+    return; // The process did not take the messages for a long time.
+
+  ReceivedMessage& entry = queue[head % queueSize];
+  std::memcpy(&entry.message, &message, size);
+  entry.size = size;
+  entry.receiveTimestamp = receiveTimestamp;
+  queueHead.store(head + 1, std::memory_order_release);
+}
+
+void SPLMessageHandler::run()
+{
+  Thread::nameThread("SPLMessages");
+  while(thread.isRunning())
+    if(socket.wait(100))
+      read();
+}
+
+void SPLMessageHandler::read()
+{
+  if(localId)
+  {
+    int size;
+    do
+    {
+      size = socket.readLocal(reinterpret_cast<char*>(&batch[0]), sizeof(RoboCup::SPLStandardMessage));
+      if(accept(batch[0], size))
+        enqueue(batch[0], size, Time::getCurrentSystemTime());
+    }
+    while(size > 0);
+  }
+  else
+  {
+    char* buffers[UdpComm::maxBatchSize];
+    int sizes[UdpComm::maxBatchSize];
+    unsigned remoteIps[UdpComm::maxBatchSize];
+    for(int i = 0; i < UdpComm::maxBatchSize; ++i)
+      buffers[i] = reinterpret_cast<char*>(&batch[i]);
+
+    int count;
+    do
+    {
+      count = socket.read(buffers, sizeof(RoboCup::SPLStandardMessage), sizes, remoteIps, UdpComm::maxBatchSize);
+      const unsigned receiveTimestamp = Time::getCurrentSystemTime();
+      for(int i = 0; i < count; ++i)
+        if(accept(batch[i], sizes[i]))
+          enqueue(batch[i], sizes[i], receiveTimestamp);
+    }
+    while(count == UdpComm::maxBatchSize);
+  }
+}
+
 unsigned SPLMessageHandler::receive()
 {
   if(!port)
     return 0; // not started yet
 
-  int size;
-  unsigned remoteIp = 0;
   unsigned receivedSize = 0;
-
-  do
+  const unsigned head = queueHead.load(std::memory_order_acquire);
+  unsigned tail = queueTail.load(std::memory_order_relaxed);
+  for(; tail != head; ++tail)
   {
-    size = localId ? socket.readLocal((char*)in.setForward(), sizeof(RoboCup::SPLStandardMessage))
-                   : socket.read((char*)in.setForward(), sizeof(RoboCup::SPLStandardMessage), remoteIp);
-    if(size < static_cast<int>(offsetof(RoboCup::SPLStandardMessage, data)) || size > static_cast<int>(sizeof(RoboCup::SPLStandardMessage)))
-      in.removeFront();
+    const ReceivedMessage& entry = queue[tail % queueSize];
+    std::memcpy(in.setForward(entry.receiveTimestamp), &entry.message, entry.size);
+    receivedSize += entry.size;
   }
-  while(size > 0);
+  queueTail.store(tail, std::memory_order_release);
 
   return receivedSize;
 }
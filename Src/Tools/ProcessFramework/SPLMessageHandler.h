@@ -12,6 +12,8 @@
 
 #include "Tools/Communication/UdpComm.h"
 #include "Tools/Communication/SPLStandardMessageBuffer.h"
+#include "Platform/Thread.h"
+#include <atomic>
 
 namespace RoboCup
 {
@@ -22,16 +24,62 @@ namespace RoboCup
 
 /**
  * @class SPLMessageHandler
- * A class for team communication by broadcasting.
+ * A class for team communication by broadcasting. Packages are received by
+ * a thread of their own, which stamps them with the time of their arrival
+ * and drops foreign ones. The messages accepted are passed to the process
+ * through a lock-free queue, so the process never waits for the network.
  */
 class SPLMessageHandler
 {
 private:
+  /** A message received by the network thread. */
+  struct ReceivedMessage
+  {
+    RoboCup::SPLStandardMessage message; /**< The message. */
+    int size; /**< The size of the message in bytes. */
+    unsigned receiveTimestamp; /**< The time when the message was received. */
+  };
+
+  static const unsigned queueSize = 32; /**< The number of messages the queue can hold. Must be a power of 2. */
+
   SPLStandardMessageBuffer<MAX_NUMBER_OF_PARALLEL_RECEIVABLE_SPLSTDMSG>& in; /**< Incoming spl messages are stored here. */
   RoboCup::SPLStandardMessage& out; /**< Outgoing spl message is stored here. */
   int port = 0; /**< The UDP port this handler is listening to. */
   UdpComm socket; /**< The socket used to communicate. */
   unsigned localId = 0; /**< The id of a local team communication participant or 0 for normal udp communication. */
+  uint8_t teamNumber = 0; /**< The number of the own team. The network thread cannot access the settings. */
+  RoboCup::SPLStandardMessage batch[UdpComm::maxBatchSize]; /**< Packages are received here before they are filtered. */
+  ReceivedMessage queue[queueSize]; /**< The messages received, but not taken by the process yet. */
+  std::atomic<unsigned> queueHead; /**< The number of messages ever added to the queue. Only written by the network thread. */
+  std::atomic<unsigned> queueTail; /**< The number of messages ever taken from the queue. Only written by the process. */
+  Thread thread; /**< The network thread. It must be stopped before the socket is closed. */
+
+  /**
+   * Checks whether a package received is a message of the own team. Only
+   * the header and the team number are checked, so foreign packages are
+   * dropped before they take space in the buffer of incoming messages.
+   * @param message The package received.
+   * @param size The size of the package in bytes.
+   * @return Should the message be kept?
+   */
+  bool accept(const RoboCup::SPLStandardMessage& message, int size) const;
+
+  /**
+   * Adds a message to the queue. If the queue is full, the message is dropped.
+   * @param message The message.
+   * @param size The size of the message in bytes.
+   * @param receiveTimestamp The time when the message was received.
+   */
+  void enqueue(const RoboCup::SPLStandardMessage& message, int size, unsigned receiveTimestamp);
+
+  /** Receives all packages currently available. Called by the network thread. */
+  void read();
+
+  /** The main function of the network thread. */
+  void run();
+
+  /** Starts the network thread after the socket was set up. */
+  void startThread();
 
 public:
   /**
@@ -40,7 +88,10 @@ public:
    * @param out Outgoing spl standard message.
    */
   SPLMessageHandler(SPLStandardMessageBuffer<MAX_NUMBER_OF_PARALLEL_RECEIVABLE_SPLSTDMSG>& in, RoboCup::SPLStandardMessage& out) :
-    in(in), out(out) {}
+    in(in), out(out), queueHead(0), queueTail(0) {}
+
+  /** Destructor. Stops the network thread. */
+  ~SPLMessageHandler() { thread.stop(); }
 
   /**
    * The method starts the actual communication for local communication.
@@ -62,7 +113,8 @@ public:
   void send();
 
   /**
-   * The method receives packages if available.
+   * The method moves the messages received by the network thread to the
+   * buffer of incoming messages.
    * @return The number of bytes received.
    */
   unsigned receive();
@@ -10,6 +10,9 @@
 
 #include "Receiver.h"
 #include "Platform/BHAssert.h"
+#include "Tools/Global.h"
+#include "Tools/Debugging/TimingManager.h"
+#include "Tools/Streams/BinaryCoding.h"
 #include "Tools/Streams/OutStreams.h"
 #include "Tools/Streams/Streamable.h"
 
@@ -118,14 +121,11 @@ protected:
         if(j == numOfAlreadyReceived)
         {
           // receiver[i] has not received its requested package yet
+          Global::getTimingManager().beginEvent(getName().c_str());
           const T& data = *static_cast<const T*>(this);
-          OutBinarySize size;
-          size << data;
-          void* r = (void*) new char[size.getSize()];
-          ASSERT(r);
-          OutBinaryMemory memory(r);
-          memory << data;
-          receiver[i]->setPackage(r);
+          Streaming::writeBinary(receiver[i]->reservePackage(Streaming::binarySize(data)), data);
+          receiver[i]->setPackage();
+          Global::getTimingManager().endEvent(getName().c_str());
           // note that receiver[i] has received the current package
           ASSERT(numOfAlreadyReceived < RECEIVERS_MAX);
           alreadyReceived[numOfAlreadyReceived++] = receiver[i];
@@ -69,12 +69,19 @@
  *
  * In this example, all attributes except from anInt and aLetter would be initialized.
  *
+ * Besides serialize, the macros also generate a public method template
+ * serializeBinary that codes all attributes with the statically dispatched
+ * coders declared in BinaryCoding.h, e.g. through Streaming::writeBinary.
+ * The data is the same as the one streamed to binary streams, but it is
+ * produced without virtual calls and without registering the specification.
+ *
  * @author Thomas Röfer
  */
 
 #pragma once
 
 #include "Streamable.h"
+#include "BinaryCoding.h"
 
 /**
  * Determine the number of entries in a tuple.
@@ -223,6 +230,9 @@
 #define _STREAM_SER_1(...) _STREAM_SER_1_I __VA_ARGS__)
 #define _STREAM_SER_1_I(...) castFunction(_var, __VA_ARGS__::getName) _STREAM_DROP(_STREAM_DROP(
 
+/** Generate binary coding code from declaration. */
+#define _STREAM_BIN(seq) Streaming::codeBinary(_coder, _STREAM_VAR(seq));
+
 /** Generate the actual declaration. */
 #define _STREAM_DECL(seq) decltype(Streaming::TypeWrapper<_STREAM_DECL_I seq)_STREAM_DECL_IV seq))>::type) _STREAM_VAR(seq) _STREAM_INIT(seq);
 #define _STREAM_DECL_I(...) _STREAM_JOIN(_STREAM_DECL_II_, _STREAM_SEQ_SIZE(__VA_ARGS__))(__VA_ARGS__)
@@ -248,9 +258,9 @@
 #define _STREAM_STREAMABLE(name, base, streamBase, header, ...) \
   struct name : public base \
   _STREAM_UNWRAP header; \
-  _STREAM_STREAMABLE_I(_STREAM_TUPLE_SIZE(__VA_ARGS__), name, streamBase, __VA_ARGS__)
-#define _STREAM_STREAMABLE_I(n, name, streamBase, ...) _STREAM_STREAMABLE_II(n, name, streamBase, (_STREAM_SER, __VA_ARGS__), (_STREAM_DECL, __VA_ARGS__))
-#define _STREAM_STREAMABLE_II(n, name, streamBase, params1, params2) \
+  _STREAM_STREAMABLE_I(_STREAM_TUPLE_SIZE(__VA_ARGS__), name, base, streamBase, __VA_ARGS__)
+#define _STREAM_STREAMABLE_I(n, name, base, streamBase, ...) _STREAM_STREAMABLE_II(n, name, base, streamBase, (_STREAM_SER, __VA_ARGS__), (_STREAM_DECL, __VA_ARGS__), (_STREAM_BIN, __VA_ARGS__))
+#define _STREAM_STREAMABLE_II(n, name, base, streamBase, params1, params2, params3) \
     _STREAM_ATTR_##n params2 \
   protected: \
     friend struct Streaming::OnRead<name, true>; \
@@ -263,6 +273,15 @@
       if(in) \
         Streaming::onRead(*this); \
     } \
+  public: \
+    using BinaryCoded = typename Streaming::BinaryCodedIf<name, base>::type; \
+    template<typename Coder> void serializeBinary(Coder& _coder) \
+    { \
+      Streaming::codeBase<base>(_coder, *this); \
+      _STREAM_ATTR_##n params3 \
+      if(Coder::reading) \
+        Streaming::onRead(*this); \
+    } \
   }
 
 /**
@@ -0,0 +1,40 @@
+/**
+ * @file Tools/Streams/BinaryCoding.cpp
+ *
+ * Implementation of the parts of the binary coders that use the normal
+ * streams for types that cannot be coded statically.
+ */
+
+#include "BinaryCoding.h"
+#include "InStreams.h"
+#include "OutStreams.h"
+
+namespace Streaming
+{
+  void BinaryWriter::stream(const void* t, void (*write)(Out&, const void*))
+  {
+    OutBinaryMemory stream(memory);
+    write(stream, t);
+    memory += stream.getLength();
+  }
+
+  void BinarySizer::stream(const void* t, void (*write)(Out&, const void*))
+  {
+    OutBinarySize stream;
+    write(stream, t);
+    size += stream.getSize();
+  }
+
+  void BinaryReader::stream(void* t, void (*read)(In&, void*))
+  {
+    InBinaryMemory stream(memory, end - memory);
+    read(stream, t);
+    memory = static_cast<const char*>(stream.getPosition());
+    ASSERT(memory <= end);
+    if(memory > end)
+    {
+      memory = end;
+      failed = true;
+    }
+  }
+}
@@ -0,0 +1,398 @@
+/**
+ * @file Tools/Streams/BinaryCoding.h
+ *
+ * This file declares statically dispatched coders for the binary format of
+ * the streams. Classes declared with the STREAMABLE macros have a method
+ * template serializeBinary that codes all their attributes with these coders.
+ * In contrast to serialize, there are no virtual calls per attribute, no
+ * attribute names, and the specification of the types is not registered.
+ * The data written is exactly the same as the one written to OutBinaryMemory.
+ * Types that do not support this kind of coding are streamed through the
+ * normal streams, so all streamable types can be coded.
+ *
+ * Example:
+ *
+ * const size_t size = Streaming::binarySize(data);
+ * std::vector<char> buffer(size);
+ * Streaming::writeBinary(buffer.data(), data);
+ * Streaming::readBinary(buffer.data(), buffer.size(), data);
+ */
+
+#pragma once
+
+#include "Streamable.h"
+#include "Platform/BHAssert.h"
+#include <array>
+#include <cstring>
+#include <list>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Streaming
+{
+  /** A coder that writes the binary representation of data to memory. */
+  class BinaryWriter
+  {
+  private:
+    char* memory; /**< The next byte to write. */
+
+    /**
+     * Writes an object through the normal binary streams.
+     * @param t The object.
+     * @param write A function that writes the object to a stream.
+     */
+    void stream(const void* t, void (*write)(Out&, const void*));
+
+  public:
+    static const bool reading = false; /**< This coder writes. */
+
+    /** @param memory The memory that is written to. It must be large enough. */
+    explicit BinaryWriter(void* memory) : memory(static_cast<char*>(memory)) {}
+
+    /**
+     * Writes bytes.
+     * @param p The address of the bytes.
+     * @param size The number of bytes.
+     */
+    void code(const void* p, size_t size)
+    {
+      std::memcpy(memory, p, size);
+      memory += size;
+    }
+
+    /**
+     * Writes a type that cannot be coded by this coder.
+     * @param t The object that is written.
+     */
+    template<typename T> void stream(T& t)
+    {
+      stream(&t, [](Out& out, const void* t) {out << *static_cast<const T*>(t);});
+    }
+
+    /** Returns the address of the next byte to write. */
+    void* getPosition() const {return memory;}
+  };
+
+  /** A coder that determines the size of the binary representation of data. */
+  class BinarySizer
+  {
+  private:
+    size_t size = 0; /**< The number of bytes counted so far. */
+
+    /**
+     * Counts the size of an object streamed through the normal binary streams.
+     * @param t The object.
+     * @param write A function that writes the object to a stream.
+     */
+    void stream(const void* t, void (*write)(Out&, const void*));
+
+  public:
+    static const bool reading = false; /**< This coder behaves like a writer. */
+
+    /**
+     * Counts bytes.
+     * @param p The address of the bytes. Ignored.
+     * @param size The number of bytes.
+     */
+    void code(const void*, size_t size) {this->size += size;}
+
+    /**
+     * Counts the size of a type that cannot be coded by this coder.
+     * @param t The object that is counted.
+     */
+    template<typename T> void stream(T& t)
+    {
+      stream(&t, [](Out& out, const void* t) {out << *static_cast<const T*>(t);});
+    }
+
+    /** Returns the number of bytes counted. */
+    size_t getSize() const {return size;}
+  };
+
+  /** A coder that reads data from its binary representation in memory. */
+  class BinaryReader
+  {
+  private:
+    const char* memory; /**< The next byte to read. */
+    const char* end; /**< The end of the memory. */
+    bool failed = false; /**< Was more data read than the memory contained? */
+
+    /**
+     * Reads an object through the normal binary streams.
+     * @param t The object.
+     * @param read A function that reads the object from a stream.
+     */
+    void stream(void* t, void (*read)(In&, void*));
+
+  public:
+    static const bool reading = true; /**< This coder reads. */
+
+    /**
+     * @param memory The memory that is read from.
+     * @param size The size of the memory in bytes.
+     */
+    BinaryReader(const void* memory, size_t size) :
+      memory(static_cast<const char*>(memory)), end(static_cast<const char*>(memory) + size) {}
+
+    /**
+     * Reads bytes. If the memory does not contain enough bytes anymore, i.e.
+     * the data is truncated or corrupt, the bytes are set to zero and the
+     * reader stays at the end of the memory.
+     * @param p The address the bytes are written to.
+     * @param size The number of bytes.
+     */
+    void code(void* p, size_t size)
+    {
+      ASSERT(size <= static_cast<size_t>(end - memory));
+      if(size > static_cast<size_t>(end - memory))
+      {
+        std::memset(p, 0, size);
+        memory = end;
+        failed = true;
+      }
+      else
+      {
+        std::memcpy(p, memory, size);
+        memory += size;
+      }
+    }
+
+    /**
+     * Reads a type that cannot be coded by this coder.
+     * @param t The object that is read.
+     */
+    template<typename T> void stream(T& t)
+    {
+      stream(&t, [](In& in, void* t) {in >> *static_cast<T*>(t);});
+    }
+
+    /** Returns the address of the next byte to read. */
+    const void* getPosition() const {return memory;}
+
+    /** Was more data read than the memory contained? */
+    bool hasFailed() const {return failed;}
+  };
+
+  /**
+   * Does a class code all its attributes in its method serializeBinary?
+   * This is the case if it declares itself as the type BinaryCoded. Classes
+   * derived from such a class that do not declare BinaryCoded again are
+   * streamed, because their own attributes would be missing otherwise.
+   * @tparam T The type that is checked.
+   */
+  template<typename T> struct HasBinarySerializer
+  {
+    template<typename U> static char test(typename std::enable_if<std::is_same<typename U::BinaryCoded, U>::value>::type*);
+    template<typename U> static int test(...);
+    static const bool value = sizeof(test<T>(nullptr)) == sizeof(char);
+  };
+
+  /**
+   * The type BinaryCoded of a STREAMABLE class. It is the class itself if
+   * its base class codes its attributes in serializeBinary or is Streamable.
+   * Otherwise it is void, i.e. the class is always streamed.
+   * @tparam T The class declared.
+   * @tparam Base Its base class.
+   */
+  template<typename T, typename Base> struct BinaryCodedIf
+  {
+    using type = typename std::conditional<std::is_same<Base, Streamable>::value || HasBinarySerializer<Base>::value, T, void>::type;
+  };
+
+  /**
+   * Codes the attributes of the base class of a STREAMABLE class.
+   * @param coder The coder.
+   * @param t The object the base of which is coded.
+   */
+  template<typename Base, typename C> void codeBase(C& coder, Base& t) {t.serializeBinary(coder);}
+  template<> inline void codeBase<Streamable, BinaryWriter>(BinaryWriter&, Streamable&) {}
+  template<> inline void codeBase<Streamable, BinarySizer>(BinarySizer&, Streamable&) {}
+  template<> inline void codeBase<Streamable, BinaryReader>(BinaryReader&, Streamable&) {}
+
+  template<typename C, typename T> void codeBinary(C& coder, T& t);
+
+  /** Booleans are written as a single byte. */
+  template<typename C, typename T> void codeBinary(C& coder, T& t, std::integral_constant<int, 0>)
+  {
+    char c = static_cast<char>(t);
+    coder.code(&c, sizeof(c));
+    if(C::reading)
+      t = c != 0;
+  }
+
+  /** Enums are written as unsigned char or int. */
+  template<typename C, typename T> void codeBinary(C& coder, T& t, std::integral_constant<int, 1>)
+  {
+    if(sizeof(T) == 1)
+    {
+      unsigned char c = static_cast<unsigned char>(t);
+      coder.code(&c, sizeof(c));
+      if(C::reading)
+        t = static_cast<T>(c);
+    }
+    else
+    {
+      int i = static_cast<int>(t);
+      coder.code(&i, sizeof(i));
+      if(C::reading)
+        t = static_cast<T>(i);
+    }
+  }
+
+  /** Values that are written as they are in memory. */
+  template<typename C, typename T> void codeBinary(C& coder, T& t, std::integral_constant<int, 2>)
+  {
+    coder.code(&t, sizeof(T));
+  }
+
+  /** Classes that code their attributes themselves. */
+  template<typename C, typename T> void codeBinary(C& coder, T& t, std::integral_constant<int, 3>)
+  {
+    t.serializeBinary(coder);
+  }
+
+  /** All other types are streamed. */
+  template<typename C, typename T> void codeBinary(C& coder, T& t, std::integral_constant<int, 4>)
+  {
+    coder.stream(t);
+  }
+
+  /**
+   * Codes a number of elements that are stored consecutively in memory.
+   * @param coder The coder.
+   * @param elems The address of the first element.
+   * @param n The number of elements.
+   */
+  template<typename C, typename E> void codeBinaryElements(C& coder, E* elems, size_t n)
+  {
+    if(IsBinaryCopyable<E>::value && !std::is_same<E, bool>::value)
+      coder.code(elems, n * sizeof(E));
+    else
+      for(size_t i = 0; i < n; ++i)
+        codeBinary(coder, elems[i]);
+  }
+
+  template<typename C> void codeBinary(C& coder, std::string& s)
+  {
+    unsigned size = static_cast<unsigned>(s.size());
+    coder.code(&size, sizeof(size));
+    if(C::reading)
+      s.resize(size);
+    if(size)
+      coder.code(&s[0], size);
+  }
+
+  template<typename C, typename E, size_t N> void codeBinary(C& coder, E(&s)[N])
+  {
+    codeBinaryElements(coder, s, N);
+  }
+
+  template<typename C, typename E, typename A> void codeBinary(C& coder, std::vector<E, A>& s)
+  {
+    unsigned size = static_cast<unsigned>(s.size());
+    coder.code(&size, sizeof(size));
+    if(C::reading)
+      s.resize(size);
+    if(size)
+      codeBinaryElements(coder, s.data(), size);
+  }
+
+  template<typename C, typename E, typename A> void codeBinary(C& coder, std::list<E, A>& s)
+  {
+    unsigned size = static_cast<unsigned>(s.size());
+    coder.code(&size, sizeof(size));
+    if(C::reading)
+      s.resize(size);
+    for(E& elem : s)
+      codeBinary(coder, elem);
+  }
+
+  template<typename C, typename E, size_t n> void codeBinary(C& coder, std::array<E, n>& s)
+  {
+    unsigned size = static_cast<unsigned>(n);
+    coder.code(&size, sizeof(size));
+    codeBinaryElements(coder, s.data(), n);
+  }
+
+  /**
+   * Codes a value in the binary format of the streams.
+   * @param coder The coder, i.e. a BinaryWriter, a BinarySizer or a BinaryReader.
+   * @param t The value. It is only changed by a BinaryReader.
+   */
+  template<typename C, typename T> void codeBinary(C& coder, T& t)
+  {
+    codeBinary(coder, t, std::integral_constant<int,
+               std::is_same<T, bool>::value ? 0 :
+               std::is_enum<T>::value ? 1 :
+               IsBinaryCopyable<T>::value ? 2 :
+               HasBinarySerializer<T>::value ? 3 : 4>());
+  }
+
+  /**
+   * Determines the number of bytes the binary representation of a value requires.
+   * @param t The value.
+   * @return The size in bytes.
+   */
+  template<typename T> size_t binarySize(const T& t)
+  {
+    BinarySizer sizer;
+    codeBinary(sizer, const_cast<T&>(t));
+    return sizer.getSize();
+  }
+
+  /**
+   * Writes the binary representation of a value to memory.
+   * @param memory The memory. It must be large enough, i.e. at least binarySize(t).
+   * @param t The value.
+   * @return The address after the last byte written.
+   */
+  template<typename T> void* writeBinary(void* memory, const T& t)
+  {
+    BinaryWriter writer(memory);
+    codeBinary(writer, const_cast<T&>(t));
+    return writer.getPosition();
+  }
+
+  /**
+   * Reads a value from its binary representation in memory.
+   * @param memory The memory.
+   * @param size The size of the memory in bytes.
+   * @param t The value.
+   * @return The address after the last byte read.
+   */
+  template<typename T> const void* readBinary(const void* memory, size_t size, T& t)
+  {
+    BinaryReader reader(memory, size);
+    codeBinary(reader, t);
+    return reader.getPosition();
+  }
+
+  /**
+   * The binary coding functions of a type derived from Streamable, for the
+   * case that the type is not known statically, e.g. for the representations
+   * on the blackboard.
+   */
+  struct BinaryFunctions
+  {
+    void (*size)(BinarySizer& coder, const Streamable& t); /**< Counts the size of an object. */
+    void (*write)(BinaryWriter& coder, const Streamable& t); /**< Writes an object. */
+    void (*read)(BinaryReader& coder, Streamable& t); /**< Reads an object. */
+
+    /**
+     * Returns the functions for a certain type.
+     * @tparam T The type. It must be derived from Streamable.
+     * @return The functions that code objects of that type.
+     */
+    template<typename T> static const BinaryFunctions& get()
+    {
+      static const BinaryFunctions functions =
+      {
+        [](BinarySizer& coder, const Streamable& t) {codeBinary(coder, const_cast<T&>(static_cast<const T&>(t)));},
+        [](BinaryWriter& coder, const Streamable& t) {codeBinary(coder, const_cast<T&>(static_cast<const T&>(t)));},
+        [](BinaryReader& coder, Streamable& t) {codeBinary(coder, static_cast<T&>(t));}
+      };
+      return functions;
+    }
+  };
+}
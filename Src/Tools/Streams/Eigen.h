@@ -13,6 +13,15 @@
 
 #include "Streamable.h"
 
+namespace Streaming
+{
+  /** Fixed-size Eigen matrices are streamed in the order of their elements in memory. */
+  template<typename T, int ROWS, int COLS, int OPTIONS> struct IsBinaryCopyable<Eigen::Matrix<T, ROWS, COLS, OPTIONS, ROWS, COLS>> :
+    std::integral_constant<bool, ROWS != Eigen::Dynamic && COLS != Eigen::Dynamic && IsBinaryCopyable<T>::value> {};
+
+  template<typename T, int OPTIONS> struct IsBinaryCopyable<Eigen::Array<T, 2, 1, OPTIONS, 2, 1>> : IsBinaryCopyable<T> {};
+}
+
 /**
  * Helper class to stream a fixed-sized row or column of an Eigen matrix.
  * @param T The element type of the row or column.
@@ -98,8 +98,16 @@ protected:
   void serialize(In* in, Out* out)
   {
     STREAM_REGISTER_BEGIN
-    for(int i = 0; i < numOfElements; ++i)
-      Streaming::streamIt(in, out, getEnumName(static_cast<Enum>(i)), (*this)[i], reinterpret_cast<const char* (*)(int)>(getElemName));
+    if(Streaming::IsBinaryCopyable<Elem>::value && !Streaming::isRegistering() && (in ? in->isBinary() : out->isBinary()))
+    {
+      if(in)
+        in->read(this->data(), sizeof(Elem) * numOfElements);
+      else
+        out->write(this->data(), sizeof(Elem) * numOfElements);
+    }
+    else
+      for(int i = 0; i < numOfElements; ++i)
+        Streaming::streamIt(in, out, getEnumName(static_cast<Enum>(i)), (*this)[i], reinterpret_cast<const char* (*)(int)>(getElemName));
     STREAM_REGISTER_FINISH
   }
 };
@@ -390,6 +390,7 @@ void InMap::parse(In& stream, const std::string& name)
 
 void InMap::printError(const std::string& msg)
 {
+  errors = true;
   if(showErrors)
   {
     std::string path = "";
@@ -607,11 +608,19 @@ void InMap::deselect()
 }
 
 InMapFile::InMapFile(const std::string& name, bool showErrors) :
-  InMap(showErrors),
-  stream(name)
+  InMap(showErrors)
 {
-  if(stream.exists())
-    parse(stream, stream.getFullName());
+  File file(name, "rb");
+  fileExists = file.exists();
+  if(fileExists)
+  {
+    // The parser reads single characters, which is a lot cheaper from memory than from the file.
+    std::vector<char> buffer(file.getSize());
+    if(!buffer.empty())
+      file.read(buffer.data(), buffer.size());
+    InBinaryMemory stream(buffer.data(), buffer.size());
+    parse(stream, file.getFullName());
+  }
 }
 
 InMapMemory::InMapMemory(const void* memory, size_t size, bool showErrors) :
@@ -809,6 +809,11 @@ public:
     return memory != nullptr && memory >= end;
   }
 
+  /**
+   * Returns the address of the next byte to read.
+   */
+  const void* getPosition() const {return memory;}
+
 protected:
   /**
    * Opens the stream.
@@ -1008,6 +1013,7 @@ private:
   std::string name; /**< The name of the opened file. */
   std::vector<Entry> stack; /**< The hierarchy of values to read. */
   bool showErrors; /**< Show error messages if specification does not match. */
+  bool errors = false; /**< Did the specification not match? */
 
   /**
    * The method OUTPUTs an error message.
@@ -1125,6 +1131,12 @@ protected:
   virtual void inEndL() {}
 
 public:
+  /**
+   * Did anything read not match the specification?
+   * @return Were there errors, even if they were not shown?
+   */
+  bool hasErrors() const {return errors;}
+
   /**
    * The function reads a number of bytes from a stream.
    * Not allowed for this stream!
@@ -1176,7 +1188,7 @@ public:
 class InMapFile : public InMap
 {
 private:
-  InBinaryFile stream;
+  bool fileExists; /**< Was the file found? */
 
 public:
   /**
@@ -1190,7 +1202,7 @@ public:
    * The function states whether this stream actually exists.
    * @return Does the stream exist?
    */
-  bool exists() {return stream.exists();}
+  bool exists() {return fileExists;}
 };
 
 /**
@@ -78,6 +78,7 @@ public:
   void finishRegistration();
   void registerWithSpecification(const char* name, const std::type_info& ti);
   void registerEnum(const std::type_info& ti, const char* (*fp)(int));
+  bool isRegistering() const {return registering;}
 
   /**
    * Check whether the specifications of two types are structurally identical,
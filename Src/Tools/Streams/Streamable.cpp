@@ -80,6 +80,11 @@ namespace Streaming
 #endif
   }
 
+  bool isRegistering()
+  {
+    return Global::getStreamHandler().isRegistering();
+  }
+
   Out& dummyStream()
   {
     return Global::getStreamHandler().dummyStream;
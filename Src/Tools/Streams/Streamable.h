@@ -10,6 +10,7 @@
 #pragma once
 
 #include <typeinfo>
+#include <type_traits>
 #include <vector>
 #include <list>
 #include <array>
@@ -97,6 +98,28 @@ Out& operator<<(Out& out, const Streamable& streamable);
 
 namespace Streaming
 {
+  /**
+   * Can arrays of a type be streamed to and from binary streams by copying
+   * their memory? This is the case if the streaming operators write exactly
+   * the bytes that represent a value in memory. Enums are written as
+   * unsigned char or int, so this only holds for enums of these sizes.
+   * Types for which this is true can specialize this template.
+   * @tparam T The type of the array elements.
+   */
+  template<typename T> struct IsBinaryCopyable :
+    std::integral_constant<bool, std::is_arithmetic<T>::value || (std::is_enum<T>::value && (sizeof(T) == 1 || sizeof(T) == sizeof(int)))> {};
+
+  /** Angles are streamed as floats. */
+  template<> struct IsBinaryCopyable<Angle> : std::true_type {};
+
+  /**
+   * Is the stream handler registering the specification of the type whose
+   * registration was started last? Only then, its members must be streamed one
+   * by one.
+   * @return Is the type registered for the first time?
+   */
+  bool isRegistering();
+
   Out& dummyStream();
 
   template<typename T, typename A>
@@ -182,9 +205,32 @@ namespace Streaming
   inline In& streamStaticArray(In& in, double inArray[], size_t size, const char* (*enumToString)(int)) {return streamBasicStaticArray(in, inArray, size, enumToString);}
   inline Out& streamStaticArray(Out& out, double outArray[], size_t size, const char* (*enumToString)(int)) {return streamBasicStaticArray(out, outArray, size, enumToString);}
   template<class T>
-  In& streamStaticArray(In& in, T inArray[], size_t size, const char* (*enumToString)(int)) {return streamComplexStaticArray(in, inArray, size, enumToString);}
+  In& streamStaticArray(In& in, T inArray[], size_t size, const char* (*enumToString)(int))
+  {
+    if(IsBinaryCopyable<T>::value && in.isBinary() && size)
+    {
+      if(std::is_class<T>::value)
+        dummyStream() << inArray[0]; // register the specification of the element type
+      in.read(inArray, size);
+      return in;
+    }
+    else
+      return streamComplexStaticArray(in, inArray, size, enumToString);
+  }
+
   template<class T>
-  Out& streamStaticArray(Out& out, T outArray[], size_t size, const char* (*enumToString)(int)) {return streamComplexStaticArray(out, outArray, size, enumToString);}
+  Out& streamStaticArray(Out& out, T outArray[], size_t size, const char* (*enumToString)(int))
+  {
+    if(IsBinaryCopyable<T>::value && out.isBinary() && size)
+    {
+      if(std::is_class<T>::value)
+        dummyStream() << outArray[0]; // register the specification of the element type
+      out.write(outArray, size);
+      return out;
+    }
+    else
+      return streamComplexStaticArray(out, outArray, size, enumToString);
+  }
 
   template<class T, class U> void cast(T& t, const U& u) {t = static_cast<T>(u);}
 
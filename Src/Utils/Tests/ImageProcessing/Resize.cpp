@@ -0,0 +1,94 @@
+#include "Tools/ImageProcessing/Resize.h"
+#include "Tools/Math/Random.h"
+
+#include "bench.h"
+
+#include "gtest/gtest.h"
+
+#include <cstdlib>
+
+#ifndef NDEBUG
+#define RUNS 10
+#define TRIES 10
+#else
+#define RUNS 100
+#define TRIES 50
+#endif
+
+static void fillRandomly(TImage<unsigned char>& image)
+{
+  for(int y = 0; y < image.height; ++y)
+    for(int x = 0; x < image.width; ++x)
+      image[y][x] = static_cast<unsigned char>(Random::uniformInt(255));
+}
+
+GTEST_TEST(Resize, shrinkGrayscale)
+{
+  TImage<unsigned char> src(640, 480);
+  TImage<unsigned char> dest;
+  fillRandomly(src);
+
+  for(unsigned int exponent = 1; exponent <= 4; ++exponent)
+  {
+    const int scale = 1 << exponent;
+    Resize::shrinkGrayscaleNxN(src, dest, exponent);
+    ASSERT_EQ(src.width / scale, dest.width);
+    ASSERT_EQ(src.height / scale, dest.height);
+
+    for(int y = 0; y < dest.height; ++y)
+      for(int x = 0; x < dest.width; ++x)
+      {
+        int sum = 0;
+        for(int j = 0; j < scale; ++j)
+          for(int i = 0; i < scale; ++i)
+            sum += src[y * scale + j][x * scale + i];
+        EXPECT_LE(std::abs(sum / (scale * scale) - static_cast<int>(dest[y][x])), 1);
+      }
+  }
+}
+
+GTEST_TEST(Resize, shrinkColorChannel)
+{
+  // 320 pixels wide rows use the SIMD variants, 328 pixels wide rows the scalar ones
+  for(int width : {320, 328})
+  {
+    TImage<unsigned char> src(width, 240);
+    TImage<unsigned char> dest;
+    fillRandomly(src);
+
+    for(unsigned int exponent = 1; exponent <= 4; ++exponent)
+    {
+      const int scale = 1 << exponent;
+      const int horizontalScale = scale >> 1;
+      Resize::shrinkColorChannelNxN(src, dest, exponent);
+      ASSERT_EQ(src.width / horizontalScale, dest.width);
+      ASSERT_EQ(src.height / scale, dest.height);
+
+      for(int y = 0; y < dest.height; ++y)
+        for(int x = 0; x < dest.width; ++x)
+        {
+          int sum = 0;
+          for(int j = 0; j < scale; ++j)
+            for(int i = 0; i < horizontalScale; ++i)
+              sum += src[y * scale + j][x * horizontalScale + i];
+          EXPECT_LE(std::abs(sum / (scale * horizontalScale) - static_cast<int>(dest[y][x])), 1);
+        }
+    }
+  }
+}
+
+GTEST_TEST(Resize, benchShrinkGrayscale)
+{
+  TImage<unsigned char> src(640, 480);
+  TImage<unsigned char> dest;
+  fillRandomly(src);
+
+  // One line per scale in the form "shrinkGrayscale<N>x<N>;<best>;<avg>;<worst>" (in s per run)
+  for(unsigned int exponent = 1; exponent <= 4; ++exponent)
+  {
+    Eigen::BenchTimer timer;
+    BENCH(timer, TRIES, RUNS, Resize::shrinkGrayscaleNxN(src, dest, exponent));
+    PRINTF("shrinkGrayscale%dx%d;%.6f;%.6f;%.6f\n", 1 << exponent, 1 << exponent,
+           timer.best() / RUNS, timer.total() / (TRIES * RUNS), timer.worst() / RUNS);
+  }
+}
@@ -0,0 +1,30 @@
+#include "Tools/Logging/DeltaCoding.h"
+#include "Tools/MessageQueue/MessageQueue.h"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+GTEST_TEST(DeltaCoding, RoundTrip)
+{
+  MessageQueue queue;
+  queue.setSize(100000);
+  for(int frame = 0; frame < 10; ++frame)
+  {
+    queue.out.bin << frame << 1.5f * frame << 42;
+    queue.out.finishMessage(idFrameInfo);
+    for(int i = 0; i < frame % 3; ++i)
+      queue.out.bin << frame;
+    queue.out.finishMessage(idBallModel);
+    queue.out.bin << 'c';
+    queue.out.finishMessage(idProcessFinished);
+  }
+
+  const std::vector<char> original(queue.getStreamedData(), queue.getStreamedData() + queue.getStreamedSize());
+  std::vector<char> encoded(original);
+  DeltaCoding::encode(encoded.data(), encoded.size());
+  EXPECT_NE(original, encoded);
+
+  DeltaCoding::decode(encoded.data(), encoded.size());
+  EXPECT_EQ(original, encoded);
+}
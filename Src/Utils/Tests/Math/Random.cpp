@@ -0,0 +1,40 @@
+#include "Tools/Math/Random.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <vector>
+
+static std::vector<float> drawNormals(unsigned int seed, size_t count)
+{
+  Random::seed(seed);
+  std::vector<float> values;
+  for(size_t i = 0; i < count; ++i)
+    values.push_back(Random::normal(2.f, 3.f));
+  return values;
+}
+
+GTEST_TEST(Random, normalIsReproducibleAfterSeed)
+{
+  // An odd number of values leaves a cached second value in the distribution.
+  const std::vector<float> first = drawNormals(42, 7);
+  const std::vector<float> second = drawNormals(42, 7);
+  EXPECT_EQ(first, second);
+}
+
+GTEST_TEST(Random, normalMeanAndSigma)
+{
+  Random::seed(1);
+  const int count = 100000;
+  double sum = 0.0;
+  double sqrSum = 0.0;
+  for(int i = 0; i < count; ++i)
+  {
+    const double value = Random::normal(2.0, 3.0);
+    sum += value;
+    sqrSum += value * value;
+  }
+  const double mean = sum / count;
+  EXPECT_NEAR(2.0, mean, 0.05);
+  EXPECT_NEAR(3.0, std::sqrt(sqrSum / count - mean * mean), 0.05);
+}
@@ -0,0 +1,51 @@
+#include "Tools/Modeling/BallPhysics.h"
+#include "Tools/Math/Random.h"
+
+#include "bench.h"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+#ifndef NDEBUG
+#define RUNS 1000
+#define TRIES 10
+#else
+#define RUNS 100000
+#define TRIES 50
+#endif
+
+static const float friction = -0.3f;
+
+GTEST_TEST(BallPhysics, timeForDistance)
+{
+  for(int i = 0; i < 1000; ++i)
+  {
+    const Vector2f velocity(Random::uniform(-3000.f, 3000.f), Random::uniform(-3000.f, 3000.f));
+    const float rollingDistance = BallPhysics::getEndPosition(Vector2f::Zero(), velocity, friction).norm();
+
+    // Beyond the point where the ball stops, it never arrives
+    EXPECT_EQ(std::numeric_limits<float>::max(), BallPhysics::timeForDistance(velocity, rollingDistance * 1.01f + 1.f, friction));
+
+    // Before that, the ball has rolled exactly the distance after the time returned
+    const float distance = rollingDistance * Random::uniform(0.f, 0.99f);
+    const float time = BallPhysics::timeForDistance(velocity, distance, friction);
+    ASSERT_NE(std::numeric_limits<float>::max(), time);
+    EXPECT_NEAR(distance, BallPhysics::propagateBallPosition(Vector2f::Zero(), velocity, time, friction).norm(), 1.f);
+  }
+}
+
+GTEST_TEST(BallPhysics, benchTimeForDistance)
+{
+  std::vector<Vector2f> velocities;
+  for(int i = 0; i < 1000; ++i)
+    velocities.emplace_back(Random::uniform(-3000.f, 3000.f), Random::uniform(-3000.f, 3000.f));
+
+  // In the form "timeForDistance;<best>;<avg>;<worst>" (in s per run)
+  size_t index = 0;
+  volatile float time;
+  Eigen::BenchTimer timer;
+  BENCH(timer, TRIES, RUNS, time = BallPhysics::timeForDistance(velocities[++index % velocities.size()], 1000.f, friction));
+  static_cast<void>(time);
+  PRINTF("timeForDistance;%.9f;%.9f;%.9f\n", timer.best() / RUNS, timer.total() / (TRIES * RUNS), timer.worst() / RUNS);
+}
@@ -0,0 +1,67 @@
+#include "Tools/Streams/AutoStreamable.h"
+#include "Tools/Streams/Enum.h"
+#include "Tools/Streams/OutStreams.h"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+STREAMABLE(BinaryCodingInner,
+{,
+  (std::string)("inner") name,
+  (std::vector<short>) values,
+});
+
+STREAMABLE_WITH_BASE(BinaryCodingOuter, BinaryCodingInner,
+{
+  ENUM(Letter,
+  {,
+    a,
+    b,
+    c,
+  });
+  int reads = 0;
+  void onRead() {++reads;},
+
+  (int)(0) number,
+  (bool)(false) flag,
+  (Letter)(a) letter,
+  (float[2]) pair,
+  (std::array<BinaryCodingInner, 2>) inners,
+});
+
+GTEST_TEST(BinaryCoding, SameAsStreams)
+{
+  BinaryCodingOuter outer;
+  outer.values = {1, -2, 3};
+  outer.number = 42;
+  outer.flag = true;
+  outer.letter = BinaryCodingOuter::c;
+  outer.pair[0] = 1.5f;
+  outer.pair[1] = -2.5f;
+  outer.inners[1].name = "second";
+
+  // The attributes in the order of streaming, written as primitive types
+  OutBinarySize expectedSize;
+  expectedSize << std::string("inner") << 3u << short(1) << short(-2) << short(3) << 42 << true << static_cast<unsigned char>(BinaryCodingOuter::c)
+               << 1.5f << -2.5f << 2u << std::string("inner") << 0u << std::string("second") << 0u;
+  std::vector<char> expected(expectedSize.getSize());
+  OutBinaryMemory stream(expected.data());
+  stream << std::string("inner") << 3u << short(1) << short(-2) << short(3) << 42 << true << static_cast<unsigned char>(BinaryCodingOuter::c)
+         << 1.5f << -2.5f << 2u << std::string("inner") << 0u << std::string("second") << 0u;
+
+  ASSERT_EQ(expected.size(), Streaming::binarySize(outer));
+  std::vector<char> data(expected.size());
+  EXPECT_EQ(data.data() + data.size(), Streaming::writeBinary(data.data(), outer));
+  EXPECT_EQ(expected, data);
+
+  BinaryCodingOuter copy;
+  EXPECT_EQ(data.data() + data.size(), Streaming::readBinary(data.data(), data.size(), copy));
+  EXPECT_EQ(1, copy.reads);
+  EXPECT_EQ(outer.values, copy.values);
+  EXPECT_EQ(42, copy.number);
+  EXPECT_TRUE(copy.flag);
+  EXPECT_EQ(BinaryCodingOuter::c, copy.letter);
+  EXPECT_EQ(-2.5f, copy.pair[1]);
+  EXPECT_EQ("second", copy.inners[1].name);
+}
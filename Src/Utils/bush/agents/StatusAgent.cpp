@@ -41,9 +41,12 @@ void StatusAgent::setPings(ENetwork, std::map<std::string, double>*)
 
   for(auto it = Session::getInstance().robotsByName.cbegin(), end = Session::getInstance().robotsByName.cend(); it != end; ++it)
   {
-    if(currentTime - timeOfLastUpdate[it->first] > UPDATE_TIME && pingAgent->getBestNetwork(it->second) != ENetwork::NONE)
+    const ENetwork network = pingAgent->getBestNetwork(it->second);
+    // Do not start another query while the previous one is still waiting for a slow robot
+    if(currentTime - timeOfLastUpdate[it->first] > UPDATE_TIME && network != ENetwork::NONE
+       && processes[it->first]->state() == QProcess::NotRunning)
     {
-      const std::string ip = pingAgent->getBestNetwork(it->second) == ENetwork::LAN ? it->second->lan : it->second->wlan;
+      const std::string ip = network == ENetwork::LAN ? it->second->lan : it->second->wlan;
       const std::string cmd = "battery.py " + it->second->name + " | grep " + it->second->name;
 
       processes[it->first]->start(fromString(remoteCommandForQProcess(cmd, ip)));
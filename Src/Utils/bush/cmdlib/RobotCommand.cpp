@@ -11,6 +11,8 @@ bool RobotCommand::execute(Context& context, const std::vector<std::string>& par
     return false;
   }
 
+  // the command object is reused, so results of a former execution must not leak into this one
+  status = true;
   if(!preExecution(context, params))
     return false;
 
@@ -1,5 +1,6 @@
 #include <iostream>
 #include "Platform/File.h"
+#include <QElapsedTimer>
 #include <QString>
 #include <QStringList>
 #include "Utils/bush/agents/PingAgent.h"
@@ -26,6 +27,8 @@ bool DeployCmd::DeployTask::execute()
    * adjust the timeout of rsync to determine faster if the connection is
    * lost.
    */
+  QElapsedTimer timer;
+  timer.start();
   QString command = DeployCmd::getCommand();
 
   QStringList args = QStringList();
@@ -62,14 +65,15 @@ bool DeployCmd::DeployTask::execute()
 
   ProcessRunner r(context(), command, args);
   r.run();
+  const std::string duration = toString(QString::number(timer.elapsed() / 1000.0, 'f', 1)) + " s";
   if(r.error())
   {
-    context().errorLine("Deploy of \"" + robot->name + "\" failed!");
+    context().errorLine("Deploy of \"" + robot->name + "\" failed after " + duration + "!");
     return false;
   }
   else
   {
-    context().printLine("Success! (" + robot->name + ")");
+    context().printLine("Success! (" + robot->name + ", " + duration + ")");
     return true;
   }
 }
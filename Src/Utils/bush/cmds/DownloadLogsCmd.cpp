@@ -8,6 +8,7 @@
 #include "DownloadLogsCmd.h"
 #include <iostream>
 #include "Platform/File.h"
+#include <QElapsedTimer>
 #include <QString>
 #include <QStringList>
 #include "Utils/bush/agents/PingAgent.h"
@@ -55,11 +56,13 @@ Task* DownloadLogsCmd::perRobotExecution(Context& context, Robot& robot)
 
 bool DownloadLogsCmd::postExecution(Context& context, const std::vector<std::string>& params)
 {
-  return true;
+  return RobotCommand::postExecution(context, params);
 }
 
 bool DownloadLogsCmd::DownloadLogsTask::execute()
 {
+  QElapsedTimer timer;
+  timer.start();
   QString command = getCommand();
   QStringList args = QStringList();
   // args.push_back("-d"); //delete files after download.
@@ -69,17 +72,18 @@ bool DownloadLogsCmd::DownloadLogsTask::execute()
 
   ProcessRunner r(context(), command, args);
   r.run();
+  const std::string duration = toString(QString::number(timer.elapsed() / 1000.0, 'f', 1)) + " s";
 
   if(r.error())
   {
-    context().errorLine("Download failed!");
+    context().errorLine("Download from \"" + robot->name + "\" failed after " + duration + "!");
+    return false;
   }
   else
   {
-    context().printLine("Success! (" + robot->name + ")");
+    context().printLine("Success! (" + robot->name + ", " + duration + ")");
+    return true;
   }
-
-  return true;
 }
 
 DownloadLogsCmd::DownloadLogsTask::DownloadLogsTask(Context& context,
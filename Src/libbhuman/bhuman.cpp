@@ -9,6 +9,9 @@
 #include <semaphore.h>
 #include <csignal>
 #include <sys/resource.h>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <ctime>
 #include <cstring>
 
@@ -380,6 +383,11 @@ private:
   static const int allowedFrameDrops = 6; /**< Maximum number of frame drops allowed before Nao sits down. */
 #endif
 
+  static const bool fallReflex = true; /**< Lower the stiffness when falling while bhuman misses actuator cycles? */
+  static constexpr float fallReflexAngle = 0.7f; /**< The torso tilt beyond which the robot may be falling (in radians). */
+  static constexpr float fallReflexGyro = 1.5f; /**< The minimum angular velocity away from upright while falling (in radians/s). */
+  static constexpr float fallReflexStiffness = 0.3f; /**< The maximum stiffness while the reflex is active. */
+
   int memoryHandle; /**< The file handle of the shared memory. */
   LBHData* data; /**< The shared memory. */
   sem_t* sem; /**< The semaphore used to notify bhuman about new data. */
@@ -389,6 +397,7 @@ private:
   AL::ALValue stiffnessRequest;
   AL::ALValue ledRequest;
   float* sensorPtrs[lbhNumOfSensorIds]; /** Pointers to where NaoQi stores the current sensor values. */
+  const int* gameControlPublishCounter = nullptr; /**< Points to where libgamectrl counts the packets it published in ALMemory. */
 
   int dcmTime = 0; /**< Current dcm time, updated at each onPreProcess call. */
 
@@ -397,6 +406,7 @@ private:
   int lastReadingActuators = -1; /**< The previous actuators read. For detecting frames without seemingly new data from bhuman. */
   int actuatorDrops = 0; /**< The number of frames without seemingly new data from bhuman. */
   int frameDrops = allowedFrameDrops + 1; /**< The number frames without a reaction from bhuman. */
+  bool fallReflexActive = false; /**< Was the fall reflex active in the previous cycle? */
 
   enum State {sitting, standingUp, standing, sittingDown, preShuttingDown, preShuttingDownWhileSitting, shuttingDown} state;
   float phase = 0.f; /**< How far is the Nao in its current standing up or sitting down motion [0 ... 1]? */
@@ -408,9 +418,21 @@ private:
   float startAngles[lbhNumOfPositionActuatorIds]; /**< Start angles for standing up or sitting down. */
   float startStiffness[lbhNumOfPositionActuatorIds]; /**< Start stiffness for sitting down. */
 
+  int lastGameControlPublishCounter = 0; /**< The value of the publish counter when the GameController data was copied the last time. */
   int startPressedTime = 0; /**< The last time the chest button was not pressed. */
   unsigned lastBHumanStartTime = 0; /**< The last time bhuman was started. */
 
+  /**
+   * Returns the current time of the monotonic clock, which is shared with bhuman.
+   * @return The time in microseconds. It wraps around after about 71 minutes.
+   */
+  static unsigned getMicroseconds()
+  {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<unsigned>(ts.tv_sec * 1000000ull + ts.tv_nsec / 1000);
+  }
+
   /** Close all resources acquired. Called when initialization failed or during destruction. */
   void close()
   {
@@ -592,6 +614,41 @@ private:
     }
   }
 
+  /**
+   * Checks whether the robot is falling with the IMU data that just arrived.
+   * Tilting further away from upright distinguishes falling from getting up.
+   * @return Is the robot falling?
+   */
+  bool isFalling() const
+  {
+    const float angleX = *sensorPtrs[angleXSensor];
+    const float angleY = *sensorPtrs[angleYSensor];
+    const float gyroX = *sensorPtrs[gyroXSensor];
+    const float gyroY = *sensorPtrs[gyroYSensor];
+    return (std::abs(angleX) > fallReflexAngle && angleX * gyroX > 0.f && std::abs(gyroX) > fallReflexGyro)
+           || (std::abs(angleY) > fallReflexAngle && angleY * gyroY > 0.f && std::abs(gyroY) > fallReflexGyro);
+  }
+
+  /**
+   * Limits the stiffness of all joints to protect the robot while it is falling.
+   * This is only used if bhuman missed the actuator cycle and thus cannot react
+   * itself. Otherwise, its FallEngine already reacts in the same cycle.
+   * @param actuators The actuator values that would be set.
+   * @return The protective actuator values.
+   */
+  float* protectFall(const float* actuators)
+  {
+    static float protectiveActuators[lbhNumOfActuatorIds];
+
+    if(!fallReflexActive)
+      fprintf(stderr, "libbhuman: falling while bhuman does not react.\n");
+    memcpy(protectiveActuators, actuators, sizeof(protectiveActuators));
+    for(int i = headYawStiffnessActuator; i < headYawStiffnessActuator + lbhNumOfStiffnessActuatorIds; ++i)
+      if(protectiveActuators[i] > fallReflexStiffness)
+        protectiveActuators[i] = fallReflexStiffness;
+    return protectiveActuators;
+  }
+
   /** The method sets all actuators. */
   void setActuators()
   {
@@ -600,19 +657,31 @@ private:
     {
       dcmTime = proxy->getTime(0);
 
+      ++data->dcmCycles;
       data->readingActuators = data->newestActuators;
       if(data->readingActuators == lastReadingActuators)
       {
         if(actuatorDrops == 0)
           fprintf(stderr, "libbhuman: missed actuator request.\n");
         ++actuatorDrops;
+        ++data->missedActuatorCycles;
       }
       else
+      {
         actuatorDrops = 0;
+        const unsigned sensorsTime = data->actuatorsSensorsTime[data->readingActuators];
+        if(sensorsTime)
+          ++data->latencyHistogram[std::min((getMicroseconds() - sensorsTime) / 1000, static_cast<unsigned>(lbhNumOfTimingBins - 1))];
+      }
       lastReadingActuators = data->readingActuators;
       float* readingActuators = data->actuators[data->readingActuators];
       float* actuators = handleState(readingActuators);
 
+      const bool falling = fallReflex && state == standing && actuatorDrops > 0 && isFalling();
+      if(falling)
+        actuators = protectFall(actuators);
+      fallReflexActive = falling;
+
       if(state != standing)
       {
         if(frameDrops > 0 || state == shuttingDown)
@@ -696,12 +765,36 @@ private:
       for(int i = 0; i < lbhNumOfSensorIds; ++i)
         sensors[i] = *sensorPtrs[i];
 
-      AL::ALValue value = memory->getData("GameCtrl/RoboCupGameControlData");
-      if(value.isBinary() && value.getSize() == sizeof(RoboCup::RoboCupGameControlData))
-        memcpy(&data->gameControlData[writingSensors], value, sizeof(RoboCup::RoboCupGameControlData));
+      // keep the IMU sample even if bhuman will not take this sensor buffer
+      const unsigned inertialSample = data->inertialSampleCount;
+      float* sample = data->inertialSamples[inertialSample % lbhNumOfInertialSamples];
+      for(int i = 0; i < lbhNumOfInertialSensors; ++i)
+        sample[i] = sensors[gyroXSensor + i];
+      std::atomic_thread_fence(std::memory_order_release);
+      data->inertialSampleCount = inertialSample + 1;
+      data->sensorsInertialSample[writingSensors] = inertialSample;
 
+      data->sensorsTime[writingSensors] = getMicroseconds() | 1; // make sure it's non zero
       data->newestSensors = writingSensors;
 
+      // libgamectrl counts the packets it publishes, so a change is noticed in the DCM cycle it happened
+      // in, but the packet is only copied when it changed. It is published with a sequence counter, so
+      // bhuman never blocks this thread.
+      if(*gameControlPublishCounter != lastGameControlPublishCounter)
+      {
+        lastGameControlPublishCounter = *gameControlPublishCounter;
+        AL::ALValue value = memory->getData("GameCtrl/RoboCupGameControlData");
+        if(value.isBinary() && value.getSize() == sizeof(RoboCup::RoboCupGameControlData)
+           && memcmp(&data->gameControlData, value, sizeof(RoboCup::RoboCupGameControlData)))
+        {
+          ++data->gameControlDataVersion;
+          std::atomic_thread_fence(std::memory_order_release);
+          memcpy(&data->gameControlData, value, sizeof(RoboCup::RoboCupGameControlData));
+          std::atomic_thread_fence(std::memory_order_release);
+          ++data->gameControlDataVersion;
+        }
+      }
+
       // detect shutdown request via chest-button
       if(*sensorPtrs[chestButtonSensor] == 0.f)
         startPressedTime = dcmTime;
@@ -732,6 +825,7 @@ private:
           if(frameDrops == 0)
             fprintf(stderr, "libbhuman: dropped sensor data.\n");
           ++frameDrops;
+          ++data->droppedSensorCycles;
         }
       }
     }
@@ -884,6 +978,13 @@ public:
             for(int i = 0; i < lbhNumOfSensorIds; ++i)
               sensorPtrs[i] = (float*) memory->getDataPtr(sensorNames[i]);
 
+            // prepare pointer to the publish counter of libgamectrl
+            // If libgamectrl did not create it yet, do it here. This actually has a race condition.
+            if(memory->getDataList("GameCtrl/publishCounter").empty())
+              memory->insertData("GameCtrl/publishCounter", 0);
+            gameControlPublishCounter = (int*) memory->getDataPtr("GameCtrl/publishCounter");
+            lastGameControlPublishCounter = *gameControlPublishCounter - 1; // copy the current packet in the first cycle
+
             // initialize requested actuators
             memset(requestedActuators, 0, sizeof(requestedActuators));
             for(int i = faceLedRedLeft0DegActuator; i < chestBoardLedRedActuator; ++i)
@@ -340,6 +340,9 @@ enum LBHTeamInfoIds
 const int lbhNumOfStiffnessActuatorIds = lbhNumOfPositionActuatorIds;
 const int lbhNumOfLedActuatorIds = rFootLedBlueActuator + 1 - faceLedRedLeft0DegActuator;
 const int lbhNumOfDifSensors = 4;
+const int lbhNumOfTimingBins = 16; /**< The number of 1 ms bins of the timing histograms. The last one also counts all longer durations. */
+const int lbhNumOfInertialSamples = 8; /**< The number of IMU samples kept in the ring buffer. */
+const int lbhNumOfInertialSensors = accZSensor + 1 - gyroXSensor; /**< The values of an IMU sample (gyro and acc). */
 
 enum BHState
 {
@@ -372,9 +375,25 @@ struct LBHData
   NAOType bodyType;
   float sensors[3][lbhNumOfSensorIds];
   float actuators[3][lbhNumOfActuatorIds];
-  RoboCup::RoboCupGameControlData gameControlData[3];
+  volatile unsigned gameControlDataVersion; /**< Sequence counter protecting gameControlData. It is odd while libbhuman writes. */
+  RoboCup::RoboCupGameControlData gameControlData; /**< The latest GameController packet. Only rewritten when it changed. */
 
   BHState state;
   int teamInfo[lbhNumOfTeamInfoIds];
   unsigned bhumanStartTime;
+
+  // Timing information. All times are in microseconds of the monotonic clock.
+  // Each counter has a single writer, so no locking is required to read it.
+  volatile unsigned sensorsTime[3]; /**< For each sensor buffer, when libbhuman wrote it. */
+  volatile unsigned actuatorsSensorsTime[3]; /**< For each actuator buffer, the time of the sensor data it was computed from. */
+  volatile unsigned dcmCycles; /**< The number of DCM cycles since libbhuman was started. */
+  volatile unsigned missedActuatorCycles; /**< The number of DCM cycles without new actuator data from bhuman. */
+  volatile unsigned droppedSensorCycles; /**< The number of DCM cycles in which bhuman did not take the previous sensor data. */
+  volatile unsigned latencyHistogram[lbhNumOfTimingBins]; /**< Time between writing sensor data and reading the actuator data computed from it. */
+
+  // The IMU samples of all DCM cycles, including those in which bhuman did not take the sensor data.
+  // Sample i is stored at index i % lbhNumOfInertialSamples.
+  volatile unsigned inertialSampleCount; /**< The number of IMU samples written. The sample with this number is the one being written. */
+  volatile unsigned sensorsInertialSample[3]; /**< For each sensor buffer, the number of the IMU sample that was written together with it. */
+  float inertialSamples[lbhNumOfInertialSamples][lbhNumOfInertialSensors];
 };
@@ -98,6 +98,7 @@ private:
   int teamNumber; /**< The team number. */
   int chestButtonPressCounter; /**< Counter for pressing the chest button*/
   RoboCupGameControlData gameCtrlData; /**< The local copy of the GameController packet. */
+  int publishCounter; /**< Incremented whenever gameCtrlData is published. Allows clients to detect changes without copying the packet. */
   uint8_t previousState; /**< The game state during the previous cycle. Used to detect when LEDs have to be updated. */
   uint8_t previousSecondaryState; /**< The secondary game state during the previous cycle. Used to detect when LEDs have to be updated. */
   uint8_t previousKickOffTeam; /**< The kick-off team during the previous cycle. Used to detect when LEDs have to be updated. */
@@ -446,6 +447,7 @@ private:
   {
     AL::ALValue value((const char*) &gameCtrlData, sizeof(gameCtrlData));
     memory->insertData("GameCtrl/RoboCupGameControlData", value);
+    memory->insertData("GameCtrl/publishCounter", ++publishCounter);
   }
 
   /**
@@ -494,7 +496,8 @@ public:
       proxy(0),
       memory(0),
       udp(0),
-      teamNumber(0)
+      teamNumber(0),
+      publishCounter(0)
   {
     setModuleDescription("A module that provides packets from the GameController.");
 
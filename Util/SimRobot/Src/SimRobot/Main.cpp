@@ -92,6 +92,12 @@ int main(int argc, char *argv[])
 
   app.setApplicationName("SimRobot");
 
+  // run without showing the window and start the simulation right away?
+  bool headless = false;
+  for(int i = 1; i < argc; i++)
+    if(!strcmp(argv[i], "-headless"))
+      headless = true;
+
   // open file from commandline
   for(int i = 1; i < argc; i++)
     if(*argv[i] != '-' && strcmp(argv[i], "YES"))
@@ -100,6 +106,9 @@ int main(int argc, char *argv[])
       break;
     }
 
-  mainWindow.show();
+  if(headless)
+    mainWindow.simStart();
+  else
+    mainWindow.show();
   return app.exec();
 }
@@ -203,6 +203,7 @@ Element* Parser::sceneElement()
   if(scene->contactSoftCFM != -1.f)
     scene->contactMode |= dContactSoftCFM;
   scene->detectBodyCollisions = getBool("bodyCollisions", false, true);
+  scene->sweepAndPrune = getBool("sweepAndPrune", false, false);
 
   ASSERT(!Simulation::simulation->scene);
   Simulation::simulation->scene = scene;
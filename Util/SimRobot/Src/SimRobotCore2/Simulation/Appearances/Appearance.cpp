@@ -5,6 +5,7 @@
 */
 
 #include "Platform/OpenGL.h"
+#include <algorithm>
 
 #include "Simulation/Appearances/Appearance.h"
 #include "Simulation/Scene.h"
@@ -128,6 +129,11 @@ void Appearance::Surface::addParent(Element& element)
   appearance->surface = this;
 }
 
+float Appearance::getRadius() const
+{
+  return (translation ? translation->abs() : 0.f) + std::max(getShapeRadius(), GraphicalObject::getRadius());
+}
+
 void Appearance::assembleAppearances() const
 {
   glPushMatrix();
@@ -60,7 +60,19 @@ public:
   /** Default constructor */
   Appearance() : surface(0) {}
 
+  /**
+  * Computes the radius of a sphere around the origin of the parent object that covers this appearance (including children)
+  * @return The radius
+  */
+  virtual float getRadius() const;
+
 protected:
+  /**
+  * Returns the radius of a sphere around the origin of this appearance that covers its shape (without children)
+  * @return The radius
+  */
+  virtual float getShapeRadius() const {return 0.f;}
+
   /**
   * Prepares the object and the currently selected OpenGL context for drawing the object.
   * Loads textures and creates display lists. Hence, this function is called for each OpenGL
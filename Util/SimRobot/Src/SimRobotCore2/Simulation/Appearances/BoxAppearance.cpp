@@ -5,6 +5,8 @@
 */
 
 #include "Platform/OpenGL.h"
+#include <algorithm>
+#include <cmath>
 
 #include "Simulation/Appearances/BoxAppearance.h"
 
@@ -78,3 +80,8 @@ void BoxAppearance::assembleAppearances() const
   GraphicalObject::assembleAppearances();
   glPopMatrix();
 }
+
+float BoxAppearance::getShapeRadius() const
+{
+  return 0.5f * std::sqrt(width * width + height * height + depth * depth);
+}
@@ -5,6 +5,8 @@
 */
 
 #include "Platform/OpenGL.h"
+#include <algorithm>
+#include <cmath>
 
 #include "Simulation/Appearances/CapsuleAppearance.h"
 
@@ -29,3 +31,8 @@ void CapsuleAppearance::assembleAppearances() const
   GraphicalObject::assembleAppearances();
   glPopMatrix();
 }
+
+float CapsuleAppearance::getShapeRadius() const
+{
+  return std::max(radius, height * 0.5f);
+}
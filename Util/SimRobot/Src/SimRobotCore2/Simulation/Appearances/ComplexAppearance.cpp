@@ -4,6 +4,7 @@
 * @author Colin Graf
 */
 
+#include <algorithm>
 #include <cmath>
 #include "Platform/OpenGL.h"
 
@@ -158,3 +159,11 @@ void ComplexAppearance::assembleAppearances() const
   GraphicalObject::assembleAppearances();
   glPopMatrix();
 }
+
+float ComplexAppearance::getShapeRadius() const
+{
+  float sqrRadius = 0.f;
+  for(const Vertex& vertex : vertices->vertices)
+    sqrRadius = std::max(sqrRadius, vertex.x * vertex.x + vertex.y * vertex.y + vertex.z * vertex.z);
+  return std::sqrt(sqrRadius);
+}
@@ -188,4 +188,7 @@ private:
 
   /** Draws appearance primitives of the object (including children) on the currently selected OpenGL context (in order to create a display list) */
   virtual void assembleAppearances() const;
+
+  /** Returns the radius of a sphere around the origin of this appearance that covers its shape */
+  virtual float getShapeRadius() const;
 };
@@ -5,6 +5,8 @@
 */
 
 #include "Platform/OpenGL.h"
+#include <algorithm>
+#include <cmath>
 
 #include "Simulation/Appearances/CylinderAppearance.h"
 
@@ -31,3 +33,8 @@ void CylinderAppearance::assembleAppearances() const
   GraphicalObject::assembleAppearances();
   glPopMatrix();
 }
+
+float CylinderAppearance::getShapeRadius() const
+{
+  return std::sqrt(radius * radius + height * height * 0.25f);
+}
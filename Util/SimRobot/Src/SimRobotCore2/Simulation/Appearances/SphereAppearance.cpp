@@ -26,3 +26,8 @@ void SphereAppearance::assembleAppearances() const
   GraphicalObject::assembleAppearances();
   glPopMatrix();
 }
+
+float SphereAppearance::getShapeRadius() const
+{
+  return radius;
+}
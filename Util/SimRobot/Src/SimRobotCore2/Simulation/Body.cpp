@@ -5,6 +5,7 @@
 */
 
 #include "Platform/OpenGL.h"
+#include <algorithm>
 
 #include "Platform/Assert.h"
 #include "Simulation/Body.h"
@@ -188,6 +189,7 @@ void Body::addMass(Mass& mass)
 void Body::createGraphics()
 {
   GraphicalObject::createGraphics();
+  appearanceRadius = GraphicalObject::getRadius();
   for(std::list<Body*>::const_iterator iter = bodyChildren.begin(), end = bodyChildren.end(); iter != end; ++iter)
     (*iter)->createGraphics();
 }
@@ -207,6 +209,14 @@ void Body::updateTransformation()
     (*iter)->updateTransformation();
 }
 
+float Body::getBoundingRadius(const Vector3<>& center) const
+{
+  float radius = (pose.translation - center).abs() + appearanceRadius;
+  for(std::list<Body*>::const_iterator iter = bodyChildren.begin(), end = bodyChildren.end(); iter != end; ++iter)
+    radius = std::max(radius, (*iter)->getBoundingRadius(center));
+  return radius;
+}
+
 void Body::drawAppearances() const
 {
   glPushMatrix();
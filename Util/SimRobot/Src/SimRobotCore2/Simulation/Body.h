@@ -26,7 +26,7 @@ public:
   dMass mass; /**< The mass of the body (at \c centerOfMass)*/
 
   /** Default constructor */
-  Body() : body(0), bodySpace(0) {mass.mass = 0.f;}
+  Body() : body(0), bodySpace(0), appearanceRadius(0.f) {mass.mass = 0.f;}
 
   /**
   * Prepares the object and the currently selected OpenGL context for drawing the object.
@@ -46,6 +46,13 @@ public:
   /** Updates the transformation from the parent to this body (since the pose of the body may have changed) */
   void updateTransformation();
 
+  /**
+  * Computes the radius of a sphere that covers the appearances of this body and all its child bodies
+  * @param center The center of the sphere
+  * @return The radius
+  */
+  float getBoundingRadius(const Vector3<>& center) const;
+
   /** Moves the object and its children relative to its current position
   * @param offset The distance to move
   */
@@ -79,6 +86,8 @@ private:
 
   dSpaceID bodySpace; /**< The collision space for a connected group of movable objects */
 
+  float appearanceRadius; /**< The radius of a sphere around the origin of this body that covers its appearances (without child bodies) */
+
   std::list<Body*> bodyChildren; /**< List of first-degree child bodies that are connected to this body over a joint */
 
   /** Destructor */
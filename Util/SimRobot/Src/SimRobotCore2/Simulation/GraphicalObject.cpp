@@ -5,6 +5,7 @@
 */
 
 #include "Platform/OpenGL.h"
+#include <algorithm>
 
 #include "Simulation/Simulation.h"
 #include "Simulation/Scene.h"
@@ -40,6 +41,14 @@ void GraphicalObject::drawAppearances() const
   glCallList(listId);
 }
 
+float GraphicalObject::getRadius() const
+{
+  float radius = 0.f;
+  for(std::list<GraphicalObject*>::const_iterator iter = graphicalDrawings.begin(), end = graphicalDrawings.end(); iter != end; ++iter)
+    radius = std::max(radius, (*iter)->getRadius());
+  return radius;
+}
+
 void GraphicalObject::assembleAppearances() const
 {
   for(std::list<GraphicalObject*>::const_iterator iter = graphicalDrawings.begin(), end = graphicalDrawings.end(); iter != end; ++iter)
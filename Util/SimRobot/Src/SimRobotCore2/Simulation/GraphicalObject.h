@@ -33,6 +33,13 @@ public:
   /** Draws appearance primitives of the object (including children) on the currently selected OpenGL context (as fast as possible) */
   virtual void drawAppearances() const;
 
+  /**
+  * Computes the radius of a sphere that covers all appearances drawn by this object (including children).
+  * The sphere is centered at the origin relative to which the object is drawn.
+  * @return The radius
+  */
+  virtual float getRadius() const;
+
 protected:
   unsigned int initializedContexts;
 
@@ -7,6 +7,7 @@
 #include "CoreModule.h"
 #include "Platform/OpenGL.h"
 #include "Platform/Assert.h"
+#include <cmath>
 #include "Simulation/Simulation.h"
 #include "Simulation/Scene.h"
 #include "Simulation/Body.h"
@@ -90,8 +91,40 @@ void Scene::createGraphics(bool isShared)
 
 void Scene::drawAppearances() const
 {
+  // compute the planes of the view frustum in world coordinates from the current transformations
+  float modelView[16];
+  float projection[16];
+  glGetFloatv(GL_MODELVIEW_MATRIX, modelView);
+  glGetFloatv(GL_PROJECTION_MATRIX, projection);
+  float clip[16];
+  for(int col = 0; col < 4; ++col)
+    for(int row = 0; row < 4; ++row)
+      clip[col * 4 + row] = projection[row] * modelView[col * 4] + projection[4 + row] * modelView[col * 4 + 1] +
+                            projection[8 + row] * modelView[col * 4 + 2] + projection[12 + row] * modelView[col * 4 + 3];
+  float planes[6][4];
+  for(int i = 0; i < 6; ++i)
+  {
+    const int row = i >> 1;
+    const float sign = i & 1 ? -1.f : 1.f;
+    for(int j = 0; j < 4; ++j)
+      planes[i][j] = clip[j * 4 + 3] + sign * clip[j * 4 + row];
+    const float length = std::sqrt(planes[i][0] * planes[i][0] + planes[i][1] * planes[i][1] + planes[i][2] * planes[i][2]);
+    if(length > 0.f)
+      for(int j = 0; j < 4; ++j)
+        planes[i][j] /= length;
+  }
+
+  // only draw bodies whose bounding sphere intersects the view frustum
   for(std::list<Body*>::const_iterator iter = bodies.begin(), end = bodies.end(); iter != end; ++iter)
-    (*iter)->drawAppearances();
+  {
+    const Vector3<>& center = (*iter)->pose.translation;
+    const float radius = (*iter)->getBoundingRadius(center);
+    bool visible = true;
+    for(int i = 0; i < 6 && visible; ++i)
+      visible = planes[i][0] * center.x + planes[i][1] * center.y + planes[i][2] * center.z + planes[i][3] > -radius;
+    if(visible)
+      (*iter)->drawAppearances();
+  }
   GraphicalObject::drawAppearances();
 }
 
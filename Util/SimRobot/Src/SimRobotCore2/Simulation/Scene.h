@@ -63,6 +63,7 @@ public:
   int quickSolverIterations; /**< The iteration count for ODE's quick solver */
   int quickSolverSkip; /**< Controls how often the normal solver will be used instead of the quick solver */
   bool detectBodyCollisions; /**< Whether to detect collision between different bodies */
+  bool sweepAndPrune; /**< Whether to use a sweep and prune space instead of a hash space for movable objects */
 
   Appearance::Surface* defaultSurface; /**< A surface that will be used for drawing physical objects */
 
@@ -71,7 +72,7 @@ public:
   std::list<Light*> lights; /** List of scene lights */
 
   /** Default constructor */
-  Scene() : contactMode(0), useQuickSolver(false), quickSolverIterations(-1), lastTransformationUpdateStep(0)
+  Scene() : contactMode(0), useQuickSolver(false), quickSolverIterations(-1), sweepAndPrune(false), lastTransformationUpdateStep(0)
   {
     color[0] = color[1] = color[2] = color[3] = 0.f;
     defaultSurface = new Appearance::Surface();
@@ -13,7 +13,9 @@
 
 /**
 * @class ApproxDistanceSensor
-* A distance sensor that uses a ray to detect distances to other objects
+* A distance sensor that uses a ray to detect distances to other objects.
+* It only intersects its bounding box with the collision spaces, so it is cheaper than
+* rendering a depth image, and it is only computed once per simulation step when read.
 */
 class ApproxDistanceSensor : public Sensor
 {
@@ -128,6 +128,8 @@ bool Camera::CameraSensor::renderCameraImages(SimRobotCore2::SensorPort** camera
        sensor->camera->imageWidth == imageWidth && sensor->camera->imageHeight == imageHeight)
       ++imagesOfCurrentSize;
   }
+  if(!imagesOfCurrentSize)
+    return true;
   const unsigned int multiImageBufferSize = imageSize * imagesOfCurrentSize;
 
   if(imageBufferSize < multiImageBufferSize)
@@ -156,8 +158,11 @@ bool Camera::CameraSensor::renderCameraImages(SimRobotCore2::SensorPort** camera
   glPolygonMode(GL_FRONT, GL_FILL);
   glShadeModel(GL_SMOOTH);
 
-  // clear buffers
+  // clear only the part of the buffers that is rendered to and read back
+  glEnable(GL_SCISSOR_TEST);
+  glScissor(0, 0, imageWidth, imageHeight * imagesOfCurrentSize);
   glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+  glDisable(GL_SCISSOR_TEST);
 
   // render images
   int currentHorizontalPos = 0;
@@ -72,7 +72,8 @@ bool Simulation::loadFile(const std::string& filename, std::list<std::string>& e
   physicalWorld = dWorldCreate();
   rootSpace = dHashSpaceCreate(0);
   staticSpace = dHashSpaceCreate(rootSpace);
-  movableSpace = dHashSpaceCreate(rootSpace);
+  // Sweep and prune scales better than hashing when many robots are spread across the field.
+  movableSpace = scene->sweepAndPrune ? dSweepAndPruneSpaceCreate(rootSpace, dSAP_AXES_XYZ) : dHashSpaceCreate(rootSpace);
   contactGroup = dJointGroupCreate(0);
 
   dWorldSetGravity(physicalWorld, 0, 0, scene->gravity);